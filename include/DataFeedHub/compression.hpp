@@ -16,6 +16,12 @@
 //------------------------------------------------------------------------------
 
 #include <fstream>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
 
 //------------------------------------------------------------------------------
 // Internal utility modules
@@ -7,6 +7,7 @@
 
 #include "bars/IBarSerializer.hpp"
 #include "bars/BarBinarySerializerV1.hpp"
+#include "bars/BarCompressorV1.hpp"
 #include "bars/BarSerializer.hpp"
 
 #endif // _DFH_COMPRESSION_BARS_HPP_INCLUDED
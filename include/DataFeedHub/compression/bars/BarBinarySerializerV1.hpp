@@ -9,6 +9,11 @@ namespace dfh::compression {
 
     /// \class BarBinarySerializerV1
     /// \brief Converts bar data to a raw binary format without compression.
+    ///
+    /// With `BarStorageFlags::IMPLICIT_TIME` the bars are written without `time_ms`, preceded by a
+    /// bitmap of occupied slots of the timeframe grid (see time_bitmap.hpp): 7 bits for a D1
+    /// segment, 3600 bits for an S1 segment. Bars off the grid are written with their timestamps,
+    /// so the flag is only kept by the decoder when the bitmap was actually used.
     class BarBinarySerializerV1 final : public IBarSerializer {
     public:
 
@@ -54,8 +59,16 @@ namespace dfh::compression {
 
             const uint64_t duration_ms = dfh::get_segment_duration_ms(m_config.time_frame);
 
+            const uint64_t base_unix_interval = (bars[0].time_ms / duration_ms);
+            const uint64_t base_unix_time = base_unix_interval * duration_ms;
+            const uint64_t bar_ms = dfh::to_ms(m_config.time_frame);
+            const bool implicit_time =
+                m_config.has_flag(dfh::BarStorageFlags::IMPLICIT_TIME) &&
+                build_time_bitmap(bars.data(), bars.size(), base_unix_time, bar_ms,
+                                  static_cast<size_t>(duration_ms / bar_ms), m_time_bitmap);
+
             output.clear();
-            output.reserve(bars.size() * sizeof(dfh::MarketBar) + 32);
+            output.reserve(bars.size() * sizeof(dfh::MarketBar) + m_time_bitmap.size() / 8 + 32);
 
             constexpr uint8_t signature = 0x00;
             output.push_back(signature);
@@ -83,6 +96,7 @@ namespace dfh::compression {
             output.push_back(header);
 
             header = 0x00;
+            header |= implicit_time ? 0x01 : 0x00;
             header |= (m_config.has_flag(dfh::BarStorageFlags::SPREAD_LAST) << 4) & 0x10;
             header |= (m_config.has_flag(dfh::BarStorageFlags::SPREAD_AVG) << 5) & 0x20;
             header |= (m_config.has_flag(dfh::BarStorageFlags::SPREAD_MAX) << 6) & 0x40;
@@ -91,13 +105,18 @@ namespace dfh::compression {
 
             dfh::utils::append_vbyte<uint32_t>(output, static_cast<uint32_t>(m_config.time_frame));
 
-            const uint64_t base_unix_interval = (bars[0].time_ms / duration_ms);
-            const uint64_t base_unix_time = base_unix_interval * duration_ms;
-
             dfh::utils::append_vbyte<uint32_t>(output, base_unix_interval);
             dfh::utils::append_vbyte<uint64_t>(output, encode_zig_zag_int64((int64_t)m_config.expiration_time_ms - (int64_t)base_unix_time));
             dfh::utils::append_vbyte<uint64_t>(output, encode_zig_zag_int64((int64_t)m_config.next_expiration_time_ms - (int64_t)base_unix_time));
 
+            if (implicit_time) {
+                append_time_bitmap(output, m_time_bitmap);
+                for (const auto& bar : bars) {
+                    append_binary_without_time(output, bar);
+                }
+                return;
+            }
+
             for (const auto& bar : bars) {
                 append_binary(output, bar);
             }
@@ -120,75 +139,118 @@ namespace dfh::compression {
         void deserialize(
             const std::vector<uint8_t>& input,
             std::vector<MarketBar>& bars) override final {
+            deserialize(input.data(), input.size(), bars);
+        }
+
+        /// \copydoc IBarSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketBar>&, BarCodecConfig&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If the binary buffer is too small for the expected number of bars.
+        void deserialize(
+            const std::vector<uint8_t>& input,
+            std::vector<dfh::MarketBar>& bars,
+            BarCodecConfig& config) override final {
+
+            deserialize(input, bars);
+            config = m_config;
+        }
 
-            if (input.empty()) return;
+        /// \copydoc IBarSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketBar>&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If the binary buffer is too small for the expected number of bars.
+        void deserialize(
+            const uint8_t* data,
+            size_t size,
+            std::vector<MarketBar>& bars) override final {
+            if (size == 0) return;
             size_t offset = 0;
 
             constexpr uint8_t signature = 0x00;
-            if (input[offset++] != signature) {
+            if (data[offset++] != signature) {
                 throw std::invalid_argument("Invalid data signature for MarketBar binary format.");
             }
 
-            m_config.set_flag(BarStorageFlags::STORE_RAW_BINARY, true);
-
-            const size_t num_bars = dfh::utils::extract_vbyte<uint32_t>(input.data(), offset);
+            const size_t num_bars = dfh::utils::extract_vbyte<uint32_t>(data, offset);
 
-            uint8_t header = input[offset++];
+            uint8_t header = data[offset++];
             m_config.flags = BarStorageFlags::NONE;
+            m_config.set_flag(BarStorageFlags::STORE_RAW_BINARY, true);
             m_config.price_digits = header & 0x1F;
             m_config.set_flag(BarStorageFlags::BID_BASED, (header & 0x20) != 0);
             m_config.set_flag(BarStorageFlags::ASK_BASED, (header & 0x40) != 0);
             m_config.set_flag(BarStorageFlags::LAST_BASED, (header & 0x80) != 0);
 
-            header = input[offset++];
+            header = data[offset++];
             m_config.volume_digits = header & 0x1F;
             m_config.set_flag(BarStorageFlags::ENABLE_VOLUME, (header & 0x20) != 0);
             m_config.set_flag(BarStorageFlags::ENABLE_QUOTE_VOLUME, (header & 0x40) != 0);
             m_config.set_flag(BarStorageFlags::ENABLE_TICK_VOLUME, (header & 0x80) != 0);
 
-            header = input[offset++];
+            header = data[offset++];
             m_config.quote_volume_digits = header & 0x1F;
             m_config.set_flag(BarStorageFlags::ENABLE_BUY_VOLUME, (header & 0x20) != 0);
             m_config.set_flag(BarStorageFlags::ENABLE_BUY_QUOTE_VOLUME, (header & 0x40) != 0);
             m_config.set_flag(BarStorageFlags::ENABLE_SPREAD, (header & 0x80) != 0);
 
-            header = input[offset++];
+            header = data[offset++];
+            const bool implicit_time = (header & 0x01) != 0;
+            m_config.set_flag(BarStorageFlags::IMPLICIT_TIME, implicit_time);
             m_config.set_flag(BarStorageFlags::SPREAD_LAST, (header & 0x10) != 0);
             m_config.set_flag(BarStorageFlags::SPREAD_AVG, (header & 0x20) != 0);
             m_config.set_flag(BarStorageFlags::SPREAD_MAX, (header & 0x40) != 0);
             m_config.set_flag(BarStorageFlags::FINALIZED_BARS, (header & 0x80) != 0);
 
-            m_config.time_frame = static_cast<dfh::TimeFrame>(dfh::utils::extract_vbyte<uint32_t>(input.data(), offset));
+            m_config.time_frame = static_cast<dfh::TimeFrame>(dfh::utils::extract_vbyte<uint32_t>(data, offset));
 
             const uint64_t duration_ms = dfh::get_segment_duration_ms(m_config.time_frame);
-            const uint64_t base_unix_interval = dfh::utils::extract_vbyte<uint32_t>(input.data(), offset);
+            const uint64_t base_unix_interval = dfh::utils::extract_vbyte<uint32_t>(data, offset);
             const uint64_t base_unix_time     = base_unix_interval * duration_ms;
-            m_config.expiration_time_ms       = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(input.data(), offset));
-            m_config.next_expiration_time_ms  = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(input.data(), offset));
+            m_config.expiration_time_ms       = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(data, offset));
+            m_config.next_expiration_time_ms  = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(data, offset));
+
+            if (implicit_time) {
+                const uint64_t bar_ms = dfh::to_ms(m_config.time_frame);
+                const size_t num_slots = static_cast<size_t>(duration_ms / bar_ms);
+                if (offset + (num_slots + 7) / 8 + num_bars * BAR_SIZE_WITHOUT_TIME > size) {
+                    throw std::runtime_error("Input buffer is too small for expected MarketBar data.");
+                }
+                extract_time_bitmap(data, offset, num_slots, m_time_bitmap);
+                bars.resize(num_bars);
+                const uint8_t* src = data + offset;
+                for (size_t i = 0; i < num_bars; ++i, src += BAR_SIZE_WITHOUT_TIME) {
+                    std::memcpy(reinterpret_cast<uint8_t*>(&bars[i]) + BAR_TIME_SIZE, src, BAR_SIZE_WITHOUT_TIME);
+                }
+                expand_time_bitmap(m_time_bitmap, base_unix_time, bar_ms, bars.data(), num_bars);
+                return;
+            }
 
             const size_t expected_size = num_bars * sizeof(dfh::MarketBar);
-            if ((offset + expected_size) > input.size()) {
+            if ((offset + expected_size) > size) {
                 throw std::runtime_error("Input buffer is too small for expected MarketBar data.");
             }
 
             bars.resize(num_bars);
-            std::memcpy(bars.data(), input.data() + offset, num_bars * sizeof(dfh::MarketBar));
+            std::memcpy(bars.data(), data + offset, num_bars * sizeof(dfh::MarketBar));
         }
 
-        /// \copydoc IBarSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketBar>&, BarCodecConfig&)
+        /// \copydoc IBarSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketBar>&, BarCodecConfig&)
         /// \throws std::invalid_argument If the binary signature is invalid.
         /// \throws std::runtime_error If the binary buffer is too small for the expected number of bars.
         void deserialize(
-            const std::vector<uint8_t>& input,
+            const uint8_t* data,
+            size_t size,
             std::vector<dfh::MarketBar>& bars,
             BarCodecConfig& config) override final {
-
-            deserialize(input, bars);
+            deserialize(data, size, bars);
             config = m_config;
         }
 
     private:
-        dfh::BarCodecConfig m_config; ///< Configuration used for encoding and decoding.
+        static constexpr size_t BAR_TIME_SIZE = sizeof(uint64_t); ///< Size of the leading `time_ms` field.
+        static constexpr size_t BAR_SIZE_WITHOUT_TIME = sizeof(dfh::MarketBar) - BAR_TIME_SIZE; ///< Bar size in implicit-time mode.
+        static_assert(offsetof(dfh::MarketBar, open) == BAR_TIME_SIZE, "MarketBar must start with time_ms.");
+
+        dfh::BarCodecConfig m_config;           ///< Configuration used for encoding and decoding.
+        dfh::utils::DynamicBitset m_time_bitmap; ///< Slot bitmap of the current segment.
 
         /// \brief Appends a MarketBar structure to the binary output buffer.
         /// \param buffer Binary buffer to append to.
@@ -197,6 +259,14 @@ namespace dfh::compression {
             const uint8_t* data = reinterpret_cast<const uint8_t*>(&bar);
             buffer.insert(buffer.end(), data, data + sizeof(dfh::MarketBar));
         }
+
+        /// \brief Appends a MarketBar structure without its `time_ms` field.
+        /// \param buffer Binary buffer to append to.
+        /// \param bar Bar data to append in raw memory form.
+        static void append_binary_without_time(std::vector<uint8_t>& buffer, const dfh::MarketBar& bar) {
+            const uint8_t* data = reinterpret_cast<const uint8_t*>(&bar) + BAR_TIME_SIZE;
+            buffer.insert(buffer.end(), data, data + BAR_SIZE_WITHOUT_TIME);
+        }
     };
 
 } // namespace dfh::compression
@@ -0,0 +1,533 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_BAR_COMPRESSOR_V1_HPP_INCLUDED
+#define _DFH_COMPRESSION_BAR_COMPRESSOR_V1_HPP_INCLUDED
+
+/// \file BarCompressorV1.hpp
+/// \brief Columnar compression of market bars.
+
+namespace dfh::compression {
+
+    /// \class BarCompressorV1
+    /// \brief Compresses bars column by column and packs the result with ZSTD.
+    ///
+    /// Layout of the data inside the ZSTD frame:
+    /// - four header bytes with the digits and storage flags (same bit layout as
+    ///   `BarBinarySerializerV1`; bits 0-1 of the fourth byte hold the time mode), the timeframe,
+    ///   the segment start interval and the expiration times;
+    /// - time: a bitmap of occupied slots on the timeframe grid (see time_bitmap.hpp), just the
+    ///   first slot when the bars have no gaps, or Zig-Zag deltas for bars off the grid;
+    /// - prices as fixed-point integers scaled by `price_digits`: open relative to the previous
+    ///   close, close relative to open, and the upper and lower wicks relative to the body;
+    /// - enabled volumes, tick volume and spread as fixed-point integers.
+    ///
+    /// Every integer column goes through the frequency, zero-repeat and simdcomp stages of
+    /// TickEncoderV1::encode_zig_zag_column(). Segments shorter than one SIMD block (e.g. D1 bars
+    /// of a week) store columns as plain VByte instead (bit 2 of the fourth header byte), since
+    /// simdcomp pads every column to 16 bytes. Prices are restored with `price_digits` precision
+    /// and volumes with `volume_digits` / `quote_volume_digits` precision.
+    class BarCompressorV1 final : public IBarSerializer {
+    public:
+
+        /// \brief Constructs the compressor with its own compression context.
+        BarCompressorV1()
+            : m_context(), m_encoder(m_context), m_decoder(m_context) {
+        }
+
+        /// \copydoc IBarSerializer::set_codec_config
+        void set_codec_config(const dfh::BarCodecConfig& config) override final {
+            m_config = config;
+        }
+
+        /// \copydoc IBarSerializer::codec_config
+        const dfh::BarCodecConfig& codec_config() const override final {
+            return m_config;
+        }
+
+        /// \copydoc IBarSerializer::is_valid_signature
+        bool is_valid_signature(const std::vector<uint8_t>& input) const override final {
+            if (input.empty()) return false;
+            return input[0] == SIGNATURE;
+        }
+
+        /// \copydoc IBarSerializer::serialize(const std::vector<MarketBar>&, std::vector<uint8_t>&)
+        /// \throws std::invalid_argument If a digit field exceeds the allowed precision or a volume is negative.
+        void serialize(
+            const std::vector<dfh::MarketBar>& bars,
+            std::vector<uint8_t>& output) override final {
+            compress(bars, output);
+        }
+
+        /// \copydoc IBarSerializer::serialize(const std::vector<MarketBar>&, const BarCodecConfig&, std::vector<uint8_t>&)
+        /// \throws std::invalid_argument If a digit field exceeds the allowed precision or a volume is negative.
+        void serialize(
+            const std::vector<dfh::MarketBar>& bars,
+            const dfh::BarCodecConfig& config,
+            std::vector<uint8_t>& output) override final {
+            m_config = config;
+            compress(bars, output);
+        }
+
+        /// \copydoc IBarSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketBar>&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If decompression fails.
+        void deserialize(
+            const std::vector<uint8_t>& input,
+            std::vector<dfh::MarketBar>& bars) override final {
+            decompress(input.data(), input.size(), bars);
+        }
+
+        /// \copydoc IBarSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketBar>&, BarCodecConfig&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If decompression fails.
+        void deserialize(
+            const std::vector<uint8_t>& input,
+            std::vector<dfh::MarketBar>& bars,
+            dfh::BarCodecConfig& config) override final {
+            decompress(input.data(), input.size(), bars);
+            config = m_config;
+        }
+
+        /// \copydoc IBarSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketBar>&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If decompression fails.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<dfh::MarketBar>& bars) override final {
+            decompress(data, size, bars);
+        }
+
+        /// \copydoc IBarSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketBar>&, BarCodecConfig&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If decompression fails.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<dfh::MarketBar>& bars,
+                dfh::BarCodecConfig& config) override final {
+            decompress(data, size, bars);
+            config = m_config;
+        }
+
+    private:
+        static constexpr uint8_t SIGNATURE  = 0x01;
+        static constexpr int     ZSTD_LEVEL = 9;
+        static constexpr size_t  MIN_SIMD_COLUMN = 128; ///< Shorter columns are stored as VByte.
+
+        /// \brief How bar timestamps are stored (bits 0-1 of the fourth header byte).
+        enum class TimeMode : uint8_t {
+            EXPLICIT = 0, ///< Zig-Zag deltas of `time_ms`.
+            BITMAP   = 1, ///< Bitmap of occupied grid slots.
+            DENSE    = 2  ///< Consecutive grid slots; only the first slot is stored.
+        };
+
+        TickCompressionContextV1 m_context; ///< Scratch buffers and ZSTD contexts.
+        TickEncoderV1            m_encoder; ///< Provides the integer column stages.
+        TickDecoderV1            m_decoder; ///< Provides the integer column stages.
+        dfh::BarCodecConfig      m_config;  ///< Configuration used for encoding and decoding.
+        dfh::utils::DynamicBitset m_time_bitmap; ///< Slot bitmap of the current segment.
+        std::vector<int64_t>     m_open;    ///< Fixed-point open prices of the current segment.
+        std::vector<int64_t>     m_close;   ///< Fixed-point close prices of the current segment.
+        bool                     m_vbyte_columns = false; ///< Columns of the current segment are plain VByte.
+
+        /// \brief Compresses bars.
+        /// \param bars Bars of one segment in time order.
+        /// \param output Buffer receiving the compressed data (cleared first).
+        void compress(
+                const std::vector<dfh::MarketBar>& bars,
+                std::vector<uint8_t>& output) {
+            if (bars.empty()) return;
+
+            constexpr uint16_t max_digits = 18;
+            if (m_config.price_digits > max_digits ||
+                m_config.volume_digits > max_digits ||
+                m_config.quote_volume_digits > max_digits) {
+                throw std::invalid_argument("One or more digit fields exceed maximum allowed digits.");
+            }
+
+            const size_t num_bars = bars.size();
+            const uint64_t duration_ms = dfh::get_segment_duration_ms(m_config.time_frame);
+            const uint64_t bar_ms = dfh::to_ms(m_config.time_frame);
+            const uint64_t base_unix_interval = (bars[0].time_ms / duration_ms);
+            const uint64_t base_unix_time = base_unix_interval * duration_ms;
+            const size_t num_slots = static_cast<size_t>(duration_ms / bar_ms);
+
+            TimeMode time_mode = TimeMode::EXPLICIT;
+            size_t first_slot = 0;
+            if (build_time_bitmap(bars.data(), num_bars, base_unix_time, bar_ms, num_slots, m_time_bitmap)) {
+                first_slot = static_cast<size_t>((bars[0].time_ms - base_unix_time) / bar_ms);
+                const size_t last_slot = static_cast<size_t>((bars[num_bars - 1].time_ms - base_unix_time) / bar_ms);
+                time_mode = (last_slot - first_slot + 1 == num_bars) ? TimeMode::DENSE : TimeMode::BITMAP;
+            }
+
+            m_context.reset();
+            auto& buffer = m_context.processing_buffer;
+
+            uint8_t header = 0x00;
+            header |= (m_config.price_digits & 0x1F);
+            header |= (m_config.has_flag(dfh::BarStorageFlags::BID_BASED) << 5) & 0x20;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::ASK_BASED) << 6) & 0x40;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::LAST_BASED) << 7) & 0x80;
+            buffer.push_back(header);
+
+            header = 0x00;
+            header |= (m_config.volume_digits & 0x1F);
+            header |= (m_config.has_flag(dfh::BarStorageFlags::ENABLE_VOLUME) << 5) & 0x20;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::ENABLE_QUOTE_VOLUME) << 6) & 0x40;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::ENABLE_TICK_VOLUME) << 7) & 0x80;
+            buffer.push_back(header);
+
+            header = 0x00;
+            header |= (m_config.quote_volume_digits & 0x1F);
+            header |= (m_config.has_flag(dfh::BarStorageFlags::ENABLE_BUY_VOLUME) << 5) & 0x20;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::ENABLE_BUY_QUOTE_VOLUME) << 6) & 0x40;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::ENABLE_SPREAD) << 7) & 0x80;
+            buffer.push_back(header);
+
+            m_vbyte_columns = (num_bars < MIN_SIMD_COLUMN);
+            header = static_cast<uint8_t>(time_mode);
+            header |= (m_vbyte_columns << 2) & 0x04;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::SPREAD_LAST) << 4) & 0x10;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::SPREAD_AVG) << 5) & 0x20;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::SPREAD_MAX) << 6) & 0x40;
+            header |= (m_config.has_flag(dfh::BarStorageFlags::FINALIZED_BARS) << 7) & 0x80;
+            buffer.push_back(header);
+
+            dfh::utils::append_vbyte<uint32_t>(buffer, static_cast<uint32_t>(m_config.time_frame));
+            dfh::utils::append_vbyte<uint32_t>(buffer, base_unix_interval);
+            dfh::utils::append_vbyte<uint64_t>(buffer, encode_zig_zag_int64((int64_t)m_config.expiration_time_ms - (int64_t)base_unix_time));
+            dfh::utils::append_vbyte<uint64_t>(buffer, encode_zig_zag_int64((int64_t)m_config.next_expiration_time_ms - (int64_t)base_unix_time));
+
+            // Time
+            auto& deltas_u64 = m_context.deltas_u64;
+            switch (time_mode) {
+                case TimeMode::DENSE:
+                    dfh::utils::append_vbyte<uint32_t>(buffer, static_cast<uint32_t>(first_slot));
+                    break;
+                case TimeMode::BITMAP:
+                    append_time_bitmap(buffer, m_time_bitmap);
+                    break;
+                default: {
+                    deltas_u64.resize(num_bars);
+                    uint64_t prev_time = base_unix_time;
+                    for (size_t i = 0; i < num_bars; ++i) {
+                        deltas_u64[i] = encode_zig_zag_int64((int64_t)bars[i].time_ms - (int64_t)prev_time);
+                        prev_time = bars[i].time_ms;
+                    }
+                    encode_column(buffer, num_bars);
+                    break;
+                }
+            }
+
+            // Prices
+            const double price_scale = dfh::utils::pow10<double>(m_config.price_digits);
+            const int64_t initial_price = std::llround(bars[0].open * price_scale);
+            dfh::utils::append_vbyte<uint64_t>(buffer, encode_zig_zag_int64(initial_price));
+
+            m_open.resize(num_bars);
+            m_close.resize(num_bars);
+            deltas_u64.resize(num_bars);
+            int64_t prev_close = initial_price;
+            for (size_t i = 0; i < num_bars; ++i) {
+                m_open[i]  = std::llround(bars[i].open * price_scale);
+                m_close[i] = std::llround(bars[i].close * price_scale);
+                deltas_u64[i] = encode_zig_zag_int64(m_open[i] - prev_close);
+                prev_close = m_close[i];
+            }
+            encode_column(buffer, num_bars);
+
+            for (size_t i = 0; i < num_bars; ++i) {
+                deltas_u64[i] = encode_zig_zag_int64(m_close[i] - m_open[i]);
+            }
+            encode_column(buffer, num_bars);
+
+            for (size_t i = 0; i < num_bars; ++i) {
+                const int64_t body_high = std::max(m_open[i], m_close[i]);
+                deltas_u64[i] = encode_zig_zag_int64(std::llround(bars[i].high * price_scale) - body_high);
+            }
+            encode_column(buffer, num_bars);
+
+            for (size_t i = 0; i < num_bars; ++i) {
+                const int64_t body_low = std::min(m_open[i], m_close[i]);
+                deltas_u64[i] = encode_zig_zag_int64(body_low - std::llround(bars[i].low * price_scale));
+            }
+            encode_column(buffer, num_bars);
+
+            // Volumes
+            const double volume_scale = dfh::utils::pow10<double>(m_config.volume_digits);
+            const double quote_volume_scale = dfh::utils::pow10<double>(m_config.quote_volume_digits);
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_VOLUME)) {
+                encode_volume_column(buffer, bars, &MarketBar::volume, volume_scale);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_QUOTE_VOLUME)) {
+                encode_volume_column(buffer, bars, &MarketBar::quote_volume, quote_volume_scale);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_BUY_VOLUME)) {
+                encode_volume_column(buffer, bars, &MarketBar::buy_volume, volume_scale);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_BUY_QUOTE_VOLUME)) {
+                encode_volume_column(buffer, bars, &MarketBar::buy_quote_volume, quote_volume_scale);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_TICK_VOLUME)) {
+                encode_counter_column(buffer, bars, &MarketBar::tick_volume);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_SPREAD)) {
+                encode_counter_column(buffer, bars, &MarketBar::spread);
+            }
+
+            output.clear();
+            compress_zstd_data(
+                m_context.zstd.cctx(),
+                ZSTD_LEVEL,
+                buffer.data(),
+                buffer.size(),
+                SIGNATURE,
+                static_cast<uint32_t>(num_bars),
+                output);
+        }
+
+        /// \brief Decompresses bars, replacing the contents of `bars`.
+        /// \param data Pointer to the compressed data.
+        /// \param size Size of the compressed data.
+        /// \param bars Destination bars.
+        void decompress(
+                const uint8_t* data,
+                size_t size,
+                std::vector<dfh::MarketBar>& bars) {
+            if (size == 0) return;
+            if (data[0] != SIGNATURE) {
+                throw std::invalid_argument("Invalid data signature. Expected BarCompressorV1 data.");
+            }
+
+            size_t offset = 1;
+            const size_t num_bars = dfh::utils::extract_vbyte<uint32_t>(data, offset);
+            if (offset >= size) {
+                throw std::runtime_error("Input buffer is too small for BarCompressorV1 data.");
+            }
+
+            m_context.reset();
+            auto& buffer = m_context.processing_buffer;
+            decompress_zstd_data(
+                m_context.zstd.dctx(),
+                data + offset,
+                size - offset,
+                buffer);
+            const uint8_t* binary = buffer.data();
+            offset = 0;
+
+            uint8_t header = binary[offset++];
+            m_config.flags = BarStorageFlags::NONE;
+            m_config.price_digits = header & 0x1F;
+            m_config.set_flag(BarStorageFlags::BID_BASED, (header & 0x20) != 0);
+            m_config.set_flag(BarStorageFlags::ASK_BASED, (header & 0x40) != 0);
+            m_config.set_flag(BarStorageFlags::LAST_BASED, (header & 0x80) != 0);
+
+            header = binary[offset++];
+            m_config.volume_digits = header & 0x1F;
+            m_config.set_flag(BarStorageFlags::ENABLE_VOLUME, (header & 0x20) != 0);
+            m_config.set_flag(BarStorageFlags::ENABLE_QUOTE_VOLUME, (header & 0x40) != 0);
+            m_config.set_flag(BarStorageFlags::ENABLE_TICK_VOLUME, (header & 0x80) != 0);
+
+            header = binary[offset++];
+            m_config.quote_volume_digits = header & 0x1F;
+            m_config.set_flag(BarStorageFlags::ENABLE_BUY_VOLUME, (header & 0x20) != 0);
+            m_config.set_flag(BarStorageFlags::ENABLE_BUY_QUOTE_VOLUME, (header & 0x40) != 0);
+            m_config.set_flag(BarStorageFlags::ENABLE_SPREAD, (header & 0x80) != 0);
+
+            header = binary[offset++];
+            const TimeMode time_mode = static_cast<TimeMode>(header & 0x03);
+            m_vbyte_columns = (header & 0x04) != 0;
+            m_config.set_flag(BarStorageFlags::SPREAD_LAST, (header & 0x10) != 0);
+            m_config.set_flag(BarStorageFlags::SPREAD_AVG, (header & 0x20) != 0);
+            m_config.set_flag(BarStorageFlags::SPREAD_MAX, (header & 0x40) != 0);
+            m_config.set_flag(BarStorageFlags::FINALIZED_BARS, (header & 0x80) != 0);
+
+            m_config.time_frame = static_cast<dfh::TimeFrame>(dfh::utils::extract_vbyte<uint32_t>(binary, offset));
+
+            const uint64_t duration_ms = dfh::get_segment_duration_ms(m_config.time_frame);
+            const uint64_t bar_ms = dfh::to_ms(m_config.time_frame);
+            const uint64_t base_unix_interval = dfh::utils::extract_vbyte<uint32_t>(binary, offset);
+            const uint64_t base_unix_time     = base_unix_interval * duration_ms;
+            m_config.expiration_time_ms       = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(binary, offset));
+            m_config.next_expiration_time_ms  = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(binary, offset));
+
+            // Columns absent from the segment stay zero, also when the output vector is reused.
+            bars.assign(num_bars, MarketBar{});
+            if (num_bars == 0) return;
+            MarketBar* out = bars.data();
+
+            // Time
+            auto& deltas_u64 = m_context.deltas_u64;
+            switch (time_mode) {
+                case TimeMode::DENSE: {
+                    const uint64_t first_time = base_unix_time + dfh::utils::extract_vbyte<uint32_t>(binary, offset) * bar_ms;
+                    for (size_t i = 0; i < num_bars; ++i) {
+                        out[i].time_ms = first_time + i * bar_ms;
+                    }
+                    break;
+                }
+                case TimeMode::BITMAP:
+                    extract_time_bitmap(binary, offset, static_cast<size_t>(duration_ms / bar_ms), m_time_bitmap);
+                    expand_time_bitmap(m_time_bitmap, base_unix_time, bar_ms, out, num_bars);
+                    break;
+                case TimeMode::EXPLICIT: {
+                    decode_column(binary, offset, num_bars);
+                    uint64_t time_ms = base_unix_time;
+                    for (size_t i = 0; i < num_bars; ++i) {
+                        time_ms += decode_zig_zag_int64(deltas_u64[i]);
+                        out[i].time_ms = time_ms;
+                    }
+                    break;
+                }
+                default:
+                    throw std::runtime_error("Unknown BarCompressorV1 time mode.");
+            }
+
+            // Prices
+            const double inv_price_scale = 1.0 / dfh::utils::pow10<double>(m_config.price_digits);
+            int64_t prev_close = decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(binary, offset));
+
+            m_open.resize(num_bars);
+            m_close.resize(num_bars);
+            decode_column(binary, offset, num_bars);
+            for (size_t i = 0; i < num_bars; ++i) {
+                m_open[i] = static_cast<int64_t>(deltas_u64[i]); // Zig-Zag open deltas, resolved below
+            }
+            decode_column(binary, offset, num_bars);
+            for (size_t i = 0; i < num_bars; ++i) {
+                const int64_t open = prev_close + decode_zig_zag_int64(static_cast<uint64_t>(m_open[i]));
+                const int64_t close = open + decode_zig_zag_int64(deltas_u64[i]);
+                m_open[i]  = open;
+                m_close[i] = close;
+                out[i].open  = static_cast<double>(open) * inv_price_scale;
+                out[i].close = static_cast<double>(close) * inv_price_scale;
+                prev_close = close;
+            }
+
+            decode_column(binary, offset, num_bars);
+            for (size_t i = 0; i < num_bars; ++i) {
+                const int64_t high = std::max(m_open[i], m_close[i]) + decode_zig_zag_int64(deltas_u64[i]);
+                out[i].high = static_cast<double>(high) * inv_price_scale;
+            }
+            decode_column(binary, offset, num_bars);
+            for (size_t i = 0; i < num_bars; ++i) {
+                const int64_t low = std::min(m_open[i], m_close[i]) - decode_zig_zag_int64(deltas_u64[i]);
+                out[i].low = static_cast<double>(low) * inv_price_scale;
+            }
+
+            // Volumes
+            const double inv_volume_scale = 1.0 / dfh::utils::pow10<double>(m_config.volume_digits);
+            const double inv_quote_volume_scale = 1.0 / dfh::utils::pow10<double>(m_config.quote_volume_digits);
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_VOLUME)) {
+                decode_volume_column(binary, offset, out, num_bars, &MarketBar::volume, inv_volume_scale);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_QUOTE_VOLUME)) {
+                decode_volume_column(binary, offset, out, num_bars, &MarketBar::quote_volume, inv_quote_volume_scale);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_BUY_VOLUME)) {
+                decode_volume_column(binary, offset, out, num_bars, &MarketBar::buy_volume, inv_volume_scale);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_BUY_QUOTE_VOLUME)) {
+                decode_volume_column(binary, offset, out, num_bars, &MarketBar::buy_quote_volume, inv_quote_volume_scale);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_TICK_VOLUME)) {
+                decode_counter_column(binary, offset, out, num_bars, &MarketBar::tick_volume);
+            }
+            if (m_config.has_flag(dfh::BarStorageFlags::ENABLE_SPREAD)) {
+                decode_counter_column(binary, offset, out, num_bars, &MarketBar::spread);
+            }
+        }
+
+        /// \brief Encodes the values stored in `deltas_u64`.
+        /// \param buffer Buffer to append to.
+        /// \param num_bars Number of values.
+        void encode_column(std::vector<uint8_t>& buffer, size_t num_bars) {
+            if (m_vbyte_columns) {
+                dfh::utils::append_vbyte<uint64_t>(buffer, m_context.deltas_u64.data(), num_bars);
+                return;
+            }
+            m_encoder.encode_zig_zag_column(buffer, num_bars);
+        }
+
+        /// \brief Decodes a column written by encode_column() into `deltas_u64`.
+        /// \param binary Buffer holding the column.
+        /// \param offset Current offset in the buffer, advanced past the column.
+        /// \param num_bars Number of values.
+        void decode_column(const uint8_t* binary, size_t& offset, size_t num_bars) {
+            if (m_vbyte_columns) {
+                m_context.deltas_u64.resize(num_bars);
+                dfh::utils::extract_vbyte(binary, offset, m_context.deltas_u64.data(), num_bars);
+                return;
+            }
+            m_decoder.decode_zig_zag_column(binary, offset, num_bars);
+        }
+
+        /// \brief Encodes a volume field as fixed-point integers.
+        /// \param buffer Buffer to append to.
+        /// \param bars Source bars.
+        /// \param field Volume field of MarketBar.
+        /// \param scale Fixed-point scale (10^digits).
+        /// \throws std::invalid_argument If a volume is negative.
+        void encode_volume_column(
+                std::vector<uint8_t>& buffer,
+                const std::vector<dfh::MarketBar>& bars,
+                double MarketBar::* field,
+                double scale) {
+            auto& deltas_u64 = m_context.deltas_u64;
+            deltas_u64.resize(bars.size());
+            for (size_t i = 0; i < bars.size(); ++i) {
+                const int64_t value = std::llround(bars[i].*field * scale);
+                if (value < 0) {
+                    throw std::invalid_argument("BarCompressorV1 does not support negative volumes.");
+                }
+                deltas_u64[i] = static_cast<uint64_t>(value);
+            }
+            encode_column(buffer, bars.size());
+        }
+
+        /// \brief Encodes an integer counter field (tick volume or spread).
+        void encode_counter_column(
+                std::vector<uint8_t>& buffer,
+                const std::vector<dfh::MarketBar>& bars,
+                uint32_t MarketBar::* field) {
+            auto& deltas_u64 = m_context.deltas_u64;
+            deltas_u64.resize(bars.size());
+            for (size_t i = 0; i < bars.size(); ++i) {
+                deltas_u64[i] = bars[i].*field;
+            }
+            encode_column(buffer, bars.size());
+        }
+
+        /// \brief Decodes a volume field written by encode_volume_column().
+        void decode_volume_column(
+                const uint8_t* binary,
+                size_t& offset,
+                MarketBar* bars,
+                size_t num_bars,
+                double MarketBar::* field,
+                double inv_scale) {
+            const auto& deltas_u64 = m_context.deltas_u64;
+            decode_column(binary, offset, num_bars);
+            for (size_t i = 0; i < num_bars; ++i) {
+                bars[i].*field = static_cast<double>(deltas_u64[i]) * inv_scale;
+            }
+        }
+
+        /// \brief Decodes an integer counter field written by encode_counter_column().
+        void decode_counter_column(
+                const uint8_t* binary,
+                size_t& offset,
+                MarketBar* bars,
+                size_t num_bars,
+                uint32_t MarketBar::* field) {
+            const auto& deltas_u64 = m_context.deltas_u64;
+            decode_column(binary, offset, num_bars);
+            for (size_t i = 0; i < num_bars; ++i) {
+                bars[i].*field = static_cast<uint32_t>(deltas_u64[i]);
+            }
+        }
+    };
+
+} // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_BAR_COMPRESSOR_V1_HPP_INCLUDED
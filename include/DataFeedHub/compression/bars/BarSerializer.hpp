@@ -10,8 +10,10 @@ namespace dfh::compression {
     /// \class BarSerializer
     /// \brief Automatically selects and applies the appropriate serializer.
     ///
-    /// This class chooses the correct serializer (`BarBinarySerializerV1` or another)
-    /// based on the flags set in `BarCodecConfig`. It provides a unified interface for serialization.
+    /// This class chooses the correct serializer based on the flags set in `BarCodecConfig`:
+    /// - `STORE_RAW_BINARY` selects `BarBinarySerializerV1`;
+    /// - otherwise bars are compressed by `BarCompressorV1`.
+    /// On deserialization the serializer is chosen by the signature byte.
     class BarSerializer final : public IBarSerializer {
     public:
 
@@ -36,8 +38,8 @@ namespace dfh::compression {
         /// \param input Binary input buffer.
         /// \return True if the format is recognized, otherwise false.
         bool is_valid_signature(const std::vector<uint8_t>& input) const override final {
-            return m_bar_binary_v1.is_valid_signature(input);
-            // || m_bar_compressor_v1.is_valid_signature(input);
+            return m_bar_binary_v1.is_valid_signature(input)
+                || m_bar_compressor_v1.is_valid_signature(input);
         }
 
         /// \brief Serializes bar data into binary format.
@@ -88,19 +90,46 @@ namespace dfh::compression {
             m_serializer->deserialize(input, bars, config);
         }
 
+        /// \brief Deserializes bar data in place, e.g. straight from a memory-mapped database page.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param bars Output vector for deserialized MarketBar data.
+        /// \throws std::runtime_error If the format is unrecognized or no serializer is found.
+        void deserialize(
+            const uint8_t* data,
+            size_t size,
+            std::vector<dfh::MarketBar>& bars) override final {
+            select_serializer(data, size);
+            m_serializer->deserialize(data, size, bars);
+        }
+
+        /// \brief Deserializes bar data in place and restores configuration.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param bars Output vector for deserialized MarketBar data.
+        /// \param config Output configuration extracted from the data header.
+        /// \throws std::runtime_error If the format is unrecognized or no serializer is found.
+        void deserialize(
+            const uint8_t* data,
+            size_t size,
+            std::vector<dfh::MarketBar>& bars,
+            dfh::BarCodecConfig& config) override final {
+            select_serializer(data, size);
+            m_serializer->deserialize(data, size, bars, config);
+        }
+
     private:
         BarBinarySerializerV1 m_bar_binary_v1;
-        // BarCompressorV1       m_bar_compressor_v1;
+        BarCompressorV1       m_bar_compressor_v1;
         IBarSerializer*        m_serializer = nullptr;
 
         /// \brief Selects serializer based on codec config.
         /// \param config Configuration used for selecting the serializer.
-        /// \throws std::runtime_error If no suitable serializer is found.
         void select_serializer(const dfh::BarCodecConfig& config) {
             if (config.has_flag(dfh::BarStorageFlags::STORE_RAW_BINARY)) {
                 m_serializer = &m_bar_binary_v1;
             } else {
-                throw std::runtime_error("Invalid BarCodecConfig: No suitable serializer selected.");
+                m_serializer = &m_bar_compressor_v1;
             }
         }
 
@@ -108,9 +137,19 @@ namespace dfh::compression {
         /// \param input Binary input buffer.
         /// \throws std::runtime_error If no matching serializer signature is found.
         void select_serializer(const std::vector<uint8_t>& input) {
-            if (m_bar_binary_v1.is_valid_signature(input)) {
-                m_serializer = &m_bar_binary_v1;
-            } else {
+            select_serializer(input.data(), input.size());
+        }
+
+        /// \brief Selects serializer based on the signature byte of a serialized segment.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \throws std::runtime_error If no matching serializer signature is found.
+        void select_serializer(const uint8_t* data, size_t size) {
+            if (size == 0) throw std::runtime_error("Invalid data: Unknown bar serialization format.");
+            switch (data[0]) {
+            case 0x00: m_serializer = &m_bar_binary_v1; break;
+            case 0x01: m_serializer = &m_bar_compressor_v1; break;
+            default:
                 throw std::runtime_error("Invalid data: Unknown bar serialization format.");
             }
         }
@@ -57,6 +57,28 @@ namespace dfh::compression {
             const std::vector<uint8_t>& input,
             std::vector<dfh::MarketBar>& bars,
             dfh::BarCodecConfig& config) = 0;
+
+        /// \brief Deserializes bar data from a memory region.
+        /// \details Same as deserialize(const std::vector<uint8_t>&, std::vector<MarketBar>&), but the
+        /// segment is read in place, e.g. straight from a memory-mapped database page.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param bars A vector where the deserialized bar data will be stored.
+        virtual void deserialize(
+            const uint8_t* data,
+            size_t size,
+            std::vector<dfh::MarketBar>& bars) = 0;
+
+        /// \brief Deserializes bar data from a memory region and retrieves the configuration.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param bars A vector where the deserialized bar data will be stored.
+        /// \param config A reference to store the retrieved configuration.
+        virtual void deserialize(
+            const uint8_t* data,
+            size_t size,
+            std::vector<dfh::MarketBar>& bars,
+            dfh::BarCodecConfig& config) = 0;
     };
 
 } // namespace dfh::compression
@@ -7,7 +7,13 @@
 
 #include "ticks/ITickSerializer.hpp"
 #include "ticks/TickCompressorV1.hpp"
+#include "ticks/TickCompressorV2.hpp"
 #include "ticks/TickBinarySerializerV1.hpp"
+#include "ticks/TickBlockIndex.hpp"
 #include "ticks/TickSerializer.hpp"
+#include "ticks/TickWorkerPool.hpp"
+#include "ticks/TickBatchSerializer.hpp"
+#include "ticks/TickBatchDeserializer.hpp"
+#include "ticks/TickDictionaryTrainer.hpp"
 
 #endif // _DFH_COMPRESSION_TICKS_HPP_INCLUDED
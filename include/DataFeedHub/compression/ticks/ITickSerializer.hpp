@@ -57,6 +57,60 @@ namespace dfh::compression {
             const std::vector<uint8_t>& input,
             std::vector<dfh::MarketTick>& ticks,
             dfh::TickCodecConfig& config) = 0;
+
+        /// \brief Deserializes tick data from a memory region.
+        /// \details Same as deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&), but the
+        /// segment is read in place, e.g. straight from a memory-mapped database page.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param ticks A vector where the deserialized tick data will be stored.
+        virtual void deserialize(
+            const uint8_t* data,
+            size_t size,
+            std::vector<dfh::MarketTick>& ticks) = 0;
+
+        /// \brief Deserializes tick data from a memory region and retrieves the configuration.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param ticks A vector where the deserialized tick data will be stored.
+        /// \param config A reference to store the retrieved configuration.
+        virtual void deserialize(
+            const uint8_t* data,
+            size_t size,
+            std::vector<dfh::MarketTick>& ticks,
+            dfh::TickCodecConfig& config) = 0;
+
+        /// \brief Deserializes only the requested tick fields.
+        /// \details Formats that store section sizes skip the sections of other fields; the
+        /// default implementation decodes everything. Callers must not rely on the values of
+        /// fields outside the mask.
+        /// \param input A vector of binary data.
+        /// \param ticks A vector where the deserialized tick data will be stored.
+        /// \param fields Mask of the fields to decode.
+        virtual void deserialize(
+                const std::vector<uint8_t>& input,
+                std::vector<dfh::MarketTick>& ticks,
+                dfh::TickField fields) {
+            (void)fields;
+            deserialize(input, ticks);
+        }
+
+        /// \brief Decodes a segment into a caller-provided tick array.
+        /// \details Scratch memory lives in the serializer and keeps its capacity between calls,
+        /// so decoding segments no larger than those decoded before performs no heap allocations.
+        /// The required capacity is the number of samples in the segment header (see
+        /// extract_num_samples()).
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param ticks Destination array.
+        /// \param capacity Number of ticks `ticks` can hold.
+        /// \return Number of decoded ticks.
+        /// \throws std::length_error If `capacity` is smaller than the number of ticks in the segment.
+        virtual size_t decode_into(
+                const uint8_t* data,
+                size_t size,
+                dfh::MarketTick* ticks,
+                size_t capacity) = 0;
     };
 
 } // namespace dfh::compression
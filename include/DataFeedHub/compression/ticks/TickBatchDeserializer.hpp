@@ -0,0 +1,213 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_TICK_BATCH_DESERIALIZER_HPP_INCLUDED
+#define _DFH_COMPRESSION_TICK_BATCH_DESERIALIZER_HPP_INCLUDED
+
+/// \file TickBatchDeserializer.hpp
+/// \brief Decodes many tick segments in parallel into one contiguous tick vector.
+
+namespace dfh::compression {
+
+    /// \struct TickSegmentRef
+    /// \brief Non-owning reference to a serialized tick segment (e.g. a value inside an MDBX page).
+    struct TickSegmentRef {
+        const uint8_t* data; ///< Pointer to the segment.
+        size_t         size; ///< Size of the segment in bytes.
+    };
+
+    /// \class TickBatchDeserializer
+    /// \brief Decodes a batch of tick segments on worker threads.
+    ///
+    /// The counterpart of TickBatchSerializer for long range reads. The number of ticks of every
+    /// segment is read from its header (extract_num_samples()), so the output vector is resized
+    /// once and each worker decodes its segments straight into their final slices with
+    /// TickSerializer::decode_into(); no per-segment buffers and no concatenation copies are needed.
+    /// Decoding runs on the persistent workers of a TickWorkerPool, which may be shared with a
+    /// TickBatchSerializer; each worker owns a `TickSerializer` and with it its own compression
+    /// and ZSTD contexts.
+    ///
+    /// \thread_safety Calls are serialized by the pool (see TickWorkerPool::acquire()).
+    class TickBatchDeserializer {
+    public:
+        /// \brief Constructs the deserializer with its own worker pool.
+        /// \param num_threads Number of worker threads; 1 decodes on the calling thread, 0 uses the number of CPU cores.
+        explicit TickBatchDeserializer(size_t num_threads = 1)
+            : m_pool(std::make_shared<TickWorkerPool>(num_threads)) {}
+
+        /// \brief Constructs the deserializer on a shared worker pool.
+        /// \param pool Pool of worker threads, e.g. shared with a TickBatchSerializer.
+        /// \throws std::invalid_argument If `pool` is null.
+        explicit TickBatchDeserializer(std::shared_ptr<TickWorkerPool> pool)
+            : m_pool(std::move(pool)) {
+            if (!m_pool) throw std::invalid_argument("TickBatchDeserializer: worker pool is null.");
+        }
+
+        /// \brief Returns the number of worker threads.
+        size_t num_threads() const noexcept {
+            return m_pool->num_threads();
+        }
+
+        /// \brief Decodes the segments and appends their ticks in segment order.
+        /// \param segments Segments in time order; the referenced memory must stay valid during the call.
+        /// \param ticks Vector where the ticks will be appended.
+        /// \param config Receives the configuration of the last segment.
+        /// \throws Rethrows the first exception of a worker; `ticks` is then restored to its initial size.
+        void deserialize(
+                const std::vector<TickSegmentRef>& segments,
+                std::vector<MarketTick>& ticks,
+                TickCodecConfig& config) {
+            deserialize_range(segments, 0, std::numeric_limits<uint64_t>::max(), ticks, config);
+        }
+
+        /// \brief Decodes the segments and appends their ticks within `[start_ts, end_ts)`.
+        ///
+        /// Segments are decoded on the calling thread until one reaches into the range; its
+        /// in-range ticks are moved to the front of its slice, which fixes the offsets of all
+        /// following slices. These are decoded in parallel, and ticks at or after `end_ts` are
+        /// cut from the tail. Only one segment may straddle `start_ts`, which holds for hourly
+        /// segments of one symbol.
+        /// \param segments Non-overlapping segments in time order; the referenced memory must stay valid during the call.
+        /// \param start_ts Start of the range (inclusive).
+        /// \param end_ts End of the range (exclusive).
+        /// \param ticks Vector where the ticks will be appended.
+        /// \param config Receives the configuration of the last decoded segment.
+        /// \throws std::runtime_error If a segment decodes to another number of ticks than its header states.
+        /// \throws Rethrows the first exception of a worker; `ticks` is then restored to its initial size.
+        void deserialize_range(
+                const std::vector<TickSegmentRef>& segments,
+                uint64_t start_ts,
+                uint64_t end_ts,
+                std::vector<MarketTick>& ticks,
+                TickCodecConfig& config) {
+            auto lease = m_pool->acquire();
+            const size_t initial_size = ticks.size();
+            auto by_time = [](const MarketTick& tick, uint64_t timestamp) {
+                return tick.time_ms < timestamp;
+            };
+            try {
+                // Leading segments are decoded one by one until one reaches into the range;
+                // its in-range ticks fix the start of all following slices.
+                TickSerializer& head = m_pool->serializer(0);
+                size_t first = 0;
+                for (; first < segments.size(); ++first) {
+                    const TickSegmentRef& segment = segments[first];
+                    if (segment.size == 0) continue;
+                    const size_t num_ticks = extract_num_samples(segment.data, segment.size);
+                    ticks.resize(initial_size + num_ticks);
+                    decode_segment(head, segment, ticks.data() + initial_size, num_ticks);
+                    config = segment_config(head, segment);
+
+                    const auto head_begin = ticks.begin() + initial_size;
+                    const auto in_begin = std::lower_bound(head_begin, ticks.end(), start_ts, by_time);
+                    const auto in_end   = std::lower_bound(in_begin, ticks.end(), end_ts, by_time);
+                    const bool reached_end = in_end != ticks.end();
+                    if (in_begin != head_begin) std::move(in_begin, in_end, head_begin);
+                    ticks.resize(initial_size + (in_end - in_begin));
+                    if (reached_end) return;
+                    if (ticks.size() != initial_size) break;
+                }
+                if (first >= segments.size()) return;
+
+                m_offsets.clear();
+                size_t total = ticks.size();
+                for (size_t i = first + 1; i < segments.size(); ++i) {
+                    m_offsets.push_back(total);
+                    if (segments[i].size) total += extract_num_samples(segments[i].data, segments[i].size);
+                }
+                if (m_offsets.empty()) return;
+                const size_t body_begin = ticks.size();
+                ticks.resize(total);
+
+                const size_t last_worker = decode_parallel(segments, first + 1, ticks);
+                if (last_worker != SIZE_MAX) config = segment_config(m_pool->serializer(last_worker), segments[m_last_segment]);
+
+                const auto it_end = std::lower_bound(ticks.begin() + body_begin, ticks.end(), end_ts, by_time);
+                ticks.erase(it_end, ticks.end());
+            } catch (...) {
+                ticks.resize(initial_size);
+                throw;
+            }
+        }
+
+    private:
+        std::shared_ptr<TickWorkerPool> m_pool;             ///< Worker threads with one serializer each.
+        std::vector<size_t>             m_offsets;          ///< Output offset of every segment after the first, reused across calls.
+        size_t                          m_last_segment = 0; ///< Index of the last non-empty segment of decode_parallel().
+
+        /// \brief Returns the configuration of the segment last decoded by `serializer`.
+        static TickCodecConfig segment_config(const TickSerializer& serializer, const TickSegmentRef& segment) {
+            TickCodecConfig config = serializer.codec_config();
+            if (segment.data[0] == TickBlockIndex::SIGNATURE) config.set_flag(TickStorageFlags::BLOCK_INDEX);
+            return config;
+        }
+
+        /// \brief Decodes one segment into its slice and checks the tick count against the header.
+        static void decode_segment(
+                TickSerializer& serializer,
+                const TickSegmentRef& segment,
+                MarketTick* output,
+                size_t num_ticks) {
+            if (segment.size == 0) return;
+            if (serializer.decode_into(segment.data, segment.size, output, num_ticks) != num_ticks) {
+                throw std::runtime_error("Corrupted tick segment: tick count does not match the header.");
+            }
+        }
+
+        /// \brief Decodes `segments[first..]` into the slices at `m_offsets`.
+        /// \return Index of the worker that decoded the last non-empty segment; SIZE_MAX if all were empty.
+        size_t decode_parallel(
+                const std::vector<TickSegmentRef>& segments,
+                size_t first,
+                std::vector<MarketTick>& ticks) {
+            const size_t num_segments = segments.size() - first;
+            size_t last_nonempty = SIZE_MAX;
+            for (size_t i = 0; i < num_segments; ++i) {
+                if (segments[first + i].size) last_nonempty = i;
+            }
+            if (last_nonempty == SIZE_MAX) return SIZE_MAX;
+            m_last_segment = first + last_nonempty;
+
+            auto slice_size = [&](size_t i) {
+                const size_t end = i + 1 < num_segments ? m_offsets[i + 1] : ticks.size();
+                return end - m_offsets[i];
+            };
+
+            const size_t num_threads = std::min(m_pool->num_threads(), num_segments);
+            if (num_threads <= 1) {
+                for (size_t i = 0; i < num_segments; ++i) {
+                    decode_segment(m_pool->serializer(0), segments[first + i], ticks.data() + m_offsets[i], slice_size(i));
+                }
+                return 0;
+            }
+
+            std::atomic<size_t> next_segment{0};
+            std::atomic<bool> stop{false};
+            std::exception_ptr error;
+            std::mutex mutex;
+            size_t last_worker = SIZE_MAX;
+
+            m_pool->dispatch([&](size_t worker) {
+                if (worker >= num_threads) return;
+                TickSerializer& serializer = m_pool->serializer(worker);
+                for (;;) {
+                    const size_t i = next_segment.fetch_add(1, std::memory_order_relaxed);
+                    if (i >= num_segments || stop.load(std::memory_order_relaxed)) break;
+                    try {
+                        decode_segment(serializer, segments[first + i], ticks.data() + m_offsets[i], slice_size(i));
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error) error = std::current_exception();
+                        stop = true;
+                        break;
+                    }
+                    if (i == last_nonempty) last_worker = worker;
+                }
+            });
+            m_pool->wait();
+            if (error) std::rethrow_exception(error);
+            return last_worker;
+        }
+    };
+
+} // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_TICK_BATCH_DESERIALIZER_HPP_INCLUDED
@@ -0,0 +1,164 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_TICK_BATCH_SERIALIZER_HPP_INCLUDED
+#define _DFH_COMPRESSION_TICK_BATCH_SERIALIZER_HPP_INCLUDED
+
+/// \file TickBatchSerializer.hpp
+/// \brief Serializes many tick segments in parallel and hands them out in order.
+
+namespace dfh::compression {
+
+    /// \class TickBatchSerializer
+    /// \brief Compresses a batch of tick segments on worker threads.
+    ///
+    /// Segments are compressed by the persistent workers of a TickWorkerPool, each with its own
+    /// `TickSerializer` and with it its own compression and ZSTD contexts, so workers never share
+    /// scratch state and no threads are started per batch. Segments are claimed dynamically, which
+    /// balances hours of very different sizes. Results are delivered to a callback on the calling
+    /// thread in segment order while later segments are still being compressed; the callback can
+    /// therefore write into a storage transaction that is bound to the calling thread.
+    ///
+    /// \thread_safety Calls are serialized by the pool (see TickWorkerPool::acquire()).
+    class TickBatchSerializer {
+    public:
+        /// \brief Callback receiving the serialized segment with the given index.
+        using SegmentHandler = std::function<void(size_t index, const std::vector<uint8_t>& output)>;
+
+        /// \brief Constructs the serializer with its own worker pool.
+        /// \param num_threads Number of worker threads; 1 compresses on the calling thread, 0 uses the number of CPU cores.
+        explicit TickBatchSerializer(size_t num_threads = 1)
+            : m_pool(std::make_shared<TickWorkerPool>(num_threads)) {}
+
+        /// \brief Constructs the serializer on a shared worker pool.
+        /// \param pool Pool of worker threads, e.g. shared with a TickBatchDeserializer.
+        /// \throws std::invalid_argument If `pool` is null.
+        explicit TickBatchSerializer(std::shared_ptr<TickWorkerPool> pool)
+            : m_pool(std::move(pool)) {
+            if (!m_pool) throw std::invalid_argument("TickBatchSerializer: worker pool is null.");
+        }
+
+        /// \brief Returns the number of worker threads.
+        size_t num_threads() const noexcept {
+            return m_pool->num_threads();
+        }
+
+        /// \brief Selects the ZSTD dictionary used by all workers (see TickSerializer::set_dictionary_id()).
+        void set_dictionary_id(uint32_t dictionary_id) {
+            auto lease = m_pool->acquire();
+            for (size_t i = 0; i < m_pool->num_threads(); ++i) m_pool->serializer(i).set_dictionary_id(dictionary_id);
+        }
+
+        /// \brief Sets the `BLOCK_INDEX` layout of all workers (see TickSerializer::set_block_layout()).
+        void set_block_layout(uint64_t block_ms, uint32_t max_block_ticks) {
+            auto lease = m_pool->acquire();
+            for (size_t i = 0; i < m_pool->num_threads(); ++i) m_pool->serializer(i).set_block_layout(block_ms, max_block_ticks);
+        }
+
+        /// \brief Returns the `AUTO_CODEC` selection counters summed over all workers.
+        TickCodecStats auto_stats() const {
+            auto lease = m_pool->acquire();
+            TickCodecStats stats;
+            for (size_t i = 0; i < m_pool->num_threads(); ++i) stats += m_pool->serializer(i).auto_stats();
+            return stats;
+        }
+
+        /// \brief Resets the `AUTO_CODEC` selection counters of all workers.
+        void reset_auto_stats() {
+            auto lease = m_pool->acquire();
+            for (size_t i = 0; i < m_pool->num_threads(); ++i) m_pool->serializer(i).reset_auto_stats();
+        }
+
+        /// \brief Serializes the segments and passes each result to the handler in segment order.
+        /// \param segments Tick segments (typically hourly) to serialize.
+        /// \param config The serialization configuration, shared by all segments.
+        /// \param handler Called on the calling thread for segments 0, 1, 2, ...
+        /// \throws Rethrows the first exception of a worker or of the handler; remaining segments are skipped.
+        void serialize(
+                const std::vector<std::vector<MarketTick>>& segments,
+                const TickCodecConfig& config,
+                const SegmentHandler& handler) {
+            auto lease = m_pool->acquire();
+            const size_t num_segments = segments.size();
+            const size_t num_threads  = std::min(m_pool->num_threads(), num_segments);
+            if (num_threads <= 1) {
+                TickSerializer& serializer = m_pool->serializer(0);
+                for (size_t i = 0; i < num_segments; ++i) {
+                    m_output.clear();
+                    serializer.serialize(segments[i], config, m_output);
+                    handler(i, m_output);
+                }
+                return;
+            }
+
+            m_outputs.resize(num_segments);
+            std::vector<uint8_t> ready(num_segments, 0);
+            std::atomic<size_t> next_segment{0};
+            std::atomic<bool> stop{false};
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable cv;
+
+            m_pool->dispatch([&](size_t worker) {
+                if (worker >= num_threads) return;
+                TickSerializer& serializer = m_pool->serializer(worker);
+                for (;;) {
+                    const size_t i = next_segment.fetch_add(1, std::memory_order_relaxed);
+                    if (i >= num_segments || stop.load(std::memory_order_relaxed)) break;
+                    try {
+                        m_outputs[i].clear();
+                        serializer.serialize(segments[i], config, m_outputs[i]);
+                    } catch (...) {
+                        std::lock_guard<std::mutex> lock(mutex);
+                        if (!error) error = std::current_exception();
+                        stop = true;
+                        cv.notify_one();
+                        break;
+                    }
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ready[i] = 1;
+                    cv.notify_one();
+                }
+            });
+
+            for (size_t i = 0; i < num_segments; ++i) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                    cv.wait(lock, [&] { return ready[i] || error; });
+                    if (error) break;
+                }
+                try {
+                    handler(i, m_outputs[i]);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    error = std::current_exception();
+                    stop = true;
+                    break;
+                }
+            }
+
+            m_pool->wait();
+            if (error) std::rethrow_exception(error);
+        }
+
+        /// \brief Serializes the segments into a vector of buffers.
+        /// \param segments Tick segments to serialize.
+        /// \param config The serialization configuration, shared by all segments.
+        /// \param outputs Receives one buffer per segment, in segment order.
+        void serialize(
+                const std::vector<std::vector<MarketTick>>& segments,
+                const TickCodecConfig& config,
+                std::vector<std::vector<uint8_t>>& outputs) {
+            outputs.resize(segments.size());
+            serialize(segments, config, [&outputs](size_t index, const std::vector<uint8_t>& output) {
+                outputs[index] = output;
+            });
+        }
+
+    private:
+        std::shared_ptr<TickWorkerPool>   m_pool;    ///< Worker threads with one serializer each.
+        std::vector<std::vector<uint8_t>> m_outputs; ///< Per-segment output buffers, reused across batches.
+        std::vector<uint8_t>              m_output;  ///< Output buffer of the single-thread path.
+    };
+
+} // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_TICK_BATCH_SERIALIZER_HPP_INCLUDED
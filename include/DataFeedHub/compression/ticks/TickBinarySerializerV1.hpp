@@ -98,66 +98,120 @@ namespace dfh::compression {
             serialize(ticks, output);
         }
 
+        using ITickSerializer::deserialize;
+
         /// \copydoc ITickSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&)
         /// \throws std::invalid_argument If the binary signature is invalid.
         /// \throws std::runtime_error If the binary buffer is too small for the expected number of ticks.
         void deserialize(
             const std::vector<uint8_t>& input,
             std::vector<MarketTick>& ticks) override final {
+            deserialize(input.data(), input.size(), ticks);
+        }
+
+        /// \copydoc ITickSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&, TickCodecConfig&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If the binary buffer is too small for the expected number of ticks.
+        void deserialize(
+            const std::vector<uint8_t>& input,
+            std::vector<MarketTick>& ticks,
+            TickCodecConfig& config) override final {
+
+            deserialize(input, ticks);
+            config = m_config;
+        }
+
+        /// \copydoc ITickSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketTick>&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If the binary buffer is too small for the expected number of ticks.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<MarketTick>& ticks) override final {
+            if (size == 0) return;
+            size_t offset = 0;
+            const size_t num_ticks = read_header(data, size, offset);
+            const size_t initial_size = ticks.size();
+            ticks.resize(initial_size + num_ticks);
+            std::memcpy(ticks.data() + initial_size, data + offset, num_ticks * sizeof(MarketTick));
+        }
+
+        /// \copydoc ITickSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketTick>&, TickCodecConfig&)
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If the binary buffer is too small for the expected number of ticks.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<MarketTick>& ticks,
+                TickCodecConfig& config) override final {
+            deserialize(data, size, ticks);
+            config = m_config;
+        }
 
-            if (input.empty()) return;
+        /// \copydoc ITickSerializer::decode_into()
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If the binary buffer is too small for the expected number of ticks.
+        size_t decode_into(
+                const uint8_t* data,
+                size_t size,
+                MarketTick* ticks,
+                size_t capacity) override final {
+            if (size == 0) return 0;
             size_t offset = 0;
+            const size_t num_ticks = read_header(data, size, offset);
+            if (num_ticks > capacity) {
+                throw std::length_error("Tick buffer is too small for the segment.");
+            }
+            std::memcpy(ticks, data + offset, num_ticks * sizeof(MarketTick));
+            return num_ticks;
+        }
+
+    private:
+        TickCodecConfig m_config; ///< Configuration used for encoding and decoding.
+
+        /// \brief Parses the segment header into the configuration.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param offset Offset of the segment; moved to the first tick record.
+        /// \return Number of ticks in the segment.
+        /// \throws std::invalid_argument If the binary signature is invalid.
+        /// \throws std::runtime_error If the buffer is too small for the number of ticks.
+        size_t read_header(const uint8_t* data, size_t size, size_t& offset) {
             constexpr uint8_t signature = 0x00;
-            if (input[offset++] != signature) {
+            if (data[offset++] != signature) {
                 throw std::invalid_argument(
                     "Invalid data signature. The input data does not match the expected format. "
                     "Ensure that the data was compressed using the correct version of the compressor."
                 );
             }
 
-            const size_t num_ticks = dfh::utils::extract_vbyte<uint32_t>(input.data(), offset);
+            const size_t num_ticks = dfh::utils::extract_vbyte<uint32_t>(data, offset);
 
-            uint8_t header = input[offset++];
+            uint8_t header = data[offset++];
             m_config.flags = TickStorageFlags::NONE;
             m_config.price_digits = header & 0x1F;
             m_config.set_flag(TickStorageFlags::ENABLE_TICK_FLAGS, (header & 0x20) != 0);
             m_config.set_flag(TickStorageFlags::TRADE_BASED, (header & 0x40) != 0);
             m_config.set_flag(TickStorageFlags::ENABLE_VOLUME, (header & 0x80) != 0);
 
-            header = input[offset++];
+            header = data[offset++];
             m_config.volume_digits  = header & 0x1F;
             m_config.set_flag(TickStorageFlags::STORE_RAW_BINARY, true);
 
             constexpr uint64_t interval_ms = 3600000ULL;
-            const uint64_t base_unix_hour    = dfh::utils::extract_vbyte<uint32_t>(input.data(), offset);
+            const uint64_t base_unix_hour    = dfh::utils::extract_vbyte<uint32_t>(data, offset);
             const uint64_t base_unix_time    = base_unix_hour * interval_ms;
-            m_config.expiration_time_ms      = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(input.data(), offset));
-            m_config.next_expiration_time_ms = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(input.data(), offset));
+            m_config.expiration_time_ms      = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(data, offset));
+            m_config.next_expiration_time_ms = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(data, offset));
 
             const size_t expected_size = num_ticks * sizeof(MarketTick);
-            if ((offset + expected_size) > input.size()) {
+            if ((offset + expected_size) > size) {
                 throw std::runtime_error("Input buffer is too small for expected tick data.");
             }
+            return num_ticks;
 
-            ticks.resize(num_ticks);
-            std::memcpy(ticks.data(), input.data() + offset, num_ticks * sizeof(MarketTick));
         }
 
-        /// \copydoc ITickSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&, TickCodecConfig&)
-        /// \throws std::invalid_argument If the binary signature is invalid.
-        /// \throws std::runtime_error If the binary buffer is too small for the expected number of ticks.
-        void deserialize(
-            const std::vector<uint8_t>& input,
-            std::vector<MarketTick>& ticks,
-            TickCodecConfig& config) override final {
-
-            deserialize(input, ticks);
-            config = m_config;
-        }
-
-    private:
-        TickCodecConfig m_config; ///< Configuration used for encoding and decoding.
-
         /// \brief Appends a MarketTick structure to the binary output buffer.
         /// \param buffer Binary buffer to append to.
         /// \param tick Tick data to append in raw memory form.
@@ -0,0 +1,144 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_TICK_BLOCK_INDEX_HPP_INCLUDED
+#define _DFH_COMPRESSION_TICK_BLOCK_INDEX_HPP_INCLUDED
+
+/// \file TickBlockIndex.hpp
+/// \brief Header of seekable tick segments split into independently decodable blocks.
+
+namespace dfh::compression {
+
+    /// \struct TickBlockInfo
+    /// \brief Describes one block of a seekable tick segment.
+    struct TickBlockInfo {
+        uint64_t first_time_ms; ///< Time of the first tick in the block.
+        uint32_t num_ticks;     ///< Number of ticks in the block.
+        size_t   offset;        ///< Offset of the block within the segment (after parse()) or the payload (while writing).
+        size_t   size;          ///< Size of the block in bytes.
+    };
+
+    /// \class TickBlockIndex
+    /// \brief Reads and writes the block index of seekable tick segments.
+    ///
+    /// A seekable segment stores its ticks as consecutive blocks, each a complete segment of
+    /// `TickCompressorV1`, `TickCompressorV2` or `TickBinarySerializerV1`, behind a small
+    /// time-to-offset index:
+    /// \code
+    /// [0x03][vbyte num_ticks][vbyte base_unix_hour][vbyte num_blocks]
+    /// num_blocks x [vbyte first_time_ms delta][vbyte num_ticks][vbyte size]
+    /// block 0, block 1, ...
+    /// \endcode
+    /// The first delta is relative to the start of `base_unix_hour`, the following ones to the
+    /// first tick of the previous block. Ticks of block `i` are not later than the first tick of
+    /// block `i + 1`, so a time range maps to a contiguous run of blocks (see find_blocks()).
+    /// The total number of ticks follows the signature as in the other tick formats, so
+    /// extract_num_samples() works unchanged.
+    class TickBlockIndex {
+    public:
+        static constexpr uint8_t SIGNATURE = 0x03; ///< Signature byte of seekable tick segments.
+
+        /// \brief Removes all blocks.
+        void clear() noexcept {
+            m_blocks.clear();
+            m_num_ticks = 0;
+        }
+
+        /// \brief Appends a block while writing a segment.
+        /// \param first_time_ms Time of the first tick in the block.
+        /// \param num_ticks Number of ticks in the block.
+        /// \param size Size of the encoded block in bytes.
+        void add_block(uint64_t first_time_ms, uint32_t num_ticks, size_t size) {
+            const size_t offset = m_blocks.empty() ? 0 : m_blocks.back().offset + m_blocks.back().size;
+            m_blocks.push_back(TickBlockInfo{first_time_ms, num_ticks, offset, size});
+            m_num_ticks += num_ticks;
+        }
+
+        /// \brief Appends the signature and the index; the blocks must be appended afterwards in order.
+        /// \param output Vector where the header will be appended.
+        /// \throws std::invalid_argument If no blocks were added.
+        void write_header(std::vector<uint8_t>& output) const {
+            if (m_blocks.empty()) throw std::invalid_argument("Seekable tick segment has no blocks.");
+            constexpr uint64_t interval_ms = 3600000ULL;
+            const uint64_t base_unix_hour = m_blocks.front().first_time_ms / interval_ms;
+
+            output.push_back(SIGNATURE);
+            dfh::utils::append_vbyte<uint32_t>(output, static_cast<uint32_t>(m_num_ticks));
+            dfh::utils::append_vbyte<uint32_t>(output, static_cast<uint32_t>(base_unix_hour));
+            dfh::utils::append_vbyte<uint32_t>(output, static_cast<uint32_t>(m_blocks.size()));
+
+            uint64_t prev_time_ms = base_unix_hour * interval_ms;
+            for (const auto& block : m_blocks) {
+                dfh::utils::append_vbyte<uint64_t>(output, block.first_time_ms - prev_time_ms);
+                dfh::utils::append_vbyte<uint32_t>(output, block.num_ticks);
+                dfh::utils::append_vbyte<uint32_t>(output, static_cast<uint32_t>(block.size));
+                prev_time_ms = block.first_time_ms;
+            }
+        }
+
+        /// \brief Reads the index of a seekable segment.
+        /// \param data Pointer to the segment.
+        /// \param size Size of the segment.
+        /// \throws std::invalid_argument If the signature does not match.
+        /// \throws std::runtime_error If the index is inconsistent with the segment.
+        void parse(const uint8_t* data, size_t size) {
+            if (size < 4 || data[0] != SIGNATURE) {
+                throw std::invalid_argument("Invalid data signature. Expected a seekable tick segment.");
+            }
+            clear();
+            size_t offset = 1;
+            const size_t num_ticks  = dfh::utils::extract_vbyte<uint32_t>(data, offset);
+            constexpr uint64_t interval_ms = 3600000ULL;
+            uint64_t time_ms        = dfh::utils::extract_vbyte<uint32_t>(data, offset) * interval_ms;
+            const size_t num_blocks = dfh::utils::extract_vbyte<uint32_t>(data, offset);
+            if (num_blocks > size) {
+                throw std::runtime_error("Corrupted seekable tick segment: invalid number of blocks.");
+            }
+
+            m_blocks.reserve(num_blocks);
+            for (size_t i = 0; i < num_blocks; ++i) {
+                time_ms += dfh::utils::extract_vbyte<uint64_t>(data, offset);
+                const uint32_t block_ticks = dfh::utils::extract_vbyte<uint32_t>(data, offset);
+                const size_t block_size    = dfh::utils::extract_vbyte<uint32_t>(data, offset);
+                add_block(time_ms, block_ticks, block_size);
+                if (offset > size) break;
+            }
+
+            for (auto& block : m_blocks) block.offset += offset;
+            if (offset > size || m_num_ticks != num_ticks ||
+                (!m_blocks.empty() && m_blocks.back().offset + m_blocks.back().size > size)) {
+                throw std::runtime_error("Corrupted seekable tick segment: block index exceeds segment.");
+            }
+        }
+
+        /// \brief Returns the blocks in time order.
+        const std::vector<TickBlockInfo>& blocks() const noexcept {
+            return m_blocks;
+        }
+
+        /// \brief Returns the total number of ticks.
+        size_t num_ticks() const noexcept {
+            return m_num_ticks;
+        }
+
+        /// \brief Finds the blocks that may contain ticks in `[start_ts, end_ts)`.
+        /// \param start_ts Start of the range (inclusive).
+        /// \param end_ts End of the range (exclusive).
+        /// \return Half-open range `[first, last)` of block indices; empty if `first == last`.
+        std::pair<size_t, size_t> find_blocks(uint64_t start_ts, uint64_t end_ts) const {
+            auto by_time = [](const TickBlockInfo& block, uint64_t timestamp) {
+                return block.first_time_ms < timestamp;
+            };
+            const size_t last = std::lower_bound(m_blocks.begin(), m_blocks.end(), end_ts, by_time) - m_blocks.begin();
+            size_t first = std::lower_bound(m_blocks.begin(), m_blocks.end(), start_ts, by_time) - m_blocks.begin();
+            // The preceding block starts before start_ts but may extend into the range.
+            if (first > 0) --first;
+            return {first, std::max(first, last)};
+        }
+
+    private:
+        std::vector<TickBlockInfo> m_blocks;        ///< Blocks in time order.
+        size_t                     m_num_ticks = 0; ///< Total number of ticks.
+    };
+
+} // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_TICK_BLOCK_INDEX_HPP_INCLUDED
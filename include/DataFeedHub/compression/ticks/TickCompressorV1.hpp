@@ -12,6 +12,28 @@
 
 namespace dfh::compression {
 
+    namespace detail {
+
+        /// \struct TickBuffer
+        /// \brief Caller-provided tick array used as decode output by decode_into().
+        struct TickBuffer {
+            MarketTick* data;     ///< First tick of the array.
+            size_t      capacity; ///< Number of ticks the array can hold.
+            size_t      count;    ///< Number of decoded ticks.
+
+            size_t size() const noexcept { return count; }
+
+            /// \brief Value-initializes the ticks up to `size`, as std::vector::resize() does.
+            /// \throw std::length_error if `size` exceeds the capacity.
+            void resize(size_t size) {
+                if (size > capacity) throw std::length_error("Tick buffer is too small for the segment.");
+                std::fill(data + count, data + size, MarketTick{});
+                count = size;
+            }
+        };
+
+    } // namespace detail
+
     /// \class TickCompressorV1
     /// \brief Implements tick data compression and decompression using ZSTD with a custom dictionary.
     ///
@@ -22,6 +44,9 @@ namespace dfh::compression {
     /// - **Side (`side`)**: Direction of the trade, indicating whether the trade was initiated by a buyer (buy) or a seller (sell).
     /// - **Last update flag**: Indicates if the last price was updated during the trade.
     ///
+    /// Each column section is preceded by its byte size (bit 7 of the second header byte), so
+    /// deserialize() with a TickField mask can skip the sections that are not requested.
+    ///
     /// \note This compressor is not suitable for tick data that lacks these fields, such as order book updates
     /// or trades without directional information.
     class TickCompressorV1 final : public ITickSerializer {
@@ -43,6 +68,19 @@ namespace dfh::compression {
             return m_config;
         }
 
+        /// \brief Selects the ZSTD dictionary used for compression.
+        /// \details Decompression always uses the dictionary named in the segment's ZSTD frame header.
+        /// \param dictionary_id ID of a dictionary in ZstdDictionaryRegistry::instance(); 0 selects
+        ///        the built-in dictionary.
+        void set_dictionary_id(uint32_t dictionary_id) {
+            m_dictionary_id = dictionary_id;
+        }
+
+        /// \brief Returns the ID of the ZSTD dictionary used for compression (0 for the built-in dictionary).
+        uint32_t dictionary_id() const noexcept {
+            return m_dictionary_id;
+        }
+
         /// \copydoc ITickSerializer::is_valid_signature()
 		bool is_valid_signature(const std::vector<uint8_t>& input) const override final {
             if (input.empty()) return false; // No data to check.
@@ -86,6 +124,176 @@ namespace dfh::compression {
             config = m_config;
         }
 
+        /// \copydoc ITickSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&, TickField)
+        /// \details Segments written with section sizes skip the volume, receive time and flag
+        /// sections that are not requested; fields outside the mask stay value-initialized.
+        /// Older segments are decoded in full.
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+            const std::vector<uint8_t>& input,
+            std::vector<MarketTick>& ticks,
+            TickField fields) override final {
+            decompress(input, ticks, fields);
+        }
+
+        /// \copydoc ITickSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketTick>&)
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<MarketTick>& ticks) override final {
+            decompress_impl(data, size, ticks, TickField::ALL);
+        }
+
+        /// \copydoc ITickSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketTick>&, TickCodecConfig&)
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<MarketTick>& ticks,
+                TickCodecConfig& config) override final {
+            decompress_impl(data, size, ticks, TickField::ALL);
+            config = m_config;
+        }
+
+        /// \brief Serializes ticks stored in columns.
+        /// \param columns Source columns; `time_ms` and `last` are required, as are `volume`,
+        ///        `received_ms` and `flags` when the configuration enables them.
+        /// \param config The serialization configuration.
+        /// \param output A vector where the binary data will be stored.
+        /// \throw std::invalid_argument if the configuration is invalid or a required column is missing.
+        void serialize(
+                const TickColumnsView& columns,
+                const TickCodecConfig& config,
+                std::vector<uint8_t>& output) {
+            set_codec_config(config);
+            if (columns.empty()) return;
+            if (!columns.time_ms || !columns.last ||
+                (m_config.has_flag(TickStorageFlags::ENABLE_VOLUME) && !columns.volume) ||
+                (m_config.has_flag(TickStorageFlags::ENABLE_RECV_TIME) && !columns.received_ms) ||
+                (m_config.has_flag(TickStorageFlags::ENABLE_TICK_FLAGS) && !columns.flags)) {
+                throw std::invalid_argument("TickColumnsView lacks a column required by the codec configuration.");
+            }
+            compress_impl(columns, columns.size, output);
+        }
+
+        /// \brief Deserializes ticks into columns.
+        /// \param input A vector of binary data.
+        /// \param columns Columns where the ticks will be appended.
+        /// \param fields Mask of the fields to decode (see deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&, TickField)).
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+                const std::vector<uint8_t>& input,
+                TickColumns& columns,
+                TickField fields = TickField::ALL) {
+            decompress_impl(input.data(), input.size(), columns, fields);
+        }
+
+        /// \brief Deserializes ticks into columns and retrieves the configuration.
+        /// \param input A vector of binary data.
+        /// \param columns Columns where the ticks will be appended.
+        /// \param config A reference to store the retrieved configuration.
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+                const std::vector<uint8_t>& input,
+                TickColumns& columns,
+                TickCodecConfig& config) {
+            decompress_impl(input.data(), input.size(), columns, TickField::ALL);
+            config = m_config;
+        }
+
+        /// \brief Deserializes ticks into columns with scaled integer prices.
+        ///
+        /// Prices are written as stored, multiplied by `10^price_digits`, skipping the conversion
+        /// to double. Empty columns take `price_digits` from the segment.
+        /// \param input A vector of binary data.
+        /// \param columns Columns where the ticks will be appended.
+        /// \param fields Mask of the fields to decode (see deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&, TickField)).
+        /// \throw std::invalid_argument if non-empty columns use a different `price_digits` than the segment.
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+                const std::vector<uint8_t>& input,
+                ScaledTickColumns& columns,
+                TickField fields = TickField::ALL) {
+            decompress_impl(input.data(), input.size(), columns, fields);
+        }
+
+        /// \brief Deserializes ticks into columns with scaled integer prices and retrieves the configuration.
+        /// \param input A vector of binary data.
+        /// \param columns Columns where the ticks will be appended.
+        /// \param config A reference to store the retrieved configuration.
+        /// \throw std::invalid_argument if non-empty columns use a different `price_digits` than the segment.
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+                const std::vector<uint8_t>& input,
+                ScaledTickColumns& columns,
+                TickCodecConfig& config) {
+            decompress_impl(input.data(), input.size(), columns, TickField::ALL);
+            config = m_config;
+        }
+
+        /// \copydoc ITickSerializer::decode_into()
+        size_t decode_into(
+                const uint8_t* data,
+                size_t size,
+                MarketTick* ticks,
+                size_t capacity) override final {
+            return decode_into(data, size, ticks, capacity, TickField::ALL);
+        }
+
+        /// \brief Decodes the requested fields of a segment into a caller-provided tick array.
+        /// \param data Pointer to the compressed segment.
+        /// \param size Size of the compressed segment.
+        /// \param ticks Destination array; fields outside the mask are value-initialized.
+        /// \param capacity Number of ticks `ticks` can hold.
+        /// \param fields Mask of the fields to decode (see deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&, TickField)).
+        /// \return Number of decoded ticks.
+        /// \throw std::length_error if `capacity` is smaller than the number of ticks in the segment.
+        /// \throw std::runtime_error if decompression fails.
+        size_t decode_into(
+                const uint8_t* data,
+                size_t size,
+                MarketTick* ticks,
+                size_t capacity,
+                TickField fields) {
+            if (size == 0) return 0;
+            if (extract_num_samples(data, size) > capacity) {
+                throw std::length_error("Tick buffer is too small for the segment.");
+            }
+            detail::TickBuffer output{ticks, capacity, 0};
+            decompress_impl(data, size, output, fields);
+            return output.count;
+        }
+
+        /// \brief Re-encodes the ZSTD stage of a compressed segment with another profile.
+        ///
+        /// Column encoding is left untouched; only the final ZSTD frame is rebuilt, so a segment
+        /// written with `INGEST_FAST` can be upgraded to `ARCHIVE` without decoding ticks.
+        /// The new frame uses the dictionary selected with set_dictionary_id(), so this also
+        /// migrates segments to a newly trained dictionary.
+        /// \param input Segment produced by this compressor.
+        /// \param profile Target compression profile.
+        /// \param output Vector where the recompressed segment will be appended.
+        /// \throw std::invalid_argument if the input signature does not match.
+        /// \throw std::runtime_error if decompression or compression fails.
+        void recompress(
+                const std::vector<uint8_t>& input,
+                TickCompressionProfile profile,
+                std::vector<uint8_t>& output) {
+            if (!is_valid_signature(input)) {
+                throw std::invalid_argument("Invalid data signature. Expected TickCompressorV1 data.");
+            }
+            m_context.reset();
+            const ZstdDictionary& source = tick_zstd_dictionary(extract_zstd_dictionary_id(input.data(), input.size()));
+            const ZstdDictionary& target = tick_zstd_dictionary(m_dictionary_id);
+            recompress_zstd_data(
+                m_context.zstd.dctx(), source.ddict(),
+                m_context.zstd.cctx(), target.cdict(zstd_compression_level(profile)),
+                input.data(), input.size(),
+                m_context.processing_buffer,
+                output);
+        }
+
 	private:
 
         /// \brief Compresses market tick data.
@@ -95,7 +303,20 @@ namespace dfh::compression {
         void compress(
                 const std::vector<MarketTick>& ticks,
                 std::vector<uint8_t>& output) {
-            if (ticks.empty()) return;
+            compress_impl(ticks.data(), ticks.size(), output);
+        }
+
+        /// \brief Compresses ticks stored as MarketTick records or as tick columns.
+        /// \param input Pointer to MarketTick records or a TickColumnsView.
+        /// \param num_ticks Number of ticks.
+        /// \param output A vector where the compressed data will be stored.
+        /// \throw std::invalid_argument if the configuration is invalid (e.g., precision exceeds allowed digits).
+        template<class Input>
+        void compress_impl(
+                const Input& input,
+                size_t num_ticks,
+                std::vector<uint8_t>& output) {
+            if (num_ticks == 0) return;
             if (!m_config.has_flag(TickStorageFlags::ENABLE_TICK_FLAGS)) {
                 throw std::invalid_argument(
                     "Trade-based encoding is disabled in the configuration. "
@@ -112,6 +333,7 @@ namespace dfh::compression {
             m_context.reset();
 
             auto& buffer = m_context.processing_buffer;
+            const MarketTick first_tick = tick_at(input, 0);
 
             uint8_t header = 0x00;
             // Record the precision levels
@@ -127,13 +349,17 @@ namespace dfh::compression {
 
             // Bits 0-4: Number of decimal places for the volume
             // Bit 5: Indicates if the first tick has the LAST_UPDATED flag set
+            // Bit 6: ENABLE_RECV_TIME — whether the receive latency stream is encoded
+            // Bit 7: Section sizes — every column section is preceded by its 32-bit byte size
             header = 0x00;
             header |= (m_config.volume_digits & 0x1F);
-            header |= (ticks[0].has_flag(TickUpdateFlags::LAST_UPDATED) << 5) & 0x20;
+            header |= (first_tick.has_flag(TickUpdateFlags::LAST_UPDATED) << 5) & 0x20;
+            header |= (m_config.has_flag(TickStorageFlags::ENABLE_RECV_TIME) << 6) & 0x40;
+            header |= 0x80;
             buffer.push_back(header);
 
             constexpr uint64_t interval_ms = 3600000ULL;
-            const uint64_t base_unix_hour = (ticks[0].time_ms / interval_ms);
+            const uint64_t base_unix_hour = (first_tick.time_ms / interval_ms);
             const uint64_t base_unix_time = base_unix_hour * interval_ms;
 
             dfh::utils::append_vbyte<uint32_t>(buffer, base_unix_hour);
@@ -141,44 +367,60 @@ namespace dfh::compression {
             dfh::utils::append_vbyte<uint64_t>(buffer, encode_zig_zag_int64((int64_t)m_config.next_expiration_time_ms - (int64_t)base_unix_time));
 
             const double price_scale = dfh::utils::pow10<double>(m_config.price_digits);
-            const uint64_t initial_price = std::llround(ticks[0].last * price_scale);
+            const uint64_t initial_price = std::llround(first_tick.last * price_scale);
             const uint64_t tick_size = std::llround(m_config.tick_size * price_scale);
 
             dfh::utils::append_vbyte<uint64_t>(buffer, initial_price);
             dfh::utils::append_vbyte<uint64_t>(buffer, tick_size);
 
+            size_t section = begin_section(buffer);
             m_encoder.encode_price_last(
                 buffer,
-                ticks.data(),
-                ticks.size(),
+                last_of(input),
+                num_ticks,
                 price_scale,
                 initial_price);
+            end_section(buffer, section);
 
             if (m_config.has_flag(TickStorageFlags::ENABLE_VOLUME)) {
+                section = begin_section(buffer);
                 m_encoder.encode_volume(
                     buffer,
-                    ticks.data(),
-                    ticks.size(),
+                    volume_of(input),
+                    num_ticks,
                     dfh::utils::pow10<double>(m_config.volume_digits));
+                end_section(buffer, section);
             }
 
+            section = begin_section(buffer);
             m_encoder.encode_time(
                 buffer,
-                ticks.data(),
-                ticks.size(),
-                base_unix_time);
+                time_of(input),
+                num_ticks,
+                base_unix_time,
+                m_config.has_flag(TickStorageFlags::DELTA_OF_DELTA_TIME));
+            end_section(buffer, section);
+
+            if (m_config.has_flag(TickStorageFlags::ENABLE_RECV_TIME)) {
+                section = begin_section(buffer);
+                encode_recv_latency(buffer, input, num_ticks);
+                end_section(buffer, section);
+            }
 
             if (m_config.has_flag(TickStorageFlags::ENABLE_TICK_FLAGS)) {
-                m_encoder.encode_side_flags(buffer, ticks.data(), ticks.size());
+                section = begin_section(buffer);
+                m_encoder.encode_tick_flags(buffer, flags_of(input), num_ticks);
+                end_section(buffer, section);
             }
 
             constexpr uint8_t signature = 0x01;
             compress_zstd_data(
+                m_context.zstd.cctx(),
+                tick_zstd_dictionary(m_dictionary_id).cdict(
+                    zstd_compression_level(m_config.compression_profile)),
                 buffer.data(), buffer.size(),
-                zstd_dict_tick_compressor_v1_102400,
-                sizeof(zstd_dict_tick_compressor_v1_102400),
                 signature,
-                ticks.size(),
+                num_ticks,
                 output);
         }
 
@@ -203,9 +445,36 @@ namespace dfh::compression {
         void decompress(
                 const std::vector<uint8_t>& input,
                 std::vector<MarketTick>& ticks) {
-            if (input.empty()) return;
+            decompress(input, ticks, TickField::ALL);
+        }
+
+        /// \brief Decompresses the requested fields of market tick data.
+        /// \param input A vector of compressed data.
+        /// \param ticks A vector where the decompressed MarketTick data will be appended.
+        /// \param fields Mask of the fields to decode; ignored for segments without section sizes.
+        /// \throw std::runtime_error if decompression fails or a section exceeds the segment.
+        void decompress(
+                const std::vector<uint8_t>& input,
+                std::vector<MarketTick>& ticks,
+                TickField fields) {
+            decompress_impl(input.data(), input.size(), ticks, fields);
+        }
+
+        /// \brief Decompresses the requested fields into MarketTick records or tick columns.
+        /// \param data Pointer to the compressed segment.
+        /// \param size Size of the compressed segment.
+        /// \param ticks `std::vector<MarketTick>`, TickColumns, ScaledTickColumns or detail::TickBuffer where the ticks will be appended.
+        /// \param fields Mask of the fields to decode; ignored for segments without section sizes.
+        /// \throw std::runtime_error if decompression fails or a section exceeds the segment.
+        template<class Output>
+        void decompress_impl(
+                const uint8_t* data,
+                size_t size,
+                Output& ticks,
+                TickField fields) {
+            if (size == 0) return;
             constexpr uint8_t signature = 0x01;
-            if (input[0] != signature) {
+            if (data[0] != signature) {
                 throw std::invalid_argument(
                     "Invalid data signature. The input data does not match the expected format. "
                     "Ensure that the data was compressed using the correct version of the compressor."
@@ -213,15 +482,15 @@ namespace dfh::compression {
             }
 
             size_t offset = 1;
-            const size_t num_ticks = dfh::utils::extract_vbyte<uint32_t>(input.data(), offset);
+            const size_t num_ticks = dfh::utils::extract_vbyte<uint32_t>(data, offset);
 
             m_context.reset();
             auto& buffer = m_context.processing_buffer;
 
             decompress_zstd_data(
-                input.data() + offset, input.size() - offset,
-                zstd_dict_tick_compressor_v1_102400,
-                sizeof(zstd_dict_tick_compressor_v1_102400),
+                m_context.zstd.dctx(),
+                tick_zstd_dictionary(extract_zstd_dictionary_id(data, size)).ddict(),
+                data + offset, size - offset,
                 buffer);
 
             offset = 0;
@@ -236,6 +505,13 @@ namespace dfh::compression {
             header = buffer[offset++];
             m_config.volume_digits  = header & 0x1F;
             const bool last_updated = (header & 0x20) != 0;
+            const bool enable_recv_time = (header & 0x40) != 0;
+            m_config.set_flag(TickStorageFlags::ENABLE_RECV_TIME, enable_recv_time);
+            const bool has_sections = (header & 0x80) != 0;
+            if (!has_sections) fields = TickField::ALL;
+            const bool need_recv_time = enable_recv_time && has_flag(fields, TickField::RECV_TIME);
+            const bool need_time      = need_recv_time || has_flag(fields, TickField::TIME);
+            const bool need_flags     = m_config.has_flag(TickStorageFlags::ENABLE_TICK_FLAGS) && has_flag(fields, TickField::FLAGS);
 
             constexpr uint64_t interval_ms = 3600000ULL;
             const uint64_t base_unix_hour = dfh::utils::extract_vbyte<uint32_t>(buffer.data(), offset);
@@ -247,52 +523,202 @@ namespace dfh::compression {
             const uint64_t tick_size      = dfh::utils::extract_vbyte<uint64_t>(buffer.data(), offset);
             const double   price_scale    = dfh::utils::pow10<double>(m_config.price_digits);
             m_config.tick_size            = price_scale == 0.0 ? 0.0 : (double)tick_size / price_scale;
+            set_price_digits(ticks, m_config.price_digits);
             const size_t initial_size     = ticks.size();
             ticks.resize(initial_size + num_ticks);
 
-            MarketTick* ticks_ptr = ticks.data() + initial_size;
+            const auto ticks_ptr = output_at(ticks, initial_size);
 
-            m_decoder.decode_price_last(
-                ticks_ptr,
-                buffer.data(),
-                offset,
-                num_ticks,
-                price_scale,
-                initial_price);
+            size_t section_end = read_section(buffer, offset, has_sections);
+            if (has_flag(fields, TickField::LAST)) {
+                m_decoder.decode_price_last(
+                    last_of(ticks_ptr),
+                    buffer.data(),
+                    offset,
+                    num_ticks,
+                    price_scale,
+                    initial_price);
+            }
+            offset = has_sections ? section_end : offset;
 
             if (enable_volume) {
-                m_decoder.decode_volume(
-                    ticks_ptr,
+                section_end = read_section(buffer, offset, has_sections);
+                if (has_flag(fields, TickField::VOLUME)) {
+                    m_decoder.decode_volume(
+                        volume_of(ticks_ptr),
+                        buffer.data(),
+                        offset,
+                        num_ticks,
+                        dfh::utils::pow10<double>(m_config.volume_digits));
+                }
+                offset = has_sections ? section_end : offset;
+            }
+
+            section_end = read_section(buffer, offset, has_sections);
+            m_config.set_flag(TickStorageFlags::DELTA_OF_DELTA_TIME, TickDecoderV1::is_delta_of_delta_time(buffer.data(), offset));
+            if (need_time) {
+                m_decoder.decode_time(
+                    time_of(ticks_ptr),
                     buffer.data(),
                     offset,
                     num_ticks,
-                    dfh::utils::pow10<double>(m_config.volume_digits));
+                    base_unix_time);
             }
+            offset = has_sections ? section_end : offset;
 
-            m_decoder.decode_time(
-                ticks_ptr,
-                buffer.data(),
-                offset,
-                num_ticks,
-                base_unix_time);
+            if (enable_recv_time) {
+                section_end = read_section(buffer, offset, has_sections);
+                if (need_recv_time) {
+                    decode_recv_latency(ticks_ptr, buffer.data(), offset, num_ticks);
+                }
+                offset = has_sections ? section_end : offset;
+            }
 
-            if (m_config.has_flag(TickStorageFlags::ENABLE_TICK_FLAGS)) {
-                m_decoder.decode_side_flags(
-                    ticks_ptr,
+            if (need_flags) {
+                read_section(buffer, offset, has_sections);
+                const bool lossless = m_decoder.decode_tick_flags(
+                    flags_of(ticks_ptr),
                     buffer.data(),
                     offset,
                     num_ticks);
-                if (last_updated) {
-                    ticks[ticks.size() - num_ticks].set_flag(TickUpdateFlags::LAST_UPDATED);
+                // Legacy segments only store the trade side; restore the implied flags.
+                if (!lossless && last_updated) {
+                    flag_at(ticks_ptr, 0) |= TickUpdateFlags::LAST_UPDATED;
                 }
-                if (enable_volume) {
+                if (!lossless && enable_volume) {
                     for (size_t i = 0; i < num_ticks; ++i) {
-                        ticks_ptr[i].flags |= TickUpdateFlags::VOLUME_UPDATED;
+                        flag_at(ticks_ptr, i) |= TickUpdateFlags::VOLUME_UPDATED;
                     }
                 }
             }
         }
 
+        /// \struct ColumnPointers
+        /// \brief Destination columns of a decode into TickColumns (`double` prices) or ScaledTickColumns (`int64_t` prices).
+        template<class Price>
+        struct ColumnPointers {
+            uint64_t* time_ms;
+            uint64_t* received_ms;
+            Price* last;
+            double* volume;
+            TickUpdateFlags* flags;
+        };
+
+        // Field accessors used by compress_impl() and decompress_impl(): MarketTick records are
+        // passed to the encoder and decoder as is, tick columns as their field arrays.
+
+        static MarketTick tick_at(const MarketTick* ticks, size_t i) { return ticks[i]; }
+        static MarketTick tick_at(const TickColumnsView& view, size_t i) { return view.tick(i); }
+
+        static const MarketTick* last_of(const MarketTick* ticks) { return ticks; }
+        static const MarketTick* volume_of(const MarketTick* ticks) { return ticks; }
+        static const MarketTick* time_of(const MarketTick* ticks) { return ticks; }
+        static const MarketTick* flags_of(const MarketTick* ticks) { return ticks; }
+        static const double* last_of(const TickColumnsView& view) { return view.last; }
+        static const double* volume_of(const TickColumnsView& view) { return view.volume; }
+        static const uint64_t* time_of(const TickColumnsView& view) { return view.time_ms; }
+        static const TickUpdateFlags* flags_of(const TickColumnsView& view) { return view.flags; }
+
+        static MarketTick* output_at(std::vector<MarketTick>& ticks, size_t offset) { return ticks.data() + offset; }
+        static MarketTick* output_at(detail::TickBuffer& ticks, size_t offset) { return ticks.data + offset; }
+        static ColumnPointers<double> output_at(TickColumns& columns, size_t offset) {
+            return ColumnPointers<double>{
+                columns.time_ms.data() + offset,
+                columns.received_ms.data() + offset,
+                columns.last.data() + offset,
+                columns.volume.data() + offset,
+                columns.flags.data() + offset};
+        }
+        static ColumnPointers<int64_t> output_at(ScaledTickColumns& columns, size_t offset) {
+            return ColumnPointers<int64_t>{
+                columns.time_ms.data() + offset,
+                columns.received_ms.data() + offset,
+                columns.last.data() + offset,
+                columns.volume.data() + offset,
+                columns.flags.data() + offset};
+        }
+
+        template<class Output>
+        static void set_price_digits(Output&, uint8_t) {}
+        static void set_price_digits(ScaledTickColumns& columns, uint8_t price_digits) {
+            if (columns.empty()) {
+                columns.price_digits = price_digits;
+            } else if (columns.price_digits != price_digits) {
+                throw std::invalid_argument("ScaledTickColumns already hold prices with different price_digits.");
+            }
+        }
+
+        static MarketTick* last_of(MarketTick* ticks) { return ticks; }
+        static MarketTick* volume_of(MarketTick* ticks) { return ticks; }
+        static MarketTick* time_of(MarketTick* ticks) { return ticks; }
+        static MarketTick* flags_of(MarketTick* ticks) { return ticks; }
+        template<class Price>
+        static Price* last_of(const ColumnPointers<Price>& columns) { return columns.last; }
+        template<class Price>
+        static double* volume_of(const ColumnPointers<Price>& columns) { return columns.volume; }
+        template<class Price>
+        static uint64_t* time_of(const ColumnPointers<Price>& columns) { return columns.time_ms; }
+        template<class Price>
+        static TickUpdateFlags* flags_of(const ColumnPointers<Price>& columns) { return columns.flags; }
+
+        static TickUpdateFlags& flag_at(MarketTick* ticks, size_t i) { return ticks[i].flags; }
+        template<class Price>
+        static TickUpdateFlags& flag_at(const ColumnPointers<Price>& columns, size_t i) { return columns.flags[i]; }
+
+        void encode_recv_latency(std::vector<uint8_t>& buffer, const MarketTick* ticks, size_t num_ticks) {
+            m_encoder.encode_recv_latency(buffer, ticks, num_ticks);
+        }
+
+        void encode_recv_latency(std::vector<uint8_t>& buffer, const TickColumnsView& view, size_t num_ticks) {
+            m_encoder.encode_recv_latency(buffer, view.time_ms, view.received_ms, num_ticks);
+        }
+
+        void decode_recv_latency(MarketTick* ticks, const uint8_t* binary, size_t& offset, size_t num_ticks) {
+            m_decoder.decode_recv_latency(ticks, binary, offset, num_ticks);
+        }
+
+        template<class Price>
+        void decode_recv_latency(const ColumnPointers<Price>& columns, const uint8_t* binary, size_t& offset, size_t num_ticks) {
+            m_decoder.decode_recv_latency(columns.time_ms, columns.received_ms, binary, offset, num_ticks);
+        }
+
+        /// \brief Reserves the 32-bit size prefix of a column section.
+        /// \param buffer Output buffer.
+        /// \return Position of the size prefix.
+        static size_t begin_section(std::vector<uint8_t>& buffer) {
+            const size_t position = buffer.size();
+            buffer.resize(position + sizeof(uint32_t));
+            return position;
+        }
+
+        /// \brief Writes the size of the section started at `position`.
+        /// \param buffer Output buffer.
+        /// \param position Value returned by begin_section().
+        static void end_section(std::vector<uint8_t>& buffer, size_t position) {
+            const uint32_t size = static_cast<uint32_t>(buffer.size() - position - sizeof(uint32_t));
+            std::memcpy(buffer.data() + position, &size, sizeof(size));
+        }
+
+        /// \brief Reads the size prefix of a column section.
+        /// \param buffer Decompressed segment.
+        /// \param offset Current offset; moved past the size prefix.
+        /// \param has_sections Whether the segment stores section sizes.
+        /// \return Offset of the end of the section, or `offset` if the segment has no section sizes.
+        /// \throw std::runtime_error if the section exceeds the segment.
+        static size_t read_section(const std::vector<uint8_t>& buffer, size_t& offset, bool has_sections) {
+            if (!has_sections) return offset;
+            uint32_t size = 0;
+            if (offset + sizeof(size) > buffer.size()) {
+                throw std::runtime_error("Corrupted tick segment: section size is out of bounds.");
+            }
+            std::memcpy(&size, buffer.data() + offset, sizeof(size));
+            offset += sizeof(size);
+            if (offset + size > buffer.size()) {
+                throw std::runtime_error("Corrupted tick segment: section exceeds segment size.");
+            }
+            return offset + size;
+        }
+
         /// \brief Decompresses market tick data and retrieves the configuration.
         /// \param input A vector of compressed data.
         /// \param ticks A vector where the decompressed MarketTick data will be stored.
@@ -312,6 +738,7 @@ namespace dfh::compression {
         TickEncoderV1             m_encoder; ///< Encoder for market tick data.
         TickDecoderV1             m_decoder; ///< Decoder for market tick data.
         TickCodecConfig           m_config;  ///< Configuration for encoding/decoding.
+        uint32_t                  m_dictionary_id = 0; ///< ZSTD dictionary used for compression (0 = built-in).
     }; // TickCompressorV1
 
 }; // namespace dfh::compression
@@ -23,7 +23,11 @@ namespace dfh::compression {
         std::vector<uint32_t, dfh::utils::aligned_allocator<uint32_t, 16>> code_to_value_u32; ///< Maps encoded 32-bit values to their original values.
         std::vector<uint64_t, dfh::utils::aligned_allocator<uint64_t, 16>> code_to_value_u64; ///< Maps encoded 64-bit values to their original values.
         std::vector<uint32_t, dfh::utils::aligned_allocator<uint32_t, 16>> index_map_u32;     ///< Stores index mappings for 32-bit frequency-encoded values.
+        std::vector<uint64_t, dfh::utils::aligned_allocator<uint64_t, 16>> accum_u64;         ///< Holds an accumulated column while the next column is decoded.
         std::vector<uint8_t> processing_buffer; ///< General-purpose buffer for processing intermediate data.
+        FrequencyEncoder<uint32_t> frequency_u32; ///< Scratch buffers for frequency encoding of 32-bit values.
+        FrequencyEncoder<uint64_t> frequency_u64; ///< Scratch buffers for frequency encoding of 64-bit values.
+        ZstdCodecContext     zstd;              ///< Reusable ZSTD compression/decompression contexts (kept across reset()).
 
         TickCompressionContextV1() = default;
 
@@ -39,6 +43,7 @@ namespace dfh::compression {
             code_to_value_u32.clear();
             code_to_value_u64.clear();
             index_map_u32.clear();
+            accum_u64.clear();
             processing_buffer.clear();
         }
     };
@@ -30,6 +30,276 @@ namespace dfh::compression {
                 size_t num_ticks,
                 double price_scale,
                 int64_t initial_price) {
+            decode_price_last_impl(ticks, binary, offset, num_ticks, price_scale, initial_price);
+        }
+
+        /// \brief Decodes the compressed price data into a contiguous price column.
+        /// \param last Destination prices (e.g. TickColumns::last), at least num_ticks elements.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \param price_scale The scaling factor for price precision.
+        /// \param initial_price The initial price used for delta calculations.
+        void decode_price_last(
+                double* last,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks,
+                double price_scale,
+                int64_t initial_price) {
+            decode_price_last_impl(last, binary, offset, num_ticks, price_scale, initial_price);
+        }
+
+        /// \brief Decodes the compressed price data into a column of scaled integer prices.
+        /// \param last Destination prices multiplied by `10^price_digits` (e.g. ScaledTickColumns::last).
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \param price_scale Ignored; prices stay multiplied by the scale of the segment.
+        /// \param initial_price The initial price used for delta calculations.
+        void decode_price_last(
+                int64_t* last,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks,
+                double /*price_scale*/,
+                int64_t initial_price) {
+            decode_price_last_impl(last, binary, offset, num_ticks, 1.0, initial_price);
+        }
+
+        /// \brief Decodes the compressed volume data.
+        /// \param ticks The array to store decompressed tick data.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \param volume_scale The scaling factor for volume precision.
+        void decode_volume(
+                MarketTick* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks,
+                double volume_scale) {
+            decode_volume_impl(ticks, binary, offset, num_ticks, volume_scale);
+        }
+
+        /// \brief Decodes the compressed volume data into a contiguous volume column.
+        /// \param volume Destination volumes (e.g. TickColumns::volume), at least num_ticks elements.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \param volume_scale The scaling factor for volume precision.
+        void decode_volume(
+                double* volume,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks,
+                double volume_scale) {
+            decode_volume_impl(volume, binary, offset, num_ticks, volume_scale);
+        }
+
+        /// \brief Checks whether the timestamp column at `offset` stores second-order deltas.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset Offset of the timestamp column; not modified.
+        static bool is_delta_of_delta_time(const uint8_t* binary, size_t offset) noexcept {
+            return binary[offset] == 0;
+        }
+
+        /// \brief Decodes the compressed timestamp data.
+        /// \param ticks The array to store decompressed tick data.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \param base_time The base time used for delta calculations.
+        /// \return True if the column stores second-order deltas.
+        bool decode_time(
+                MarketTick* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks,
+                uint64_t base_time) {
+            return decode_time_impl(ticks, binary, offset, num_ticks, base_time);
+        }
+
+        /// \brief Decodes the compressed timestamp data into a contiguous timestamp column.
+        /// \param time_ms Destination timestamps (e.g. TickColumns::time_ms), at least num_ticks elements.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \param base_time The base time used for delta calculations.
+        /// \return True if the column stores second-order deltas.
+        bool decode_time(
+                uint64_t* time_ms,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks,
+                uint64_t base_time) {
+            return decode_time_impl(time_ms, binary, offset, num_ticks, base_time);
+        }
+
+        /// \brief Decodes the receive latency and restores `received_ms`.
+        /// \param ticks The array to store decompressed tick data; `time_ms` must already be decoded.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        void decode_recv_latency(
+                MarketTick* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            auto &deltas_u64 = m_context.deltas_u64;
+            decode_zig_zag_column(binary, offset, num_ticks);
+            for (size_t i = 0; i < num_ticks; ++i) {
+                ticks[i].received_ms = (uint64_t)((int64_t)ticks[i].time_ms + decode_zig_zag_int64(deltas_u64[i]));
+            }
+        }
+
+        /// \brief Decodes the receive latency into a contiguous receive time column.
+        /// \param time_ms Decoded timestamps.
+        /// \param received_ms Destination receive timestamps, at least num_ticks elements.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        void decode_recv_latency(
+                const uint64_t* time_ms,
+                uint64_t* received_ms,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            auto &deltas_u64 = m_context.deltas_u64;
+            decode_zig_zag_column(binary, offset, num_ticks);
+            for (size_t i = 0; i < num_ticks; ++i) {
+                received_ms[i] = (uint64_t)((int64_t)time_ms[i] + decode_zig_zag_int64(deltas_u64[i]));
+            }
+        }
+
+        /// \brief Decodes a column written by TickEncoderV1::encode_zig_zag_column into `deltas_u64`.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of values to decode.
+        void decode_zig_zag_column(
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            auto &deltas_u32 = m_context.deltas_u32;
+            auto &deltas_u64 = m_context.deltas_u64;
+            auto &values_u32 = m_context.values_u32;
+            auto &values_u64 = m_context.values_u64;
+            auto &rle_u32 = m_context.rle_u32;
+            auto &code_to_value_u32 = m_context.code_to_value_u32;
+            auto &code_to_value_u64 = m_context.code_to_value_u64;
+            auto &index_map_u32 = m_context.index_map_u32;
+
+            uint32_t values_length = dfh::utils::extract_vbyte<uint32_t>(binary, offset);
+            const bool requires_int64 = static_cast<bool>(values_length & 0x1);
+            values_length >>= 1;
+
+            index_map_u32.resize(values_length);
+            if (requires_int64) {
+                values_u64.resize(values_length);
+                dfh::utils::extract_vbyte(binary, offset, values_u64.data(), values_length);
+            } else {
+                values_u32.resize(values_length);
+                dfh::utils::extract_simdcomp(binary, offset, values_u32.data(), values_length);
+            }
+            dfh::utils::extract_simdcomp(binary, offset, index_map_u32.data(), values_length);
+
+            const size_t deltas_size = dfh::utils::extract_vbyte<uint32_t>(binary, offset);
+            deltas_u32.resize(num_ticks);
+            dfh::utils::extract_simdcomp(binary, offset, deltas_u32.data(), deltas_size);
+
+            decode_delta_zig_zag_int32(index_map_u32.data(), index_map_u32.data(), values_length, 0);
+
+            rle_u32.resize(num_ticks);
+            size_t repeats_size = 0;
+            decode_zero_with_repeats(deltas_u32.data(), deltas_size, rle_u32.data(), repeats_size);
+
+            deltas_u64.resize(num_ticks);
+            if (requires_int64) {
+                decode_delta_sorted<uint64_t, uint64_t>(values_u64.data(), values_u64.data(), values_length, 0);
+                code_to_value_u64.resize(values_length);
+                decode_frequency(rle_u32.data(), deltas_u64.data(), num_ticks, code_to_value_u64.data(), values_u64.data(), index_map_u32.data(), values_length);
+            } else {
+                decode_delta_sorted<uint32_t, uint32_t>(values_u32.data(), values_u32.data(), values_length, 0);
+                code_to_value_u32.resize(values_length);
+                decode_frequency(rle_u32.data(), rle_u32.data(), num_ticks, code_to_value_u32.data(), values_u32.data(), index_map_u32.data(), values_length);
+                for (size_t i = 0; i < num_ticks; ++i) {
+                    deltas_u64[i] = rle_u32[i];
+                }
+            }
+        }
+        /// \brief Decodes a flag column written by TickEncoderV1::encode_tick_flags() or encode_side_flags().
+        /// \param ticks The array to store decompressed tick data.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \return True if all flag bits were restored; false for a legacy side flag column,
+        ///         which only sets `TICK_FROM_BUY` / `TICK_FROM_SELL`.
+        /// \throws std::runtime_error If a run-length coded plane does not match the tick count.
+        bool decode_tick_flags(
+                MarketTick* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            return decode_tick_flags_impl(ticks, binary, offset, num_ticks);
+        }
+
+        /// \brief Decodes a flag column into a contiguous flag column (see the overload above).
+        /// \param flags Destination flags (e.g. TickColumns::flags); overwritten by bitplane columns.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \return True if all flag bits were restored.
+        /// \throws std::runtime_error If a run-length coded plane does not match the tick count.
+        bool decode_tick_flags(
+                TickUpdateFlags* flags,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            return decode_tick_flags_impl(flags, binary, offset, num_ticks);
+        }
+
+        /// \brief Decodes the compressed side flags indicating trade direction.
+        /// \param ticks The array to store decompressed tick data.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        void decode_side_flags(
+                MarketTick* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            decode_side_flags_impl(ticks, binary, offset, num_ticks);
+        }
+
+        /// \brief Decodes the compressed side flags into a contiguous flag column.
+        /// \param flags Destination flags (e.g. TickColumns::flags); other flag bits are preserved.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        void decode_side_flags(
+                TickUpdateFlags* flags,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            decode_side_flags_impl(flags, binary, offset, num_ticks);
+        }
+
+    private:
+        TickCompressionContextV1& m_context; ///< Reference to the compression context for intermediate data.
+
+        /// \brief Returns the flags of a tick or of a flag column element.
+        static TickUpdateFlags& tick_flags(MarketTick& tick) { return tick.flags; }
+        static TickUpdateFlags& tick_flags(TickUpdateFlags& flags) { return flags; }
+
+        /// \brief Shared implementation of decode_price_last() for ticks and price columns.
+        template<class Target>
+        void decode_price_last_impl(
+                Target* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks,
+                double price_scale,
+                int64_t initial_price) {
             auto &deltas_u32 = m_context.deltas_u32;
             auto &deltas_u64= m_context.deltas_u64;
             auto &values_u32 = m_context.values_u32;
@@ -87,14 +357,10 @@ namespace dfh::compression {
             }
         }
 
-        /// \brief Decodes the compressed volume data.
-        /// \param ticks The array to store decompressed tick data.
-        /// \param binary The binary data buffer containing compressed data.
-        /// \param offset The current offset in the binary buffer, updated after decoding.
-        /// \param num_ticks The number of ticks to decode.
-        /// \param volume_scale The scaling factor for volume precision.
-        void decode_volume(
-                MarketTick* ticks,
+        /// \brief Shared implementation of decode_volume() for ticks and volume columns.
+        template<class Target>
+        void decode_volume_impl(
+                Target* ticks,
                 const uint8_t* binary,
                 size_t& offset,
                 size_t num_ticks,
@@ -134,7 +400,7 @@ namespace dfh::compression {
                 deltas_u64.resize(num_ticks);
                 code_to_value_u64.resize(values_length);
                 decode_frequency(rle_u32.data(), deltas_u64.data(), num_ticks, code_to_value_u64.data(), values_u64.data(), index_map_u32.data(), values_length);
-                scale_volume<uint64_t, MarketTick>(deltas_u64.data(), ticks, num_ticks, volume_scale);
+                scale_volume<uint64_t>(deltas_u64.data(), ticks, num_ticks, volume_scale);
             } else {
                 values_u32.resize(values_length);
                 dfh::utils::extract_simdcomp(binary, offset, values_u32.data(), values_length);
@@ -153,18 +419,15 @@ namespace dfh::compression {
 
                 code_to_value_u32.resize(values_length);
                 decode_frequency(rle_u32.data(), rle_u32.data(), num_ticks, code_to_value_u32.data(), values_u32.data(), index_map_u32.data(), values_length);
-                scale_volume<uint32_t, MarketTick>(rle_u32.data(), ticks, num_ticks, volume_scale);
+                scale_volume<uint32_t>(rle_u32.data(), ticks, num_ticks, volume_scale);
             }
         }
 
-        /// \brief Decodes the compressed timestamp data.
-        /// \param ticks The array to store decompressed tick data.
-        /// \param binary The binary data buffer containing compressed data.
-        /// \param offset The current offset in the binary buffer, updated after decoding.
-        /// \param num_ticks The number of ticks to decode.
-        /// \param base_time The base time used for delta calculations.
-        void decode_time(
-                MarketTick* ticks,
+        /// \brief Shared implementation of decode_time() for ticks and timestamp columns.
+        /// \return True if the column stores second-order deltas (see TickEncoderV1::encode_time_impl()).
+        template<class Target>
+        bool decode_time_impl(
+                Target* ticks,
                 const uint8_t* binary,
                 size_t& offset,
                 size_t num_ticks,
@@ -176,6 +439,8 @@ namespace dfh::compression {
             auto &index_map_u32 = m_context.index_map_u32;
 
             size_t values_length = dfh::utils::extract_vbyte<uint32_t>(binary, offset);
+            const bool delta_of_delta = values_length == 0 && num_ticks != 0;
+            if (delta_of_delta) values_length = dfh::utils::extract_vbyte<uint32_t>(binary, offset);
             values_u32.resize(values_length);
             index_map_u32.resize(values_length);
             dfh::utils::extract_simdcomp(binary, offset, values_u32.data(), values_length);
@@ -194,16 +459,74 @@ namespace dfh::compression {
 
             code_to_value_u32.resize(values_length);
             decode_frequency(rle_u32.data(), rle_u32.data(), num_ticks, code_to_value_u32.data(), values_u32.data(), index_map_u32.data(), values_length);
+            if (delta_of_delta) decode_delta_of_delta_int32(rle_u32.data(), num_ticks);
             decode_time_delta(rle_u32.data(), ticks, num_ticks, base_time);
+            return delta_of_delta;
         }
 
-        /// \brief Decodes the compressed side flags indicating trade direction.
-        /// \param ticks The array to store decompressed tick data.
-        /// \param binary The binary data buffer containing compressed data.
-        /// \param offset The current offset in the binary buffer, updated after decoding.
-        /// \param num_ticks The number of ticks to decode.
-        void decode_side_flags(
-                MarketTick* ticks,
+        /// \brief Shared implementation of decode_tick_flags() for ticks and flag columns.
+        template<class Target>
+        bool decode_tick_flags_impl(
+                Target* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            if (binary[offset] != TickEncoderV1::FLAG_PLANES_TAG) {
+                decode_side_flags_impl(ticks, binary, offset, num_ticks);
+                return false;
+            }
+            constexpr size_t num_planes = 8;
+            auto &words = m_context.deltas_u64;
+            auto &runs  = m_context.values_u64;
+            const size_t num_words   = (num_ticks + 31) / 32;
+            const size_t packed_size = (num_ticks + 7) / 8;
+
+            ++offset;
+            const uint64_t ones_mask = binary[offset++];
+            const uint8_t varying_mask = binary[offset++];
+            const uint8_t rle_mask = binary[offset++];
+            for (size_t i = 0; i < num_ticks; ++i) {
+                tick_flags(ticks[i]) = static_cast<TickUpdateFlags>(ones_mask);
+            }
+
+            for (size_t plane = 0; plane < num_planes; ++plane) {
+                if (!((varying_mask >> plane) & 1)) continue;
+                if (!((rle_mask >> plane) & 1)) {
+                    const uint8_t* packed = binary + offset;
+                    for (size_t i = 0; i < num_ticks; ++i) {
+                        tick_flags(ticks[i]) |= static_cast<uint64_t>((packed[i >> 3] >> (i & 7)) & 1) << plane;
+                    }
+                    offset += packed_size;
+                    continue;
+                }
+
+                const size_t runs_size = dfh::utils::extract_vbyte<uint32_t>(binary, offset);
+                if (runs_size > num_words) {
+                    throw std::runtime_error("Corrupted flag column: too many runs.");
+                }
+                runs.resize(runs_size);
+                dfh::utils::extract_vbyte(binary, offset, runs.data(), runs_size);
+                size_t total = 0;
+                for (size_t i = 0; i < runs_size; ++i) {
+                    total += (runs[i] & 1) && i + 1 < runs_size ? runs[++i] : 1;
+                }
+                if (total != num_words) {
+                    throw std::runtime_error("Corrupted flag column: plane size does not match the number of ticks.");
+                }
+                words.resize(num_words);
+                size_t words_size = 0;
+                decode_run_length(runs.data(), runs_size, words.data(), words_size);
+                for (size_t i = 0; i < num_ticks; ++i) {
+                    tick_flags(ticks[i]) |= ((words[i >> 5] >> (i & 31)) & 1) << plane;
+                }
+            }
+            return true;
+        }
+
+        /// \brief Shared implementation of decode_side_flags() for ticks and flag columns.
+        template<class Target>
+        void decode_side_flags_impl(
+                Target* ticks,
                 const uint8_t* binary,
                 size_t& offset,
                 size_t num_ticks) {
@@ -221,39 +544,35 @@ namespace dfh::compression {
                 max_j = i + chunk_width;
                 byte = binary[byte_index];
                 value = (byte & 0x1);
-                ticks[i].flags &= flag_mask;
-                ticks[i].flags |= value << bit_flag_buy;
-                ticks[i].flags |= !value << bit_flag_sell;
+                tick_flags(ticks[i]) &= flag_mask;
+                tick_flags(ticks[i]) |= value << bit_flag_buy;
+                tick_flags(ticks[i]) |= !value << bit_flag_sell;
                 for (size_t j = i + 1; j < max_j; ++j) {
                     byte >>= 1;
                     value = (byte & 0x1);
-                    ticks[j].flags &= flag_mask;
-                    ticks[j].flags |= value << bit_flag_buy;
-                    ticks[j].flags |= !value << bit_flag_sell;
+                    tick_flags(ticks[j]) &= flag_mask;
+                    tick_flags(ticks[j]) |= value << bit_flag_buy;
+                    tick_flags(ticks[j]) |= !value << bit_flag_sell;
                 }
             }
 
             if (aligned_size < num_ticks) {
                 byte = binary[byte_index];
                 value = (byte & 0x1);
-                ticks[aligned_size].flags &= flag_mask;
-                ticks[aligned_size].flags |= value << bit_flag_buy;
-                ticks[aligned_size].flags |= !value << bit_flag_sell;
+                tick_flags(ticks[aligned_size]) &= flag_mask;
+                tick_flags(ticks[aligned_size]) |= value << bit_flag_buy;
+                tick_flags(ticks[aligned_size]) |= !value << bit_flag_sell;
                 for (size_t i = aligned_size + 1; i < num_ticks; ++i) {
                     byte >>= 1;
                     value = (byte & 0x1);
-                    ticks[i].flags &= flag_mask;
-                    ticks[i].flags |= value << bit_flag_buy;
-                    ticks[i].flags |= !value << bit_flag_sell;
+                    tick_flags(ticks[i]) &= flag_mask;
+                    tick_flags(ticks[i]) |= value << bit_flag_buy;
+                    tick_flags(ticks[i]) |= !value << bit_flag_sell;
                 }
             }
 
             offset += (num_ticks + 7) / 8;
         }
-
-    private:
-        TickCompressionContextV1& m_context; ///< Reference to the compression context for intermediate data.
-
     }; // TickDecoderV1
 
 }; // namespace dfh::compression
@@ -11,6 +11,9 @@ namespace dfh::compression {
     /// \brief Encodes tick data for compression.
     class TickEncoderV1 {
     public:
+        /// \brief First byte of a bitplane flag column (see encode_tick_flags()).
+        /// \details The legacy side flag column starts with 0 or 1.
+        static constexpr uint8_t FLAG_PLANES_TAG = 0x02;
 
         /// \brief Constructs a TickEncoderV1 with a given compression context.
         /// \param context The compression context used for intermediate data.
@@ -29,6 +32,237 @@ namespace dfh::compression {
                 size_t num_ticks,
                 double price_scale,
                 int64_t initial_price) {
+            encode_price_last_impl(output, ticks, num_ticks, price_scale, initial_price);
+        }
+
+        /// \brief Encodes a contiguous price column as delta values.
+        /// \param output The buffer where encoded data will be written.
+        /// \param last Prices of the ticks (e.g. TickColumns::last).
+        /// \param num_ticks The number of ticks to encode.
+        /// \param price_scale The scaling factor for price precision.
+        /// \param initial_price The initial price for delta calculations.
+        void encode_price_last(
+                std::vector<uint8_t>& output,
+                const double* last,
+                size_t num_ticks,
+                double price_scale,
+                int64_t initial_price) {
+            encode_price_last_impl(output, last, num_ticks, price_scale, initial_price);
+        }
+
+        /// \brief Encodes the trade volume as delta values.
+        /// \param output Buffer where encoded data will be written.
+        /// \param ticks Array of market ticks to encode.
+        /// \param num_ticks Number of ticks to encode.
+        /// \param volume_scale Scaling factor for volume precision.
+        void encode_volume(
+                std::vector<uint8_t>& output,
+                const MarketTick* ticks,
+                size_t num_ticks,
+                double volume_scale) {
+            encode_volume_impl(output, ticks, num_ticks, volume_scale);
+        }
+
+        /// \brief Encodes a contiguous volume column as delta values.
+        /// \param output Buffer where encoded data will be written.
+        /// \param volume Volumes of the ticks (e.g. TickColumns::volume).
+        /// \param num_ticks Number of ticks to encode.
+        /// \param volume_scale Scaling factor for volume precision.
+        void encode_volume(
+                std::vector<uint8_t>& output,
+                const double* volume,
+                size_t num_ticks,
+                double volume_scale) {
+            encode_volume_impl(output, volume, num_ticks, volume_scale);
+        }
+
+        /// \brief Encodes the timestamp as delta values.
+        /// \param output Buffer where encoded data will be written.
+        /// \param ticks Array of market ticks to encode.
+        /// \param num_ticks Number of ticks to encode.
+        /// \param initial_time Initial timestamp for delta calculations.
+        /// \param delta_of_delta Store second-order deltas (see encode_time_impl()).
+        /// \return True if second-order deltas were stored.
+        bool encode_time(
+                std::vector<uint8_t>& output,
+                const MarketTick* ticks,
+                size_t num_ticks,
+                int64_t initial_time,
+                bool delta_of_delta = false) {
+            return encode_time_impl(output, ticks, num_ticks, initial_time, delta_of_delta);
+        }
+
+        /// \brief Encodes a contiguous timestamp column as delta values.
+        /// \param output Buffer where encoded data will be written.
+        /// \param time_ms Timestamps of the ticks (e.g. TickColumns::time_ms).
+        /// \param num_ticks Number of ticks to encode.
+        /// \param initial_time Initial timestamp for delta calculations.
+        /// \param delta_of_delta Store second-order deltas (see encode_time_impl()).
+        /// \return True if second-order deltas were stored.
+        bool encode_time(
+                std::vector<uint8_t>& output,
+                const uint64_t* time_ms,
+                size_t num_ticks,
+                int64_t initial_time,
+                bool delta_of_delta = false) {
+            return encode_time_impl(output, time_ms, num_ticks, initial_time, delta_of_delta);
+        }
+
+        /// \brief Encodes the receive latency `received_ms - time_ms` of each tick.
+        /// \param output Buffer where encoded data will be written.
+        /// \param ticks Array of market ticks to encode.
+        /// \param num_ticks Number of ticks to encode.
+        void encode_recv_latency(
+                std::vector<uint8_t>& output,
+                const MarketTick* ticks,
+                size_t num_ticks) {
+            auto &deltas_u64 = m_context.deltas_u64;
+            deltas_u64.resize(num_ticks);
+            for (size_t i = 0; i < num_ticks; ++i) {
+                deltas_u64[i] = encode_zig_zag_int64((int64_t)ticks[i].received_ms - (int64_t)ticks[i].time_ms);
+            }
+            encode_zig_zag_column(output, num_ticks);
+        }
+
+        /// \brief Encodes the receive latency of contiguous timestamp columns.
+        /// \param output Buffer where encoded data will be written.
+        /// \param time_ms Timestamps of the ticks.
+        /// \param received_ms Receive timestamps of the ticks.
+        /// \param num_ticks Number of ticks to encode.
+        void encode_recv_latency(
+                std::vector<uint8_t>& output,
+                const uint64_t* time_ms,
+                const uint64_t* received_ms,
+                size_t num_ticks) {
+            auto &deltas_u64 = m_context.deltas_u64;
+            deltas_u64.resize(num_ticks);
+            for (size_t i = 0; i < num_ticks; ++i) {
+                deltas_u64[i] = encode_zig_zag_int64((int64_t)received_ms[i] - (int64_t)time_ms[i]);
+            }
+            encode_zig_zag_column(output, num_ticks);
+        }
+
+        /// \brief Encodes Zig-Zag values stored in `deltas_u64` using frequency, zero-repeat and simdcomp coding.
+        /// \details Values fitting into 32 bits are packed with simdcomp; otherwise the
+        ///          dictionary falls back to 64-bit vbyte. Bit 0 of the leading length marks the fallback.
+        /// \param output Buffer where encoded data will be written.
+        /// \param num_ticks Number of values in `deltas_u64`.
+        void encode_zig_zag_column(std::vector<uint8_t>& output, size_t num_ticks) {
+            auto &deltas_u32 = m_context.deltas_u32;
+            auto &deltas_u64 = m_context.deltas_u64;
+            auto &values_u32 = m_context.values_u32;
+            auto &values_u64 = m_context.values_u64;
+            auto &index_map_u32 = m_context.index_map_u32;
+
+            bool requires_int64 = false;
+            for (size_t i = 0; i < num_ticks; ++i) {
+                if (deltas_u64[i] > std::numeric_limits<uint32_t>::max()) {
+                    requires_int64 = true;
+                    break;
+                }
+            }
+
+            deltas_u32.resize(num_ticks);
+            uint32_t values_length = 0;
+            if (!requires_int64) {
+                for (size_t i = 0; i < num_ticks; ++i) {
+                    deltas_u32[i] = static_cast<uint32_t>(deltas_u64[i]);
+                }
+                encode_frequency(deltas_u32.data(), deltas_u32.data(), num_ticks, values_u32, index_map_u32, m_context.frequency_u32);
+                encode_delta_sorted<uint32_t, uint32_t>(values_u32.data(), values_u32.data(), values_u32.size(), 0);
+                values_length = static_cast<uint32_t>(values_u32.size());
+            } else {
+                encode_frequency(deltas_u64.data(), deltas_u32.data(), num_ticks, values_u64, index_map_u32, m_context.frequency_u64);
+                encode_delta_sorted<uint64_t, uint64_t>(values_u64.data(), values_u64.data(), values_u64.size(), 0);
+                values_length = static_cast<uint32_t>(values_u64.size());
+            }
+
+            size_t repeats_size = 0;
+            encode_zero_with_repeats(deltas_u32.data(), deltas_u32.size(), deltas_u32.data(), repeats_size);
+            deltas_u32.resize(repeats_size);
+            encode_delta_zig_zag_int32(index_map_u32.data(), index_map_u32.data(), index_map_u32.size(), 0);
+
+            dfh::utils::append_vbyte<uint32_t>(output, (values_length << 1) | (requires_int64 ? 0x1 : 0x0));
+            if (requires_int64) {
+                dfh::utils::append_vbyte<uint64_t>(output, values_u64.data(), values_u64.size());
+            } else {
+                dfh::utils::append_simdcomp(output, values_u32.data(), values_u32.size());
+            }
+            dfh::utils::append_simdcomp(output, index_map_u32.data(), values_length);
+
+            dfh::utils::append_vbyte<uint32_t>(output, deltas_u32.size());
+            dfh::utils::append_simdcomp(output, deltas_u32.data(), deltas_u32.size());
+        }
+        /// \brief Encodes all TickUpdateFlags bits as bitplanes.
+        /// \details Layout:
+        /// \code
+        /// [FLAG_PLANES_TAG][ones mask][varying mask][run-length mask]
+        /// for every varying plane: [vbyte size][vbyte runs...] or [bit-packed plane]
+        /// \endcode
+        /// Planes set on every tick or on none are described by the masks alone. Each varying
+        /// plane is packed into 32-tick words; runs of equal words are collapsed with
+        /// encode_run_length(), and the plane is stored bit-packed when that is not smaller.
+        /// \param output Buffer where encoded data will be written.
+        /// \param ticks Array of market ticks to encode.
+        /// \param num_ticks Number of ticks to encode.
+        /// \throws std::invalid_argument If a tick uses flag bits above bit 7.
+        void encode_tick_flags(
+                std::vector<uint8_t>& output,
+                const MarketTick* ticks,
+                size_t num_ticks) {
+            encode_tick_flags_impl(output, ticks, num_ticks);
+        }
+
+        /// \brief Encodes a contiguous flag column as bitplanes (see the overload above).
+        /// \param output Buffer where encoded data will be written.
+        /// \param flags Flags of the ticks (e.g. TickColumns::flags).
+        /// \param num_ticks Number of ticks to encode.
+        /// \throws std::invalid_argument If a tick uses flag bits above bit 7.
+        void encode_tick_flags(
+                std::vector<uint8_t>& output,
+                const TickUpdateFlags* flags,
+                size_t num_ticks) {
+            encode_tick_flags_impl(output, flags, num_ticks);
+        }
+
+        /// \brief Encodes the side flags indicating the direction of the trade.
+        /// \note Legacy format, kept for compatibility tests; only `TICK_FROM_BUY` is stored.
+        /// \param output Buffer where encoded data will be written.
+        /// \param ticks Array of market ticks to encode.
+        /// \param num_ticks Number of ticks to encode.
+        void encode_side_flags(
+                std::vector<uint8_t>& output,
+                const MarketTick* ticks,
+                size_t num_ticks) {
+            encode_side_flags_impl(output, ticks, num_ticks);
+        }
+
+        /// \brief Encodes the side flags of a contiguous flag column.
+        /// \param output Buffer where encoded data will be written.
+        /// \param flags Flags of the ticks (e.g. TickColumns::flags).
+        /// \param num_ticks Number of ticks to encode.
+        void encode_side_flags(
+                std::vector<uint8_t>& output,
+                const TickUpdateFlags* flags,
+                size_t num_ticks) {
+            encode_side_flags_impl(output, flags, num_ticks);
+        }
+
+    private:
+        TickCompressionContextV1& m_context; ///< Reference to the compression context for intermediate data.
+
+        /// \brief Returns the flags of a tick or of a flag column element.
+        static TickUpdateFlags tick_flags(const MarketTick& tick) { return tick.flags; }
+        static TickUpdateFlags tick_flags(TickUpdateFlags flags) { return flags; }
+
+        /// \brief Shared implementation of encode_price_last() for ticks and price columns.
+        template<class Source>
+        void encode_price_last_impl(
+                std::vector<uint8_t>& output,
+                const Source* ticks,
+                size_t num_ticks,
+                double price_scale,
+                int64_t initial_price) {
             auto &deltas_u32 = m_context.deltas_u32;
             auto &deltas_u64 = m_context.deltas_u64;
             auto &values_u32 = m_context.values_u32;
@@ -37,7 +271,7 @@ namespace dfh::compression {
             try {
                 deltas_u32.resize(num_ticks);
                 encode_last_delta_zig_zag_int32(ticks, deltas_u32.data(), num_ticks, price_scale, initial_price);
-                encode_frequency(deltas_u32.data(), deltas_u32.data(), num_ticks, values_u32, index_map_u32);
+                encode_frequency(deltas_u32.data(), deltas_u32.data(), num_ticks, values_u32, index_map_u32, m_context.frequency_u32);
 
                 size_t repeats_size = 0;
                 encode_zero_with_repeats(deltas_u32.data(), deltas_u32.size(), deltas_u32.data(), repeats_size);
@@ -60,7 +294,7 @@ namespace dfh::compression {
                 deltas_u64.resize(num_ticks);
                 deltas_u32.resize(num_ticks);
                 encode_last_delta_zig_zag_int64(ticks, deltas_u64.data(), num_ticks, price_scale, initial_price);
-                encode_frequency(deltas_u64.data(), deltas_u32.data(), num_ticks, values_u64, index_map_u32);
+                encode_frequency(deltas_u64.data(), deltas_u32.data(), num_ticks, values_u64, index_map_u32, m_context.frequency_u64);
 
                 size_t repeats_size = 0;
                 encode_zero_with_repeats(deltas_u32.data(), deltas_u32.size(), deltas_u32.data(), repeats_size);
@@ -81,14 +315,11 @@ namespace dfh::compression {
             }
         }
 
-        /// \brief Encodes the trade volume as delta values.
-        /// \param output Buffer where encoded data will be written.
-        /// \param ticks Array of market ticks to encode.
-        /// \param num_ticks Number of ticks to encode.
-        /// \param volume_scale Scaling factor for volume precision.
-        void encode_volume(
+        /// \brief Shared implementation of encode_volume() for ticks and volume columns.
+        template<class Source>
+        void encode_volume_impl(
                 std::vector<uint8_t>& output,
-                const MarketTick* ticks,
+                const Source* ticks,
                 size_t num_ticks,
                 double volume_scale) {
             auto &deltas_u32 = m_context.deltas_u32;
@@ -99,7 +330,7 @@ namespace dfh::compression {
             try {
                 deltas_u32.resize(num_ticks);
                 scale_volume_int32(ticks, deltas_u32.data(), num_ticks, volume_scale);
-                encode_frequency(deltas_u32.data(), deltas_u32.data(), num_ticks, values_u32, index_map_u32);
+                encode_frequency(deltas_u32.data(), deltas_u32.data(), num_ticks, values_u32, index_map_u32, m_context.frequency_u32);
 
                 size_t repeats_size = 0;
                 encode_zero_with_repeats(deltas_u32.data(), deltas_u32.size(), deltas_u32.data(), repeats_size);
@@ -122,7 +353,7 @@ namespace dfh::compression {
                 deltas_u64.resize(num_ticks);
                 deltas_u32.resize(num_ticks);
                 scale_volume_int64(ticks, deltas_u64.data(), num_ticks, volume_scale);
-                encode_frequency(deltas_u64.data(), deltas_u32.data(), num_ticks, values_u64, index_map_u32);
+                encode_frequency(deltas_u64.data(), deltas_u32.data(), num_ticks, values_u64, index_map_u32, m_context.frequency_u64);
 
                 size_t repeats_size = 0;
                 encode_zero_with_repeats(deltas_u32.data(), deltas_u32.size(), deltas_u32.data(), repeats_size);
@@ -143,23 +374,30 @@ namespace dfh::compression {
             }
         }
 
-        /// \brief Encodes the timestamp as delta values.
-        /// \param output Buffer where encoded data will be written.
-        /// \param ticks Array of market ticks to encode.
-        /// \param num_ticks Number of ticks to encode.
-        /// \param initial_time Initial timestamp for delta calculations.
-        void encode_time(
+        /// \brief Shared implementation of encode_time() for ticks and timestamp columns.
+        /// \details In delta-of-delta mode the column starts with a zero count, which plain
+        ///          columns never have (a segment holds at least one tick), followed by the usual
+        ///          layout over the Zig-Zag encoded second-order deltas. The mode falls back to
+        ///          plain deltas if a gap between ticks exceeds the int32 range.
+        /// \return True if second-order deltas were stored.
+        template<class Source>
+        bool encode_time_impl(
                 std::vector<uint8_t>& output,
-                const MarketTick* ticks,
+                const Source* ticks,
                 size_t num_ticks,
-                int64_t initial_time) {
+                int64_t initial_time,
+                bool delta_of_delta) {
             auto &deltas_u32 = m_context.deltas_u32;
             auto &values_u32 = m_context.values_u32;
             auto &index_map_u32 = m_context.index_map_u32;
 
             deltas_u32.resize(num_ticks);
             encode_time_delta(ticks, deltas_u32.data(), num_ticks, initial_time);
-            encode_frequency(deltas_u32.data(), deltas_u32.data(), num_ticks, values_u32, index_map_u32);
+            if (delta_of_delta) {
+                delta_of_delta = encode_delta_of_delta_int32(deltas_u32.data(), num_ticks);
+                if (delta_of_delta) dfh::utils::append_vbyte<uint32_t>(output, 0);
+            }
+            encode_frequency(deltas_u32.data(), deltas_u32.data(), num_ticks, values_u32, index_map_u32, m_context.frequency_u32);
 
             size_t repeats_size = 0;
             encode_zero_with_repeats(deltas_u32.data(), deltas_u32.size(), deltas_u32.data(), repeats_size);
@@ -174,15 +412,77 @@ namespace dfh::compression {
 
             dfh::utils::append_vbyte<uint32_t>(output, deltas_u32.size());
             dfh::utils::append_vbyte<uint32_t>(output, deltas_u32.data(), deltas_u32.size());
+            return delta_of_delta;
         }
 
-        /// \brief Encodes the side flags indicating the direction of the trade.
-        /// \param output Buffer where encoded data will be written.
-        /// \param ticks Array of market ticks to encode.
-        /// \param num_ticks Number of ticks to encode.
-        void encode_side_flags(
+        /// \brief Shared implementation of encode_tick_flags() for ticks and flag columns.
+        template<class Source>
+        void encode_tick_flags_impl(
                 std::vector<uint8_t>& output,
-                const MarketTick* ticks,
+                const Source* ticks,
+                size_t num_ticks) {
+            constexpr size_t num_planes = 8;
+            auto &words = m_context.deltas_u64;
+            auto &runs  = m_context.values_u64;
+            const size_t num_words   = (num_ticks + 31) / 32;
+            const size_t packed_size = (num_ticks + 7) / 8;
+
+            uint64_t any_set = 0;
+            uint64_t all_set = num_ticks ? ~uint64_t(0) : 0;
+            for (size_t i = 0; i < num_ticks; ++i) {
+                const uint64_t flags = static_cast<uint64_t>(tick_flags(ticks[i]));
+                any_set |= flags;
+                all_set &= flags;
+            }
+            if (any_set >> num_planes) {
+                throw std::invalid_argument("TickUpdateFlags above bit 7 cannot be encoded.");
+            }
+            const uint8_t varying_mask = static_cast<uint8_t>(any_set & ~all_set);
+
+            output.push_back(FLAG_PLANES_TAG);
+            output.push_back(static_cast<uint8_t>(all_set));
+            output.push_back(varying_mask);
+            const size_t rle_mask_offset = output.size();
+            output.push_back(0);
+            if (!varying_mask) return;
+
+            words.assign(num_planes * num_words, 0);
+            for (size_t i = 0; i < num_ticks; ++i) {
+                const uint64_t flags = static_cast<uint64_t>(tick_flags(ticks[i]));
+                const uint64_t bit = uint64_t(1) << (i & 31);
+                uint64_t* word = words.data() + (i >> 5);
+                for (size_t plane = 0; plane < num_planes; ++plane, word += num_words) {
+                    if ((flags >> plane) & 1) *word |= bit;
+                }
+            }
+
+            runs.resize(num_words);
+            for (size_t plane = 0; plane < num_planes; ++plane) {
+                if (!((varying_mask >> plane) & 1)) continue;
+                const uint64_t* plane_words = words.data() + plane * num_words;
+                size_t runs_size = 0;
+                encode_run_length(plane_words, num_words, runs.data(), runs_size);
+
+                const size_t plane_offset = output.size();
+                dfh::utils::append_vbyte<uint32_t>(output, static_cast<uint32_t>(runs_size));
+                dfh::utils::append_vbyte<uint64_t>(output, runs.data(), runs_size);
+                if (output.size() - plane_offset < packed_size) {
+                    output[rle_mask_offset] |= static_cast<uint8_t>(1 << plane);
+                    continue;
+                }
+
+                output.resize(plane_offset + packed_size);
+                for (size_t b = 0; b < packed_size; ++b) {
+                    output[plane_offset + b] = static_cast<uint8_t>(plane_words[b >> 2] >> ((b & 3) << 3));
+                }
+            }
+        }
+
+        /// \brief Shared implementation of encode_side_flags() for ticks and flag columns.
+        template<class Source>
+        void encode_side_flags_impl(
+                std::vector<uint8_t>& output,
+                const Source* ticks,
                 size_t num_ticks) {
             constexpr size_t chunk_width = sizeof(uint8_t);
             constexpr size_t bif_offset = 4;
@@ -194,20 +494,17 @@ namespace dfh::compression {
             size_t max_j, byte_index = start_offset;
             for (size_t i = 0; i < aligned_size; i += chunk_width, ++byte_index) {
                 max_j = i + chunk_width;
-                output[byte_index] = (static_cast<uint64_t>(ticks[i].flags) >> bif_offset) & 0x1;
+                output[byte_index] = (static_cast<uint64_t>(tick_flags(ticks[i])) >> bif_offset) & 0x1;
                 for (size_t j = i + 1; j < max_j; ++j) {
                     output[byte_index] <<= 1;
-                    output[byte_index] |= (static_cast<uint64_t>(ticks[j].flags) >> bif_offset) & 0x1;
+                    output[byte_index] |= (static_cast<uint64_t>(tick_flags(ticks[j])) >> bif_offset) & 0x1;
                 }
             }
 
             for (size_t bit_index = 0, i = aligned_size; i < num_ticks; ++i, ++bit_index) {
-                output[byte_index] |= ((static_cast<uint64_t>(ticks[i].flags) >> bif_offset) & 0x1) << bit_index;
+                output[byte_index] |= ((static_cast<uint64_t>(tick_flags(ticks[i])) >> bif_offset) & 0x1) << bit_index;
             }
         }
-
-    private:
-        TickCompressionContextV1& m_context; ///< Reference to the compression context for intermediate data.
     };
 
 }; // namespace dfh::compression
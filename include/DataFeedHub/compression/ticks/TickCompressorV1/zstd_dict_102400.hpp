@@ -6408,6 +6408,25 @@ namespace dfh::compression {
 		0x92, 0x80, 0x80, 0x80, 0x80, 0x00, 0x80, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01,
 		0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
 	};
+
+	/// \brief Returns the process-wide digested form of `zstd_dict_tick_compressor_v1_102400`.
+	/// \details The dictionary is digested on first use and shared by all TickCompressorV1 instances.
+	inline const ZstdDictionary& zstd_dictionary_tick_compressor_v1() {
+		static const ZstdDictionary dictionary(
+			zstd_dict_tick_compressor_v1_102400,
+			sizeof(zstd_dict_tick_compressor_v1_102400));
+		return dictionary;
+	}
+
+	/// \brief Resolves the dictionary of a tick segment or of a tick compressor.
+	/// \param dictionary_id ZSTD dictionary ID; 0 and the ID of the built-in dictionary select
+	///        the built-in dictionary, other IDs are looked up in ZstdDictionaryRegistry::instance().
+	/// \throws std::runtime_error If the dictionary is not registered.
+	inline const ZstdDictionary& tick_zstd_dictionary(uint32_t dictionary_id) {
+		const ZstdDictionary& builtin = zstd_dictionary_tick_compressor_v1();
+		if (dictionary_id == 0 || dictionary_id == builtin.id()) return builtin;
+		return ZstdDictionaryRegistry::instance().get(dictionary_id);
+	}
 }
 
 #endif // ZSTD_DICT_102400_HPP_INCLUDED
@@ -0,0 +1,401 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_TICK_COMPRESSOR_V2_HPP_INCLUDED
+#define _DFH_COMPRESSION_TICK_COMPRESSOR_V2_HPP_INCLUDED
+
+/// \file TickCompressorV2.hpp
+/// \brief Provides functionality for compressing and decompressing bid/ask quote ticks.
+
+#include "TickCompressorV2/TickEncoderV2.hpp"
+#include "TickCompressorV2/TickDecoderV2.hpp"
+
+namespace dfh::compression {
+
+    /// \class TickCompressorV2
+    /// \brief Implements compression of L1 quote ticks (independent `ask`/`bid`) using ZSTD.
+    ///
+    /// Ask and bid are stored as a shared mid-delta stream plus a spread stream, expressed in
+    /// tick-size units when all prices are aligned to the tick size. Volume and time reuse the
+    /// columns of TickEncoderV1/TickDecoderV1. The following fields are supported:
+    /// - **Ask / bid**: best quote prices.
+    /// - **Volume** (optional, `ENABLE_VOLUME`).
+    /// - **BID_UPDATED / ASK_UPDATED** flags (optional, `ENABLE_TICK_FLAGS`).
+    ///
+    /// \note The `last` price is not stored; use TickCompressorV1 for trade-based data.
+    class TickCompressorV2 final : public ITickSerializer {
+    public:
+
+        /// \brief Constructs the TickCompressorV2 object.
+        TickCompressorV2()
+            : m_context(),
+              m_encoder_v1(m_context), m_decoder_v1(m_context),
+              m_encoder(m_context), m_decoder(m_context) {
+        }
+
+        /// \copydoc ITickSerializer::set_codec_config()
+        void set_codec_config(const TickCodecConfig& config) override final {
+            m_config = config;
+        }
+
+        /// \copydoc ITickSerializer::codec_config()
+        const TickCodecConfig& codec_config() const override final {
+            return m_config;
+        }
+
+        /// \brief Selects the ZSTD dictionary used for compression.
+        /// \details Decompression always uses the dictionary named in the segment's ZSTD frame header.
+        /// \param dictionary_id ID of a dictionary in ZstdDictionaryRegistry::instance(); 0 selects
+        ///        the built-in dictionary.
+        void set_dictionary_id(uint32_t dictionary_id) {
+            m_dictionary_id = dictionary_id;
+        }
+
+        /// \brief Returns the ID of the ZSTD dictionary used for compression (0 for the built-in dictionary).
+        uint32_t dictionary_id() const noexcept {
+            return m_dictionary_id;
+        }
+
+        /// \copydoc ITickSerializer::is_valid_signature()
+        bool is_valid_signature(const std::vector<uint8_t>& input) const override final {
+            if (input.empty()) return false; // No data to check.
+            return input[0] == SIGNATURE;
+        }
+
+        /// \copydoc ITickSerializer::serialize(const std::vector<MarketTick>&, std::vector<uint8_t>&)
+        /// \throw std::invalid_argument if the configuration is invalid (e.g., precision exceeds allowed digits).
+        void serialize(
+            const std::vector<MarketTick>& ticks,
+            std::vector<uint8_t>& output) override final {
+            compress(ticks, output);
+        }
+
+        /// \copydoc ITickSerializer::serialize(const std::vector<MarketTick>&, const TickCodecConfig&, std::vector<uint8_t>&)
+        /// \throw std::invalid_argument if the configuration is invalid (e.g., precision exceeds allowed digits).
+        void serialize(
+            const std::vector<MarketTick>& ticks,
+            const TickCodecConfig& config,
+            std::vector<uint8_t>& output) override final {
+            set_codec_config(config);
+            compress(ticks, output);
+        }
+
+        using ITickSerializer::deserialize;
+
+        /// \copydoc ITickSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&)
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+            const std::vector<uint8_t>& input,
+            std::vector<MarketTick>& ticks) override final {
+            decompress(input, ticks);
+        }
+
+        /// \copydoc ITickSerializer::deserialize(const std::vector<uint8_t>&, std::vector<MarketTick>&, TickCodecConfig&)
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+            const std::vector<uint8_t>& input,
+            std::vector<MarketTick>& ticks,
+            TickCodecConfig& config) override final {
+            decompress(input, ticks);
+            config = m_config;
+        }
+
+        /// \copydoc ITickSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketTick>&)
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<MarketTick>& ticks) override final {
+            decompress_impl(data, size, ticks);
+        }
+
+        /// \copydoc ITickSerializer::deserialize(const uint8_t*, size_t, std::vector<MarketTick>&, TickCodecConfig&)
+        /// \throw std::runtime_error if decompression fails.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<MarketTick>& ticks,
+                TickCodecConfig& config) override final {
+            decompress_impl(data, size, ticks);
+            config = m_config;
+        }
+
+        /// \copydoc ITickSerializer::decode_into()
+        /// \throw std::runtime_error if decompression fails.
+        size_t decode_into(
+                const uint8_t* data,
+                size_t size,
+                MarketTick* ticks,
+                size_t capacity) override final {
+            if (size == 0) return 0;
+            if (extract_num_samples(data, size) > capacity) {
+                throw std::length_error("Tick buffer is too small for the segment.");
+            }
+            detail::TickBuffer output{ticks, capacity, 0};
+            decompress_impl(data, size, output);
+            return output.count;
+        }
+
+        /// \brief Re-encodes the ZSTD stage of a compressed segment with another profile.
+        /// \details The new frame uses the dictionary selected with set_dictionary_id().
+        /// \param input Segment produced by this compressor.
+        /// \param profile Target compression profile.
+        /// \param output Vector where the recompressed segment will be appended.
+        /// \throw std::invalid_argument if the input signature does not match.
+        /// \throw std::runtime_error if decompression or compression fails.
+        void recompress(
+                const std::vector<uint8_t>& input,
+                TickCompressionProfile profile,
+                std::vector<uint8_t>& output) {
+            if (!is_valid_signature(input)) {
+                throw std::invalid_argument("Invalid data signature. Expected TickCompressorV2 data.");
+            }
+            m_context.reset();
+            const ZstdDictionary& source = tick_zstd_dictionary(extract_zstd_dictionary_id(input.data(), input.size()));
+            const ZstdDictionary& target = tick_zstd_dictionary(m_dictionary_id);
+            recompress_zstd_data(
+                m_context.zstd.dctx(), source.ddict(),
+                m_context.zstd.cctx(), target.cdict(zstd_compression_level(profile)),
+                input.data(), input.size(),
+                m_context.processing_buffer,
+                output);
+        }
+
+    private:
+        static constexpr uint8_t SIGNATURE = 0x02; ///< Signature byte of the TickCompressorV2 format.
+
+        /// \brief Compresses quote tick data.
+        /// \param ticks A vector of MarketTick structures representing the tick data.
+        /// \param output A vector where the compressed data will be stored.
+        /// \throw std::invalid_argument if the configuration is invalid (e.g., precision exceeds allowed digits).
+        void compress(
+                const std::vector<MarketTick>& ticks,
+                std::vector<uint8_t>& output) {
+            if (ticks.empty()) return;
+
+            constexpr uint16_t max_digits = 18;
+            if (m_config.price_digits > max_digits ||
+                m_config.volume_digits > max_digits) {
+                throw std::invalid_argument("Price or volume digits exceed maximum allowed digits.");
+            }
+
+            m_context.reset();
+
+            auto& buffer = m_context.processing_buffer;
+
+            const double price_scale = dfh::utils::pow10<double>(m_config.price_digits);
+            const int64_t tick_size = std::llround(m_config.tick_size * price_scale);
+
+            bool tick_units = tick_size > 1;
+            for (size_t i = 0; tick_units && i < ticks.size(); ++i) {
+                tick_units = (std::llround(ticks[i].ask * price_scale) % tick_size) == 0 &&
+                             (std::llround(ticks[i].bid * price_scale) % tick_size) == 0;
+            }
+            const int64_t price_unit = tick_units ? tick_size : 1;
+
+            uint8_t header = 0x00;
+            // Bits 0-4: Number of decimal places for the price
+            // Bit 5: ENABLE_TICK_FLAGS — whether BID_UPDATED/ASK_UPDATED are encoded
+            // Bit 6: Reserved
+            // Bit 7: ENABLE_VOLUME — whether volume compression is enabled
+            header |= (m_config.price_digits & 0x1F);
+            header |= (m_config.has_flag(TickStorageFlags::ENABLE_TICK_FLAGS) << 5) & 0x20;
+            header |= (m_config.has_flag(TickStorageFlags::ENABLE_VOLUME) << 7) & 0x80;
+            buffer.push_back(header);
+
+            // Bits 0-4: Number of decimal places for the volume
+            // Bit 5: Prices are stored in tick-size units
+            // Bit 6: ENABLE_RECV_TIME — whether the receive latency stream is encoded
+            header = 0x00;
+            header |= (m_config.volume_digits & 0x1F);
+            header |= (tick_units << 5) & 0x20;
+            header |= (m_config.has_flag(TickStorageFlags::ENABLE_RECV_TIME) << 6) & 0x40;
+            buffer.push_back(header);
+
+            constexpr uint64_t interval_ms = 3600000ULL;
+            const uint64_t base_unix_hour = (ticks[0].time_ms / interval_ms);
+            const uint64_t base_unix_time = base_unix_hour * interval_ms;
+
+            dfh::utils::append_vbyte<uint32_t>(buffer, base_unix_hour);
+            dfh::utils::append_vbyte<uint64_t>(buffer, encode_zig_zag_int64((int64_t)m_config.expiration_time_ms - (int64_t)base_unix_time));
+            dfh::utils::append_vbyte<uint64_t>(buffer, encode_zig_zag_int64((int64_t)m_config.next_expiration_time_ms - (int64_t)base_unix_time));
+
+            const int64_t initial_sum =
+                std::llround(ticks[0].ask * price_scale) / price_unit +
+                std::llround(ticks[0].bid * price_scale) / price_unit;
+
+            dfh::utils::append_vbyte<uint64_t>(buffer, encode_zig_zag_int64(initial_sum));
+            dfh::utils::append_vbyte<uint64_t>(buffer, tick_size);
+
+            m_encoder.encode_quote_prices(
+                buffer,
+                ticks.data(),
+                ticks.size(),
+                price_scale,
+                price_unit,
+                initial_sum);
+
+            if (m_config.has_flag(TickStorageFlags::ENABLE_VOLUME)) {
+                m_encoder_v1.encode_volume(
+                    buffer,
+                    ticks.data(),
+                    ticks.size(),
+                    dfh::utils::pow10<double>(m_config.volume_digits));
+            }
+
+            m_encoder_v1.encode_time(
+                buffer,
+                ticks.data(),
+                ticks.size(),
+                base_unix_time,
+                m_config.has_flag(TickStorageFlags::DELTA_OF_DELTA_TIME));
+
+            if (m_config.has_flag(TickStorageFlags::ENABLE_RECV_TIME)) {
+                m_encoder_v1.encode_recv_latency(buffer, ticks.data(), ticks.size());
+            }
+
+            if (m_config.has_flag(TickStorageFlags::ENABLE_TICK_FLAGS)) {
+                m_encoder.encode_quote_flags(buffer, ticks.data(), ticks.size());
+            }
+
+            compress_zstd_data(
+                m_context.zstd.cctx(),
+                tick_zstd_dictionary(m_dictionary_id).cdict(
+                    zstd_compression_level(m_config.compression_profile)),
+                buffer.data(), buffer.size(),
+                SIGNATURE,
+                ticks.size(),
+                output);
+        }
+
+        /// \brief Decompresses quote tick data.
+        /// \param input A vector of compressed data.
+        /// \param ticks A vector where the decompressed MarketTick data will be stored.
+        /// \throw std::runtime_error if decompression fails.
+        /// \note This function **appends** new ticks to `ticks` without clearing its contents.
+        void decompress(
+                const std::vector<uint8_t>& input,
+                std::vector<MarketTick>& ticks) {
+            decompress_impl(input.data(), input.size(), ticks);
+        }
+
+        /// \brief Decompresses quote tick data into MarketTick records.
+        /// \param data Pointer to the compressed segment.
+        /// \param size Size of the compressed segment.
+        /// \param ticks `std::vector<MarketTick>` or detail::TickBuffer where the ticks will be appended.
+        /// \throw std::runtime_error if decompression fails.
+        template<class Output>
+        void decompress_impl(
+                const uint8_t* data,
+                size_t size,
+                Output& ticks) {
+            if (size == 0) return;
+            if (data[0] != SIGNATURE) {
+                throw std::invalid_argument(
+                    "Invalid data signature. The input data does not match the expected format. "
+                    "Ensure that the data was compressed using the correct version of the compressor."
+                );
+            }
+
+            size_t offset = 1;
+            const size_t num_ticks = dfh::utils::extract_vbyte<uint32_t>(data, offset);
+
+            m_context.reset();
+            auto& buffer = m_context.processing_buffer;
+
+            decompress_zstd_data(
+                m_context.zstd.dctx(),
+                tick_zstd_dictionary(extract_zstd_dictionary_id(data, size)).ddict(),
+                data + offset, size - offset,
+                buffer);
+
+            offset = 0;
+            uint8_t header = buffer[offset++];
+            m_config.flags = TickStorageFlags::NONE;
+            m_config.price_digits = header & 0x1F;
+            m_config.set_flag(TickStorageFlags::ENABLE_TICK_FLAGS, (header & 0x20) != 0);
+            const bool enable_volume = (header & 0x80) != 0;
+            m_config.set_flag(TickStorageFlags::ENABLE_VOLUME, enable_volume);
+
+            header = buffer[offset++];
+            m_config.volume_digits = header & 0x1F;
+            const bool tick_units  = (header & 0x20) != 0;
+            const bool enable_recv_time = (header & 0x40) != 0;
+            m_config.set_flag(TickStorageFlags::ENABLE_RECV_TIME, enable_recv_time);
+
+            constexpr uint64_t interval_ms = 3600000ULL;
+            const uint64_t base_unix_hour = dfh::utils::extract_vbyte<uint32_t>(buffer.data(), offset);
+            const uint64_t base_unix_time    = base_unix_hour * interval_ms;
+            m_config.expiration_time_ms      = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(buffer.data(), offset));
+            m_config.next_expiration_time_ms = base_unix_time + decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(buffer.data(), offset));
+
+            const int64_t initial_sum    = decode_zig_zag_int64(dfh::utils::extract_vbyte<uint64_t>(buffer.data(), offset));
+            const int64_t tick_size      = static_cast<int64_t>(dfh::utils::extract_vbyte<uint64_t>(buffer.data(), offset));
+            const double  price_scale    = dfh::utils::pow10<double>(m_config.price_digits);
+            m_config.tick_size           = price_scale == 0.0 ? 0.0 : (double)tick_size / price_scale;
+            const size_t initial_size    = ticks.size();
+            ticks.resize(initial_size + num_ticks);
+
+            MarketTick* ticks_ptr = output_at(ticks, initial_size);
+
+            m_decoder.decode_quote_prices(
+                ticks_ptr,
+                buffer.data(),
+                offset,
+                num_ticks,
+                price_scale,
+                tick_units ? tick_size : 1,
+                initial_sum);
+
+            if (enable_volume) {
+                m_decoder_v1.decode_volume(
+                    ticks_ptr,
+                    buffer.data(),
+                    offset,
+                    num_ticks,
+                    dfh::utils::pow10<double>(m_config.volume_digits));
+            }
+
+            const bool delta_of_delta = m_decoder_v1.decode_time(
+                ticks_ptr,
+                buffer.data(),
+                offset,
+                num_ticks,
+                base_unix_time);
+            m_config.set_flag(TickStorageFlags::DELTA_OF_DELTA_TIME, delta_of_delta);
+
+            if (enable_recv_time) {
+                m_decoder_v1.decode_recv_latency(
+                    ticks_ptr,
+                    buffer.data(),
+                    offset,
+                    num_ticks);
+            }
+
+            if (m_config.has_flag(TickStorageFlags::ENABLE_TICK_FLAGS)) {
+                m_decoder.decode_quote_flags(
+                    ticks_ptr,
+                    buffer.data(),
+                    offset,
+                    num_ticks);
+                if (enable_volume) {
+                    for (size_t i = 0; i < num_ticks; ++i) {
+                        ticks_ptr[i].flags |= TickUpdateFlags::VOLUME_UPDATED;
+                    }
+                }
+            }
+        }
+
+        static MarketTick* output_at(std::vector<MarketTick>& ticks, size_t offset) { return ticks.data() + offset; }
+        static MarketTick* output_at(detail::TickBuffer& ticks, size_t offset) { return ticks.data + offset; }
+
+        TickCompressionContextV1  m_context;    ///< Compression context containing intermediate buffers.
+        TickEncoderV1             m_encoder_v1; ///< Encoder for volume and time columns.
+        TickDecoderV1             m_decoder_v1; ///< Decoder for volume and time columns.
+        TickEncoderV2             m_encoder;    ///< Encoder for quote prices and flags.
+        TickDecoderV2             m_decoder;    ///< Decoder for quote prices and flags.
+        TickCodecConfig           m_config;     ///< Configuration for encoding/decoding.
+        uint32_t                  m_dictionary_id = 0; ///< ZSTD dictionary used for compression (0 = built-in).
+    }; // TickCompressorV2
+
+}; // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_TICK_COMPRESSOR_V2_HPP_INCLUDED
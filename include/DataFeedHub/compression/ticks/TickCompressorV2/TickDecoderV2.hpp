@@ -0,0 +1,84 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_TICK_COMPRESSOR_V2_TICK_DECODER_V2_HPP_INCLUDED
+#define _DFH_COMPRESSION_TICK_COMPRESSOR_V2_TICK_DECODER_V2_HPP_INCLUDED
+
+/// \file TickDecoderV2.hpp
+/// \brief Defines the decoder for bid/ask quote data in the TickCompressorV2 system.
+
+namespace dfh::compression {
+
+    /// \class TickDecoderV2
+    /// \brief Decodes bid/ask quotes encoded by TickEncoderV2.
+    class TickDecoderV2 {
+    public:
+        /// \brief Constructs a TickDecoderV2 with a given compression context.
+        /// \param context The compression context used for intermediate data during decoding.
+        explicit TickDecoderV2(TickCompressionContextV1& context)
+            : m_context(context), m_column_decoder(context) {}
+
+        /// \brief Decodes ask and bid prices.
+        /// \param ticks The array to store decompressed tick data.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        /// \param price_scale The scaling factor for price precision.
+        /// \param price_unit Scaled price unit used by the encoder.
+        /// \param initial_sum Value of `ask + bid` (in price units) preceding the first tick.
+        void decode_quote_prices(
+                MarketTick* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks,
+                double price_scale,
+                int64_t price_unit,
+                int64_t initial_sum) {
+            auto &deltas_u64 = m_context.deltas_u64;
+            auto &accum_u64 = m_context.accum_u64;
+
+            m_column_decoder.decode_zig_zag_column(binary, offset, num_ticks);
+            accum_u64.resize(num_ticks);
+            int64_t sum = initial_sum;
+            for (size_t i = 0; i < num_ticks; ++i) {
+                sum += decode_zig_zag_int64(deltas_u64[i]);
+                accum_u64[i] = static_cast<uint64_t>(sum);
+            }
+
+            m_column_decoder.decode_zig_zag_column(binary, offset, num_ticks);
+            const double inv_price_scale = 1.0 / price_scale;
+            for (size_t i = 0; i < num_ticks; ++i) {
+                const int64_t spread = decode_zig_zag_int64(deltas_u64[i]);
+                const int64_t mid2 = static_cast<int64_t>(accum_u64[i]);
+                ticks[i].ask = static_cast<double>(((mid2 + spread) / 2) * price_unit) * inv_price_scale;
+                ticks[i].bid = static_cast<double>(((mid2 - spread) / 2) * price_unit) * inv_price_scale;
+            }
+        }
+
+        /// \brief Decodes BID_UPDATED and ASK_UPDATED flags, 2 bits per tick.
+        /// \param ticks The array to store decompressed tick data.
+        /// \param binary The binary data buffer containing compressed data.
+        /// \param offset The current offset in the binary buffer, updated after decoding.
+        /// \param num_ticks The number of ticks to decode.
+        void decode_quote_flags(
+                MarketTick* ticks,
+                const uint8_t* binary,
+                size_t& offset,
+                size_t num_ticks) {
+            constexpr uint64_t quote_mask =
+                static_cast<uint64_t>(TickUpdateFlags::BID_UPDATED) |
+                static_cast<uint64_t>(TickUpdateFlags::ASK_UPDATED);
+            const uint8_t* data = binary + offset;
+            for (size_t i = 0; i < num_ticks; ++i) {
+                const uint64_t bits = (data[i >> 2] >> ((i & 3) << 1)) & quote_mask;
+                ticks[i].flags = (ticks[i].flags & ~quote_mask) | bits;
+            }
+            offset += (num_ticks + 3) / 4;
+        }
+
+    private:
+        TickCompressionContextV1& m_context; ///< Reference to the compression context for intermediate data.
+        TickDecoderV1             m_column_decoder; ///< Shared Zig-Zag column decoder.
+    }; // TickDecoderV2
+
+}; // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_TICK_COMPRESSOR_V2_TICK_DECODER_V2_HPP_INCLUDED
@@ -0,0 +1,89 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_TICK_COMPRESSOR_V2_TICK_ENCODER_V2_HPP_INCLUDED
+#define _DFH_COMPRESSION_TICK_COMPRESSOR_V2_TICK_ENCODER_V2_HPP_INCLUDED
+
+/// \file TickEncoderV2.hpp
+/// \brief Defines the encoder for bid/ask quote data in the TickCompressorV2 system.
+
+namespace dfh::compression {
+
+    /// \class TickEncoderV2
+    /// \brief Encodes bid/ask quotes as a mid-delta stream and a spread stream.
+    ///
+    /// Prices are scaled to integers and, when possible, divided by the tick size.
+    /// For each tick the encoder stores:
+    /// - delta of `ask + bid` (twice the mid price) relative to the previous tick;
+    /// - `ask - bid` (spread).
+    /// Both streams are Zig-Zag encoded and passed through the same
+    /// frequency / zero-repeat / simdcomp pipeline as the last price in TickEncoderV1.
+    class TickEncoderV2 {
+    public:
+
+        /// \brief Constructs a TickEncoderV2 with a given compression context.
+        /// \param context The compression context used for intermediate data.
+        explicit TickEncoderV2(TickCompressionContextV1& context)
+            : m_context(context), m_column_encoder(context) {}
+
+        /// \brief Encodes ask and bid prices.
+        /// \param output The buffer where encoded data will be written.
+        /// \param ticks The array of market ticks to encode.
+        /// \param num_ticks The number of ticks to encode.
+        /// \param price_scale The scaling factor for price precision.
+        /// \param price_unit Scaled price unit (scaled tick size, or 1 if prices are not tick-aligned).
+        /// \param initial_sum Value of `ask + bid` (in price units) preceding the first tick.
+        void encode_quote_prices(
+                std::vector<uint8_t>& output,
+                const MarketTick* ticks,
+                size_t num_ticks,
+                double price_scale,
+                int64_t price_unit,
+                int64_t initial_sum) {
+            auto &deltas_u64 = m_context.deltas_u64;
+            deltas_u64.resize(num_ticks);
+
+            int64_t prev_sum = initial_sum;
+            for (size_t i = 0; i < num_ticks; ++i) {
+                const int64_t ask = std::llround(ticks[i].ask * price_scale) / price_unit;
+                const int64_t bid = std::llround(ticks[i].bid * price_scale) / price_unit;
+                const int64_t sum = ask + bid;
+                deltas_u64[i] = encode_zig_zag_int64(sum - prev_sum);
+                prev_sum = sum;
+            }
+            m_column_encoder.encode_zig_zag_column(output, num_ticks);
+
+            deltas_u64.resize(num_ticks);
+            for (size_t i = 0; i < num_ticks; ++i) {
+                const int64_t ask = std::llround(ticks[i].ask * price_scale) / price_unit;
+                const int64_t bid = std::llround(ticks[i].bid * price_scale) / price_unit;
+                deltas_u64[i] = encode_zig_zag_int64(ask - bid);
+            }
+            m_column_encoder.encode_zig_zag_column(output, num_ticks);
+        }
+
+        /// \brief Encodes BID_UPDATED and ASK_UPDATED flags, 2 bits per tick.
+        /// \param output Buffer where encoded data will be written.
+        /// \param ticks Array of market ticks to encode.
+        /// \param num_ticks Number of ticks to encode.
+        void encode_quote_flags(
+                std::vector<uint8_t>& output,
+                const MarketTick* ticks,
+                size_t num_ticks) {
+            constexpr uint64_t quote_mask =
+                static_cast<uint64_t>(TickUpdateFlags::BID_UPDATED) |
+                static_cast<uint64_t>(TickUpdateFlags::ASK_UPDATED);
+            const size_t start_offset = output.size();
+            output.resize(start_offset + (num_ticks + 3) / 4, 0);
+            for (size_t i = 0; i < num_ticks; ++i) {
+                const uint8_t bits = static_cast<uint8_t>(static_cast<uint64_t>(ticks[i].flags) & quote_mask);
+                output[start_offset + (i >> 2)] |= static_cast<uint8_t>(bits << ((i & 3) << 1));
+            }
+        }
+
+    private:
+        TickCompressionContextV1& m_context; ///< Reference to the compression context for intermediate data.
+        TickEncoderV1             m_column_encoder; ///< Shared Zig-Zag column encoder.
+    }; // TickEncoderV2
+
+}; // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_TICK_COMPRESSOR_V2_TICK_ENCODER_V2_HPP_INCLUDED
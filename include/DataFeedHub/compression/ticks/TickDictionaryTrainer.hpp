@@ -0,0 +1,112 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_TICK_DICTIONARY_TRAINER_HPP_INCLUDED
+#define _DFH_COMPRESSION_TICK_DICTIONARY_TRAINER_HPP_INCLUDED
+
+/// \file TickDictionaryTrainer.hpp
+/// \brief Trains ZSTD dictionaries from stored tick segments.
+
+#include <random>
+
+namespace dfh::compression {
+
+    /// \class TickDictionaryTrainer
+    /// \brief Samples compressed tick segments and trains a ZSTD dictionary from them.
+    ///
+    /// Each segment produced by TickCompressorV1 or TickCompressorV2 is unpacked to the column
+    /// payload that enters the ZSTD stage, which is what a dictionary has to model. At most
+    /// `max_samples` payloads are kept (reservoir sampling), so a whole market class can be
+    /// streamed through the trainer. Typical use:
+    /// \code
+    /// TickDictionaryTrainer trainer;
+    /// for (const auto& segment : stored_segments) trainer.add_segment(segment);
+    /// std::vector<uint8_t> dictionary = trainer.train();
+    /// const uint32_t id = ZstdDictionaryRegistry::instance().add(dictionary);
+    /// serializer.set_dictionary_id(id);
+    /// \endcode
+    /// The dictionary bytes should also be stored (e.g. with ZstdDictionaryBD) so that other
+    /// processes can register the dictionary before decoding.
+    ///
+    /// \thread_safety Not thread-safe.
+    class TickDictionaryTrainer {
+    public:
+        /// \brief Constructs the trainer.
+        /// \param max_samples Maximum number of segment payloads kept for training.
+        /// \param seed Seed of the reservoir sampling.
+        explicit TickDictionaryTrainer(size_t max_samples = 4096, uint64_t seed = 0)
+            : m_max_samples(std::max<size_t>(max_samples, 1)), m_rng(seed) {
+        }
+
+        /// \brief Adds a compressed tick segment to the sample set.
+        /// \param segment Segment produced by TickCompressorV1 or TickCompressorV2.
+        /// \throws std::invalid_argument If the segment is not ZSTD-compressed tick data.
+        /// \throws std::runtime_error If the dictionary of the segment is unknown or decompression fails.
+        void add_segment(const std::vector<uint8_t>& segment) {
+            if (segment.empty()) return;
+            if (segment[0] != TICK_COMPRESSOR_V1_SIGNATURE && segment[0] != TICK_COMPRESSOR_V2_SIGNATURE) {
+                throw std::invalid_argument("Only compressed tick segments can be used for dictionary training.");
+            }
+
+            size_t slot = m_samples.size();
+            if (m_num_segments >= m_max_samples) {
+                slot = static_cast<size_t>(m_rng() % (m_num_segments + 1));
+            }
+            ++m_num_segments;
+            if (slot >= m_max_samples) return;
+
+            size_t offset = 1;
+            dfh::utils::extract_vbyte<uint32_t>(segment.data(), offset);
+            const ZstdDictionary& dictionary = tick_zstd_dictionary(
+                extract_zstd_dictionary_id(segment.data(), segment.size()));
+            decompress_zstd_data(
+                m_zstd.dctx(), dictionary.ddict(),
+                segment.data() + offset, segment.size() - offset,
+                m_payload);
+            if (m_payload.empty()) return;
+
+            if (slot == m_samples.size()) {
+                m_samples.push_back(m_payload);
+            } else {
+                m_samples[slot] = m_payload;
+            }
+        }
+
+        /// \brief Returns the number of segments passed to add_segment().
+        size_t num_segments() const noexcept {
+            return m_num_segments;
+        }
+
+        /// \brief Returns the number of payloads kept for training.
+        size_t num_samples() const noexcept {
+            return m_samples.size();
+        }
+
+        /// \brief Trains a dictionary from the sampled payloads.
+        /// \param dict_capacity Maximum dictionary size in bytes.
+        /// \return Dictionary in ZDICT format, ready for ZstdDictionaryRegistry::add().
+        /// \throws std::invalid_argument If no segments were added.
+        /// \throws std::runtime_error If training fails (typically too few samples).
+        std::vector<uint8_t> train(size_t dict_capacity = 102400) const {
+            return train_zstd(m_samples, dict_capacity);
+        }
+
+        /// \brief Drops all samples.
+        void clear() {
+            m_samples.clear();
+            m_num_segments = 0;
+        }
+
+    private:
+        static constexpr uint8_t TICK_COMPRESSOR_V1_SIGNATURE = 0x01;
+        static constexpr uint8_t TICK_COMPRESSOR_V2_SIGNATURE = 0x02;
+
+        size_t                            m_max_samples;      ///< Reservoir size.
+        size_t                            m_num_segments = 0; ///< Segments seen so far.
+        std::mt19937_64                   m_rng;              ///< Reservoir sampling generator.
+        std::vector<std::vector<uint8_t>> m_samples;          ///< Sampled column payloads.
+        std::vector<uint8_t>              m_payload;          ///< Decompression buffer.
+        ZstdCodecContext                  m_zstd;             ///< Reusable decompression context.
+    };
+
+} // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_TICK_DICTIONARY_TRAINER_HPP_INCLUDED
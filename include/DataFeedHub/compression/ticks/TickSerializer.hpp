@@ -7,11 +7,54 @@
 
 namespace dfh::compression {
 
+    /// \struct TickCodecStats
+    /// \brief Counts which codec won the per-segment selection of `AUTO_CODEC` mode.
+    struct TickCodecStats {
+        uint64_t raw_binary    = 0; ///< Segments stored by `TickBinarySerializerV1`.
+        uint64_t compressor_v1 = 0; ///< Segments stored by `TickCompressorV1`.
+        uint64_t compressor_v2 = 0; ///< Segments stored by `TickCompressorV2`.
+        uint64_t raw_trials    = 0; ///< Segments for which the raw binary encoding was actually built.
+        uint64_t output_bytes  = 0; ///< Total size of the selected encodings.
+
+        /// \brief Returns the number of segments encoded in `AUTO_CODEC` mode.
+        uint64_t segments() const noexcept {
+            return raw_binary + compressor_v1 + compressor_v2;
+        }
+
+        /// \brief Adds the counters of another instance.
+        TickCodecStats& operator+=(const TickCodecStats& other) noexcept {
+            raw_binary    += other.raw_binary;
+            compressor_v1 += other.compressor_v1;
+            compressor_v2 += other.compressor_v2;
+            raw_trials    += other.raw_trials;
+            output_bytes  += other.output_bytes;
+            return *this;
+        }
+    };
+
     /// \class TickSerializer
     /// \brief Automatically selects and applies the appropriate serializer.
     ///
-    /// This class chooses the correct serializer (`TickCompressorV1` or `TickBinarySerializerV1`)
-    /// based on the flags set in `TickCodecConfig`. It provides a unified interface for serialization.
+    /// This class chooses the correct serializer (`TickCompressorV1`, `TickCompressorV2` or
+    /// `TickBinarySerializerV1`) based on the flags set in `TickCodecConfig`. It provides a unified
+    /// interface for serialization:
+    /// - `STORE_RAW_BINARY` selects `TickBinarySerializerV1`;
+    /// - `TRADE_BASED` selects `TickCompressorV1` (last price, volume, side);
+    /// - otherwise quote ticks are compressed by `TickCompressorV2` (ask/bid).
+    ///
+    /// With `AUTO_CODEC` the compressor is still selected by `TRADE_BASED`, but each segment is
+    /// stored in raw binary form instead when that is smaller, which happens for illiquid symbols
+    /// with only a few ticks per segment where the compressor's headers and ZSTD frame dominate.
+    /// The raw encoding is only built when the compressed segment exceeds its lower size bound
+    /// (`sizeof(MarketTick)` per tick). The decision is recorded by the signature byte of the
+    /// segment and counted in auto_stats().
+    ///
+    /// With `BLOCK_INDEX` each segment is split into blocks (one per `block_ms` window, at most
+    /// `max_block_ticks` ticks, see set_block_layout()) that are encoded independently as
+    /// described above and stored behind a TickBlockIndex. deserialize_range() then decodes only
+    /// the blocks overlapping the requested time range.
+    ///
+    /// On deserialization the serializer is chosen by the signature byte.
     class TickSerializer final : public ITickSerializer {
     public:
 
@@ -23,6 +66,7 @@ namespace dfh::compression {
         void set_codec_config(const dfh::TickCodecConfig& config) override final {
             select_serializer(config);
             m_serializer->set_codec_config(config);
+            select_modes(config);
         }
 
         /// \brief Gets the current configuration.
@@ -32,12 +76,44 @@ namespace dfh::compression {
             return m_serializer ? m_serializer->codec_config() : empty_config;
         }
 
+        /// \brief Selects the ZSTD dictionary used by the tick compressors.
+        /// \param dictionary_id ID of a dictionary in ZstdDictionaryRegistry::instance(); 0 selects
+        ///        the built-in dictionary. Decompression follows the dictionary ID of each segment.
+        void set_dictionary_id(uint32_t dictionary_id) {
+            m_tick_compressor_v1.set_dictionary_id(dictionary_id);
+            m_tick_compressor_v2.set_dictionary_id(dictionary_id);
+        }
+
+        /// \brief Sets how `BLOCK_INDEX` segments are split into blocks.
+        /// \param block_ms Blocks end at multiples of this duration; 0 disables the time limit.
+        /// \param max_block_ticks Maximum number of ticks per block; 0 disables the size limit.
+        /// \throws std::invalid_argument If both limits are disabled.
+        void set_block_layout(uint64_t block_ms, uint32_t max_block_ticks) {
+            if (block_ms == 0 && max_block_ticks == 0) {
+                throw std::invalid_argument("Tick block layout needs a time or size limit.");
+            }
+            m_block_ms = block_ms;
+            m_max_block_ticks = max_block_ticks;
+        }
+
+        /// \brief Returns the codec selection counters of `AUTO_CODEC` mode.
+        const TickCodecStats& auto_stats() const noexcept {
+            return m_auto_stats;
+        }
+
+        /// \brief Resets the codec selection counters.
+        void reset_auto_stats() noexcept {
+            m_auto_stats = TickCodecStats{};
+        }
+
         /// \brief Checks if the signature of the input data matches the expected signature.
         /// \param input A vector containing the binary data.
         /// \return True if the signature matches, otherwise false.
         bool is_valid_signature(const std::vector<uint8_t>& input) const override final {
             return m_tick_raw_binary_v1.is_valid_signature(input)
-                || m_tick_compressor_v1.is_valid_signature(input);
+                || m_tick_compressor_v1.is_valid_signature(input)
+                || m_tick_compressor_v2.is_valid_signature(input)
+                || (!input.empty() && input[0] == TickBlockIndex::SIGNATURE);
         }
 
         /// \brief Serializes tick data into a binary format.
@@ -49,6 +125,14 @@ namespace dfh::compression {
                 const std::vector<dfh::MarketTick>& ticks,
                 std::vector<uint8_t>& output) override final {
             if (!m_serializer) throw std::runtime_error("No serializer selected.");
+            if (m_block_mode) {
+                serialize_blocks(ticks, m_serializer->codec_config(), output);
+                return;
+            }
+            if (m_auto_codec) {
+                serialize_auto(ticks, m_serializer->codec_config(), output);
+                return;
+            }
             m_serializer->serialize(ticks, output);
         }
 
@@ -63,7 +147,12 @@ namespace dfh::compression {
                 const dfh::TickCodecConfig& config,
                 std::vector<uint8_t>& output) override final {
             select_serializer(config);
-            m_serializer->serialize(ticks, config, output);
+            select_modes(config);
+            if (m_block_mode) {
+                serialize_blocks(ticks, config, output);
+                return;
+            }
+            serialize_segment(ticks, config, output);
         }
 
         /// \brief Deserializes tick data from binary format.
@@ -74,8 +163,7 @@ namespace dfh::compression {
         void deserialize(
                 const std::vector<uint8_t>& input,
                 std::vector<dfh::MarketTick>& ticks) override final {
-            select_serializer(input);
-            m_serializer->deserialize(input, ticks);
+            deserialize(input.data(), input.size(), ticks);
         }
 
         /// \brief Deserializes tick data and retrieves the configuration.
@@ -88,25 +176,387 @@ namespace dfh::compression {
                 const std::vector<uint8_t>& input,
                 std::vector<dfh::MarketTick>& ticks,
                 dfh::TickCodecConfig& config) override final {
+            deserialize(input.data(), input.size(), ticks, config);
+        }
+
+        /// \brief Deserializes tick data in place, e.g. straight from a memory-mapped database page.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param ticks A vector where the deserialized tick data will be stored.
+        /// \throws std::runtime_error If no suitable serializer is found.
+        /// \throws std::invalid_argument If the input data format is invalid.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<dfh::MarketTick>& ticks) override final {
+            if (is_block_segment(data, size)) {
+                deserialize_blocks(data, size, 0, SIZE_MAX, ticks);
+                return;
+            }
+            select_serializer(data, size);
+            m_serializer->deserialize(data, size, ticks);
+        }
+
+        /// \brief Deserializes tick data in place and retrieves the configuration.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param ticks A vector where the deserialized tick data will be stored.
+        /// \param config A reference to store the retrieved configuration.
+        /// \throws std::runtime_error If no suitable serializer is found.
+        /// \throws std::invalid_argument If the input data format is invalid.
+        void deserialize(
+                const uint8_t* data,
+                size_t size,
+                std::vector<dfh::MarketTick>& ticks,
+                dfh::TickCodecConfig& config) override final {
+            if (is_block_segment(data, size)) {
+                deserialize_blocks(data, size, 0, SIZE_MAX, ticks);
+                block_codec_config(config);
+                return;
+            }
+            select_serializer(data, size);
+            m_serializer->deserialize(data, size, ticks, config);
+        }
+
+        /// \brief Deserializes only the requested tick fields.
+        /// \param input A vector of binary data.
+        /// \param ticks A vector where the deserialized tick data will be stored.
+        /// \param fields Mask of the fields to decode.
+        /// \throws std::runtime_error If no suitable serializer is found.
+        /// \throws std::invalid_argument If the input data format is invalid.
+        void deserialize(
+                const std::vector<uint8_t>& input,
+                std::vector<dfh::MarketTick>& ticks,
+                dfh::TickField fields) override final {
+            if (is_block_segment(input)) {
+                deserialize_blocks(input.data(), input.size(), 0, SIZE_MAX, ticks);
+                return;
+            }
             select_serializer(input);
-            m_serializer->deserialize(input, ticks, config);
+            m_serializer->deserialize(input, ticks, fields);
+        }
+
+        /// \brief Deserializes the ticks of a time range.
+        /// \details For `BLOCK_INDEX` segments only the blocks overlapping the range are decoded;
+        /// other segments are decoded in full. In both cases the appended ticks are trimmed to
+        /// `[start_ts, end_ts)`; ticks already in `ticks` are left untouched.
+        /// \param input A vector of binary data.
+        /// \param start_ts Start of the range in milliseconds (inclusive).
+        /// \param end_ts End of the range in milliseconds (exclusive).
+        /// \param ticks A vector where the ticks of the range will be appended.
+        /// \param config A reference to store the retrieved configuration.
+        /// \throws std::runtime_error If no suitable serializer is found.
+        /// \throws std::invalid_argument If the input data format is invalid.
+        void deserialize_range(
+                const std::vector<uint8_t>& input,
+                uint64_t start_ts,
+                uint64_t end_ts,
+                std::vector<dfh::MarketTick>& ticks,
+                dfh::TickCodecConfig& config) {
+            deserialize_range(input.data(), input.size(), start_ts, end_ts, ticks, config);
+        }
+
+        /// \brief Deserializes the ticks of a time range in place.
+        /// \details Same as deserialize_range(const std::vector<uint8_t>&, uint64_t, uint64_t, std::vector<dfh::MarketTick>&, dfh::TickCodecConfig&),
+        /// for segments that are read straight from a memory-mapped database page.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \param start_ts Start of the range in milliseconds (inclusive).
+        /// \param end_ts End of the range in milliseconds (exclusive).
+        /// \param ticks A vector where the ticks of the range will be appended.
+        /// \param config A reference to store the retrieved configuration.
+        /// \throws std::runtime_error If no suitable serializer is found.
+        /// \throws std::invalid_argument If the input data format is invalid.
+        void deserialize_range(
+                const uint8_t* data,
+                size_t size,
+                uint64_t start_ts,
+                uint64_t end_ts,
+                std::vector<dfh::MarketTick>& ticks,
+                dfh::TickCodecConfig& config) {
+            const size_t initial_size = ticks.size();
+            if (is_block_segment(data, size)) {
+                m_block_index.parse(data, size);
+                const auto range = m_block_index.find_blocks(start_ts, end_ts);
+                deserialize_blocks(data, size, range.first, range.second, ticks);
+                block_codec_config(config);
+            } else {
+                if (size == 0) return;
+                select_serializer(data[0]);
+                m_serializer->deserialize(data, size, ticks, config);
+            }
+
+            auto by_time = [](const dfh::MarketTick& tick, uint64_t timestamp) {
+                return tick.time_ms < timestamp;
+            };
+            const auto first = ticks.begin() + initial_size;
+            const auto it_end = std::lower_bound(first, ticks.end(), end_ts, by_time);
+            ticks.erase(it_end, ticks.end());
+            const auto it_start = std::lower_bound(ticks.begin() + initial_size, ticks.end(), start_ts, by_time);
+            ticks.erase(ticks.begin() + initial_size, it_start);
+        }
+
+        /// \copydoc ITickSerializer::decode_into()
+        /// \throws std::runtime_error If no suitable serializer is found or decoding fails.
+        /// \throws std::invalid_argument If the input data format is invalid.
+        size_t decode_into(
+                const uint8_t* data,
+                size_t size,
+                dfh::MarketTick* ticks,
+                size_t capacity) override final {
+            if (size == 0) return 0;
+            if (data[0] == TickBlockIndex::SIGNATURE) {
+                m_block_index.parse(data, size);
+                if (m_block_index.num_ticks() > capacity) {
+                    throw std::length_error("Tick buffer is too small for the segment.");
+                }
+                return decode_blocks_into(data, 0, m_block_index.blocks().size(), ticks, capacity);
+            }
+            select_serializer(data[0]);
+            return m_serializer->decode_into(data, size, ticks, capacity);
+        }
+
+        /// \brief Rebuilds a serialized segment with another compression profile.
+        ///
+        /// Used by the idle-time pass of the storage (TickBD::recompress()) to upgrade segments
+        /// written with a fast profile to archive level. Raw binary segments are copied unchanged.
+        /// \param input A vector of binary data.
+        /// \param profile Target compression profile.
+        /// \param output A vector where the recompressed data will be appended.
+        /// \throws std::runtime_error If no suitable serializer is found or recompression fails.
+        void recompress(
+                const std::vector<uint8_t>& input,
+                dfh::TickCompressionProfile profile,
+                std::vector<uint8_t>& output) {
+            if (is_block_segment(input)) {
+                recompress_blocks(input, profile, output);
+                return;
+            }
+            select_serializer(input);
+            if (m_serializer == &m_tick_compressor_v1) {
+                m_tick_compressor_v1.recompress(input, profile, output);
+                return;
+            }
+            if (m_serializer == &m_tick_compressor_v2) {
+                m_tick_compressor_v2.recompress(input, profile, output);
+                return;
+            }
+            output.insert(output.end(), input.begin(), input.end());
         }
 
     private:
         TickBinarySerializerV1 m_tick_raw_binary_v1;
         TickCompressorV1       m_tick_compressor_v1;
+        TickCompressorV2       m_tick_compressor_v2;
         ITickSerializer*       m_serializer = nullptr;
+        bool                   m_auto_codec = false;
+        bool                   m_block_mode = false;
+        uint64_t               m_block_ms = 60000;
+        uint32_t               m_max_block_ticks = 4096;
+        TickCodecStats         m_auto_stats;
+        TickBlockIndex         m_block_index;
+        std::vector<uint8_t>   m_raw_buffer;
+        std::vector<uint8_t>   m_segment_buffer;
+        std::vector<uint8_t>   m_block_payload;
+        std::vector<dfh::MarketTick> m_block_ticks;
+
+        /// \brief Enables the `AUTO_CODEC` and `BLOCK_INDEX` modes requested by the configuration.
+        void select_modes(const dfh::TickCodecConfig& config) {
+            m_auto_codec = !config.has_flag(dfh::TickStorageFlags::STORE_RAW_BINARY) &&
+                config.has_flag(dfh::TickStorageFlags::AUTO_CODEC);
+            m_block_mode = config.has_flag(dfh::TickStorageFlags::BLOCK_INDEX);
+        }
+
+        /// \brief Encodes one segment with the selected serializer (or in `AUTO_CODEC` mode).
+        void serialize_segment(
+                const std::vector<dfh::MarketTick>& ticks,
+                const dfh::TickCodecConfig& config,
+                std::vector<uint8_t>& output) {
+            if (m_auto_codec) {
+                serialize_auto(ticks, config, output);
+                return;
+            }
+            m_serializer->serialize(ticks, config, output);
+        }
+
+        /// \brief Encodes a segment as independently decodable blocks behind a TickBlockIndex.
+        /// \param ticks Ticks to encode, in time order.
+        /// \param config Codec configuration; `BLOCK_INDEX` is cleared for the blocks.
+        /// \param output Vector where the segment will be appended.
+        void serialize_blocks(
+                const std::vector<dfh::MarketTick>& ticks,
+                const dfh::TickCodecConfig& config,
+                std::vector<uint8_t>& output) {
+            if (ticks.empty()) return;
+            dfh::TickCodecConfig block_config = config;
+            block_config.clear_flag(dfh::TickStorageFlags::BLOCK_INDEX);
+
+            m_block_index.clear();
+            m_block_payload.clear();
+            size_t begin = 0;
+            while (begin < ticks.size()) {
+                const size_t end = block_end(ticks, begin);
+                m_block_ticks.assign(ticks.begin() + begin, ticks.begin() + end);
+                // Raw binary encoding replaces the output, so every block goes through a scratch buffer.
+                m_segment_buffer.clear();
+                serialize_segment(m_block_ticks, block_config, m_segment_buffer);
+                m_block_payload.insert(m_block_payload.end(), m_segment_buffer.begin(), m_segment_buffer.end());
+                m_block_index.add_block(ticks[begin].time_ms, static_cast<uint32_t>(end - begin), m_segment_buffer.size());
+                begin = end;
+            }
+
+            m_block_index.write_header(output);
+            output.insert(output.end(), m_block_payload.begin(), m_block_payload.end());
+        }
+
+        /// \brief Returns the end of the block starting at `begin`.
+        size_t block_end(const std::vector<dfh::MarketTick>& ticks, size_t begin) const {
+            size_t end = ticks.size();
+            if (m_max_block_ticks) end = std::min(end, begin + m_max_block_ticks);
+            if (m_block_ms) {
+                const uint64_t window_end = (ticks[begin].time_ms / m_block_ms + 1) * m_block_ms;
+                end = std::lower_bound(ticks.begin() + begin, ticks.begin() + end, window_end,
+                    [](const dfh::MarketTick& tick, uint64_t timestamp) {
+                        return tick.time_ms < timestamp;
+                    }) - ticks.begin();
+            }
+            return end;
+        }
+
+        /// \brief Checks whether the input is a `BLOCK_INDEX` segment.
+        static bool is_block_segment(const std::vector<uint8_t>& input) {
+            return is_block_segment(input.data(), input.size());
+        }
+
+        /// \brief Checks whether the segment at `data` is a `BLOCK_INDEX` segment.
+        static bool is_block_segment(const uint8_t* data, size_t size) {
+            return size != 0 && data[0] == TickBlockIndex::SIGNATURE;
+        }
+
+        /// \brief Appends the ticks of blocks `[first, last)` of a `BLOCK_INDEX` segment.
+        /// \param data Segment whose index is parsed into `m_block_index`.
+        /// \param size Size of the segment.
+        /// \param first Index of the first block.
+        /// \param last Index past the last block; clamped to the number of blocks.
+        /// \param ticks A vector where the ticks will be appended.
+        void deserialize_blocks(
+                const uint8_t* data,
+                size_t size,
+                size_t first,
+                size_t last,
+                std::vector<dfh::MarketTick>& ticks) {
+            m_block_index.parse(data, size);
+            const auto& blocks = m_block_index.blocks();
+            last = std::min(last, blocks.size());
+            size_t num_ticks = 0;
+            for (size_t i = first; i < last; ++i) num_ticks += blocks[i].num_ticks;
+
+            const size_t initial_size = ticks.size();
+            ticks.resize(initial_size + num_ticks);
+            try {
+                decode_blocks_into(data, first, last, ticks.data() + initial_size, num_ticks);
+            } catch (...) {
+                ticks.resize(initial_size);
+                throw;
+            }
+        }
+
+        /// \brief Decodes blocks `[first, last)` of the segment whose index is in `m_block_index`.
+        /// \return Number of decoded ticks.
+        /// \throws std::runtime_error If a block is not a plain tick segment.
+        size_t decode_blocks_into(
+                const uint8_t* data,
+                size_t first,
+                size_t last,
+                dfh::MarketTick* ticks,
+                size_t capacity) {
+            const auto& blocks = m_block_index.blocks();
+            size_t count = 0;
+            for (size_t i = first; i < last; ++i) {
+                const uint8_t* block = data + blocks[i].offset;
+                if (blocks[i].size == 0 || block[0] == TickBlockIndex::SIGNATURE) {
+                    throw std::runtime_error("Corrupted seekable tick segment: invalid block.");
+                }
+                select_serializer(block[0]);
+                count += m_serializer->decode_into(block, blocks[i].size, ticks + count, capacity - count);
+            }
+            return count;
+        }
+
+        /// \brief Returns the configuration of the last decoded block with `BLOCK_INDEX` set.
+        void block_codec_config(dfh::TickCodecConfig& config) const {
+            config = m_serializer ? m_serializer->codec_config() : dfh::TickCodecConfig{};
+            config.set_flag(dfh::TickStorageFlags::BLOCK_INDEX);
+        }
+
+        /// \brief Recompresses every block of a `BLOCK_INDEX` segment and rebuilds its index.
+        void recompress_blocks(
+                const std::vector<uint8_t>& input,
+                dfh::TickCompressionProfile profile,
+                std::vector<uint8_t>& output) {
+            m_block_index.parse(input.data(), input.size());
+            TickBlockIndex index;
+            m_block_payload.clear();
+            for (const auto& block : m_block_index.blocks()) {
+                if (block.size == 0 || input[block.offset] == TickBlockIndex::SIGNATURE) {
+                    throw std::runtime_error("Corrupted seekable tick segment: invalid block.");
+                }
+                m_segment_buffer.assign(input.begin() + block.offset, input.begin() + block.offset + block.size);
+                const size_t offset = m_block_payload.size();
+                recompress(m_segment_buffer, profile, m_block_payload);
+                index.add_block(block.first_time_ms, block.num_ticks, m_block_payload.size() - offset);
+            }
+            index.write_header(output);
+            output.insert(output.end(), m_block_payload.begin(), m_block_payload.end());
+        }
+
+        /// \brief Encodes a segment with the selected compressor or in raw binary form, whichever is smaller.
+        /// \param ticks Ticks to encode.
+        /// \param config Codec configuration with `AUTO_CODEC` set.
+        /// \param output Vector where the selected encoding will be appended.
+        void serialize_auto(
+                const std::vector<dfh::MarketTick>& ticks,
+                const dfh::TickCodecConfig& config,
+                std::vector<uint8_t>& output) {
+            if (ticks.empty()) return;
+            const size_t offset = output.size();
+            m_serializer->serialize(ticks, config, output);
+            const size_t compressed_size = output.size() - offset;
+
+            // Signature, tick count, two header bytes and three vbyte fields come on top.
+            constexpr size_t raw_header_min_size = 7;
+            const size_t raw_min_size = raw_header_min_size + ticks.size() * sizeof(dfh::MarketTick);
+            if (compressed_size > raw_min_size) {
+                dfh::TickCodecConfig raw_config = config;
+                raw_config.set_flag(dfh::TickStorageFlags::STORE_RAW_BINARY);
+                m_tick_raw_binary_v1.serialize(ticks, raw_config, m_raw_buffer);
+                ++m_auto_stats.raw_trials;
+                if (m_raw_buffer.size() < compressed_size) {
+                    output.resize(offset);
+                    output.insert(output.end(), m_raw_buffer.begin(), m_raw_buffer.end());
+                    ++m_auto_stats.raw_binary;
+                    m_auto_stats.output_bytes += m_raw_buffer.size();
+                    return;
+                }
+            }
+
+            if (m_serializer == &m_tick_compressor_v1) {
+                ++m_auto_stats.compressor_v1;
+            } else {
+                ++m_auto_stats.compressor_v2;
+            }
+            m_auto_stats.output_bytes += compressed_size;
+        }
 
         /// \brief Selects the appropriate serializer based on the provided configuration.
         /// \param config The configuration used to determine the serializer.
-        /// \throws std::runtime_error If no suitable serializer is found.
         void select_serializer(const dfh::TickCodecConfig& config) {
             if (config.has_flag(dfh::TickStorageFlags::STORE_RAW_BINARY)) {
                 m_serializer = &m_tick_raw_binary_v1;
             } else if (config.has_flag(dfh::TickStorageFlags::TRADE_BASED)) {
                 m_serializer = &m_tick_compressor_v1;
             } else {
-                throw std::runtime_error("Invalid TickCodecConfig: No suitable serializer selected.");
+                m_serializer = &m_tick_compressor_v2;
             }
         }
 
@@ -118,10 +568,34 @@ namespace dfh::compression {
                 m_serializer = &m_tick_raw_binary_v1;
             } else if (m_tick_compressor_v1.is_valid_signature(input)) {
                 m_serializer = &m_tick_compressor_v1;
+            } else if (m_tick_compressor_v2.is_valid_signature(input)) {
+                m_serializer = &m_tick_compressor_v2;
             } else {
                 throw std::runtime_error("Invalid data: Unknown tick serialization format.");
             }
         }
+
+        /// \brief Selects the appropriate serializer for a serialized segment.
+        /// \param data Pointer to the serialized segment.
+        /// \param size Size of the serialized segment.
+        /// \throws std::runtime_error If the segment is empty or no suitable serializer is found.
+        void select_serializer(const uint8_t* data, size_t size) {
+            if (size == 0) throw std::runtime_error("Invalid data: Unknown tick serialization format.");
+            select_serializer(data[0]);
+        }
+
+        /// \brief Selects the appropriate serializer based on the signature byte of a segment.
+        /// \param signature First byte of the serialized segment.
+        /// \throws std::runtime_error If no suitable serializer is found.
+        void select_serializer(uint8_t signature) {
+            switch (signature) {
+            case 0x00: m_serializer = &m_tick_raw_binary_v1; break;
+            case 0x01: m_serializer = &m_tick_compressor_v1; break;
+            case 0x02: m_serializer = &m_tick_compressor_v2; break;
+            default:
+                throw std::runtime_error("Invalid data: Unknown tick serialization format.");
+            }
+        }
     };
 
 } // namespace dfh::compression
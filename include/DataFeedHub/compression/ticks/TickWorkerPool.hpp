@@ -0,0 +1,141 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_TICK_WORKER_POOL_HPP_INCLUDED
+#define _DFH_COMPRESSION_TICK_WORKER_POOL_HPP_INCLUDED
+
+/// \file TickWorkerPool.hpp
+/// \brief Persistent worker threads with one TickSerializer each, shared by the batch tick codecs.
+
+namespace dfh::compression {
+
+    /// \class TickWorkerPool
+    /// \brief Keeps worker threads and their serializers alive across batches.
+    ///
+    /// Threads are started once and then wait for jobs, so a batch pays neither thread creation
+    /// nor fresh compression and ZSTD scratch. Every worker owns a `TickSerializer`; with a single
+    /// thread no worker is started and the caller runs the job itself with serializer(0).
+    /// TickBatchSerializer and TickBatchDeserializer may share one pool: a Lease gives one caller
+    /// exclusive use of the pool for a whole batch, so batches of different callers run one at a time.
+    ///
+    /// \thread_safety acquire() is thread-safe. serializer(), dispatch() and wait() require a held Lease.
+    class TickWorkerPool {
+    public:
+        /// \class Lease
+        /// \brief Exclusive use of the pool; released on destruction.
+        class Lease {
+        public:
+            explicit Lease(std::mutex& mutex) : m_lock(mutex) {}
+
+        private:
+            std::unique_lock<std::mutex> m_lock; ///< Holds the pool for one caller.
+        };
+
+        /// \brief Starts the worker threads.
+        /// \param num_threads Number of threads; 0 uses the number of CPU cores, 1 runs jobs on the caller.
+        explicit TickWorkerPool(size_t num_threads = 1) {
+            if (num_threads == 0) num_threads = std::thread::hardware_concurrency();
+            num_threads = std::max<size_t>(num_threads, 1);
+            m_serializers.reserve(num_threads);
+            for (size_t i = 0; i < num_threads; ++i) {
+                m_serializers.push_back(std::make_unique<TickSerializer>());
+            }
+            if (num_threads == 1) return;
+            m_threads.reserve(num_threads);
+            for (size_t i = 0; i < num_threads; ++i) {
+                m_threads.emplace_back(&TickWorkerPool::worker_loop, this, i);
+            }
+        }
+
+        TickWorkerPool(const TickWorkerPool&) = delete;
+        TickWorkerPool& operator=(const TickWorkerPool&) = delete;
+
+        /// \brief Stops and joins the worker threads.
+        ~TickWorkerPool() {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stop = true;
+            }
+            m_job_cv.notify_all();
+            for (auto& thread : m_threads) thread.join();
+        }
+
+        /// \brief Returns the number of workers (and serializers).
+        size_t num_threads() const noexcept {
+            return m_serializers.size();
+        }
+
+        /// \brief Waits until no other caller uses the pool and reserves it.
+        Lease acquire() {
+            return Lease(m_use_mutex);
+        }
+
+        /// \brief Returns the serializer of a worker.
+        /// \param worker Worker index in `[0, num_threads())`.
+        TickSerializer& serializer(size_t worker) {
+            return *m_serializers[worker];
+        }
+
+        /// \brief Runs `job(worker)` once on every worker thread and returns immediately.
+        /// \details Requires num_threads() > 1. The job must stay valid until wait() returns.
+        /// \param job Function receiving the worker index; it should use serializer(worker) only.
+        void dispatch(std::function<void(size_t)> job) {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_job = std::move(job);
+                m_error = nullptr;
+                m_running = m_threads.size();
+                ++m_generation;
+            }
+            m_job_cv.notify_all();
+        }
+
+        /// \brief Waits until every worker has finished the dispatched job.
+        /// \throws Rethrows the first exception that escaped the job.
+        void wait() {
+            std::exception_ptr error;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_done_cv.wait(lock, [this] { return m_running == 0; });
+                m_job = nullptr;
+                error = std::exchange(m_error, nullptr);
+            }
+            if (error) std::rethrow_exception(error);
+        }
+
+    private:
+        std::vector<std::unique_ptr<TickSerializer>> m_serializers; ///< One serializer per worker.
+        std::vector<std::thread>    m_threads;        ///< Worker threads; empty for a single-thread pool.
+        std::mutex                  m_use_mutex;      ///< Held by the Lease of the current caller.
+        std::mutex                  m_mutex;          ///< Guards the job state below.
+        std::condition_variable     m_job_cv;         ///< Signals a new job or shutdown.
+        std::condition_variable     m_done_cv;        ///< Signals that all workers finished.
+        std::function<void(size_t)> m_job;            ///< Current job.
+        std::exception_ptr          m_error;          ///< First exception thrown by the job.
+        uint64_t                    m_generation = 0; ///< Incremented for every dispatched job.
+        size_t                      m_running = 0;    ///< Workers still running the current job.
+        bool                        m_stop = false;   ///< Set on destruction.
+
+        /// \brief Waits for jobs and runs them with the worker's index.
+        void worker_loop(size_t worker) {
+            uint64_t generation = 0;
+            for (;;) {
+                {
+                    std::unique_lock<std::mutex> lock(m_mutex);
+                    m_job_cv.wait(lock, [&] { return m_stop || m_generation != generation; });
+                    if (m_stop) return;
+                    generation = m_generation;
+                }
+                try {
+                    m_job(worker);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    if (!m_error) m_error = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (--m_running == 0) m_done_cv.notify_all();
+            }
+        }
+    };
+
+} // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_TICK_WORKER_POOL_HPP_INCLUDED
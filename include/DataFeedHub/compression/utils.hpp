@@ -24,7 +24,11 @@
 #include "utils/repeat_encoding.hpp"
 #include "utils/volume_scaling.hpp"
 #include "utils/zig_zag.hpp"
+#include "utils/prefix_sum.hpp"
 #include "utils/zig_zag_delta.hpp"
+#include "utils/time_bitmap.hpp"
 #include "utils/zstd_utils.hpp"
+#include "utils/ZstdCodecContext.hpp"
+#include "utils/ZstdDictionaryRegistry.hpp"
 
 #endif // _DFH_COMPRESSION_UTILS_HPP_INCLUDED
@@ -0,0 +1,168 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_UTILS_ZSTD_CODEC_CONTEXT_HPP_INCLUDED
+#define _DFH_COMPRESSION_UTILS_ZSTD_CODEC_CONTEXT_HPP_INCLUDED
+
+/// \file ZstdCodecContext.hpp
+/// \brief Reusable ZSTD compression/decompression contexts and pre-digested dictionaries.
+
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace dfh::compression {
+
+    /// \class ZstdDictionary
+    /// \brief Holds a ZSTD dictionary digested into `ZSTD_CDict`/`ZSTD_DDict` objects.
+    ///
+    /// Digesting a 100 KB dictionary costs far more than compressing a small segment,
+    /// so the digested form is built once and shared. The decompression dictionary is
+    /// created eagerly; compression dictionaries are created lazily per compression level
+    /// because the level is frozen into a `ZSTD_CDict` at creation time.
+    ///
+    /// \thread_safety Safe to share between threads: the digested dictionaries are read-only
+    /// after creation and lazy creation of `ZSTD_CDict` objects is guarded by a mutex.
+    class ZstdDictionary {
+    public:
+        /// \brief Digests the dictionary for decompression.
+        /// \param data Pointer to the raw dictionary. Must outlive this object.
+        /// \param size Size of the raw dictionary in bytes.
+        /// \throws std::invalid_argument If the dictionary is empty.
+        /// \throws std::runtime_error If `ZSTD_DDict` creation fails.
+        ZstdDictionary(const void* data, size_t size)
+            : m_data(data), m_size(size) {
+            if (!data || size == 0) {
+                throw std::invalid_argument("Invalid dictionary data.");
+            }
+            m_ddict = ZSTD_createDDict(data, size);
+            if (!m_ddict) {
+                throw std::runtime_error("Failed to create ZSTD decompression dictionary.");
+            }
+        }
+
+        ZstdDictionary(const ZstdDictionary&) = delete;
+        ZstdDictionary& operator=(const ZstdDictionary&) = delete;
+
+        ~ZstdDictionary() {
+            for (auto& item : m_cdicts) {
+                ZSTD_freeCDict(item.second);
+            }
+            ZSTD_freeDDict(m_ddict);
+        }
+
+        /// \brief Returns the compression dictionary digested for the given level.
+        /// \param compress_level Compression level.
+        /// \return Pointer to the shared `ZSTD_CDict`.
+        /// \throws std::runtime_error If `ZSTD_CDict` creation fails.
+        const ZSTD_CDict* cdict(int compress_level) const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (const auto& item : m_cdicts) {
+                if (item.first == compress_level) return item.second;
+            }
+            ZSTD_CDict* cdict = ZSTD_createCDict(m_data, m_size, compress_level);
+            if (!cdict) {
+                throw std::runtime_error("Failed to create ZSTD compression dictionary.");
+            }
+            m_cdicts.emplace_back(compress_level, cdict);
+            return cdict;
+        }
+
+        /// \brief Returns the decompression dictionary.
+        const ZSTD_DDict* ddict() const noexcept {
+            return m_ddict;
+        }
+
+        /// \brief Returns a pointer to the raw dictionary bytes.
+        const void* data() const noexcept {
+            return m_data;
+        }
+
+        /// \brief Returns the size of the raw dictionary in bytes.
+        size_t size() const noexcept {
+            return m_size;
+        }
+
+        /// \brief Returns the dictionary ID written into ZSTD frame headers (0 for raw-content dictionaries).
+        uint32_t id() const noexcept {
+            return ZSTD_getDictID_fromDict(m_data, m_size);
+        }
+
+    private:
+        const void* m_data = nullptr;
+        size_t      m_size = 0;
+        ZSTD_DDict* m_ddict = nullptr;
+        mutable std::mutex m_mutex;
+        mutable std::vector<std::pair<int, ZSTD_CDict*>> m_cdicts;
+    }; // ZstdDictionary
+
+    /// \class ZstdCodecContext
+    /// \brief Owns a `ZSTD_CCtx`/`ZSTD_DCtx` pair that is reused across segments.
+    ///
+    /// Contexts are created on first use and keep their internal workspaces between calls,
+    /// which removes per-segment allocation in ZSTD.
+    ///
+    /// \thread_safety Not thread-safe. Use one instance per thread.
+    class ZstdCodecContext {
+    public:
+        ZstdCodecContext() = default;
+
+        ZstdCodecContext(const ZstdCodecContext&) = delete;
+        ZstdCodecContext& operator=(const ZstdCodecContext&) = delete;
+
+        ZstdCodecContext(ZstdCodecContext&& other) noexcept
+            : m_cctx(std::exchange(other.m_cctx, nullptr)),
+              m_dctx(std::exchange(other.m_dctx, nullptr)) {
+        }
+
+        ZstdCodecContext& operator=(ZstdCodecContext&& other) noexcept {
+            if (this != &other) {
+                release();
+                m_cctx = std::exchange(other.m_cctx, nullptr);
+                m_dctx = std::exchange(other.m_dctx, nullptr);
+            }
+            return *this;
+        }
+
+        ~ZstdCodecContext() {
+            release();
+        }
+
+        /// \brief Returns the compression context, creating it on first use.
+        /// \throws std::runtime_error If context creation fails.
+        ZSTD_CCtx* cctx() {
+            if (!m_cctx) {
+                m_cctx = ZSTD_createCCtx();
+                if (!m_cctx) {
+                    throw std::runtime_error("Failed to create ZSTD compression context.");
+                }
+            }
+            return m_cctx;
+        }
+
+        /// \brief Returns the decompression context, creating it on first use.
+        /// \throws std::runtime_error If context creation fails.
+        ZSTD_DCtx* dctx() {
+            if (!m_dctx) {
+                m_dctx = ZSTD_createDCtx();
+                if (!m_dctx) {
+                    throw std::runtime_error("Failed to create ZSTD decompression context.");
+                }
+            }
+            return m_dctx;
+        }
+
+    private:
+        ZSTD_CCtx* m_cctx = nullptr;
+        ZSTD_DCtx* m_dctx = nullptr;
+
+        void release() noexcept {
+            ZSTD_freeCCtx(m_cctx);
+            ZSTD_freeDCtx(m_dctx);
+            m_cctx = nullptr;
+            m_dctx = nullptr;
+        }
+    }; // ZstdCodecContext
+
+}; // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_UTILS_ZSTD_CODEC_CONTEXT_HPP_INCLUDED
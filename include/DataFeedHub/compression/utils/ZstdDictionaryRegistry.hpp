@@ -0,0 +1,114 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_UTILS_ZSTD_DICTIONARY_REGISTRY_HPP_INCLUDED
+#define _DFH_COMPRESSION_UTILS_ZSTD_DICTIONARY_REGISTRY_HPP_INCLUDED
+
+/// \file ZstdDictionaryRegistry.hpp
+/// \brief Process-wide registry of trained ZSTD dictionaries keyed by dictionary ID.
+
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace dfh::compression {
+
+    /// \class ZstdDictionaryRegistry
+    /// \brief Maps ZSTD dictionary IDs to digested dictionaries.
+    ///
+    /// The key is the ID that ZDICT writes into a trained dictionary and that ZSTD copies into
+    /// the frame header of every segment compressed with it, so a segment names its own
+    /// dictionary and can be decoded without any side information. Dictionaries are loaded at
+    /// runtime (for example from the MDBX `zstd_dictionaries` sub-database), which lets each
+    /// market class get its own dictionary without rebuilding the library.
+    ///
+    /// Dictionaries are never removed, so references returned by get() stay valid for the
+    /// lifetime of the registry.
+    ///
+    /// \thread_safety Thread-safe.
+    class ZstdDictionaryRegistry {
+    public:
+        ZstdDictionaryRegistry() = default;
+
+        ZstdDictionaryRegistry(const ZstdDictionaryRegistry&) = delete;
+        ZstdDictionaryRegistry& operator=(const ZstdDictionaryRegistry&) = delete;
+
+        /// \brief Returns the process-wide registry used by the tick compressors.
+        static ZstdDictionaryRegistry& instance() {
+            static ZstdDictionaryRegistry registry;
+            return registry;
+        }
+
+        /// \brief Registers a dictionary under the ID stored in it.
+        /// \param dictionary Dictionary in ZDICT format (as produced by train_zstd()).
+        /// \return The dictionary ID.
+        /// \throws std::invalid_argument If the dictionary carries no ID (raw-content dictionary).
+        /// \throws std::runtime_error If another dictionary with the same ID is already registered.
+        uint32_t add(std::vector<uint8_t> dictionary) {
+            const uint32_t id = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+            if (id == 0) {
+                throw std::invalid_argument("ZSTD dictionary has no dictionary ID.");
+            }
+            std::unique_lock<std::shared_mutex> lock(m_mutex);
+            auto it = m_entries.find(id);
+            if (it != m_entries.end()) {
+                if (it->second->data == dictionary) return id;
+                throw std::runtime_error("Another ZSTD dictionary is registered with ID " + std::to_string(id) + ".");
+            }
+            auto entry = std::make_unique<Entry>();
+            entry->data = std::move(dictionary);
+            entry->dictionary = std::make_unique<ZstdDictionary>(entry->data.data(), entry->data.size());
+            m_entries.emplace(id, std::move(entry));
+            return id;
+        }
+
+        /// \brief Checks whether a dictionary with the given ID is registered.
+        bool contains(uint32_t id) const {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            return m_entries.find(id) != m_entries.end();
+        }
+
+        /// \brief Returns the dictionary with the given ID, or nullptr if it is not registered.
+        const ZstdDictionary* find(uint32_t id) const {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            auto it = m_entries.find(id);
+            return it == m_entries.end() ? nullptr : it->second->dictionary.get();
+        }
+
+        /// \brief Returns the dictionary with the given ID.
+        /// \throws std::runtime_error If the dictionary is not registered.
+        const ZstdDictionary& get(uint32_t id) const {
+            const ZstdDictionary* dictionary = find(id);
+            if (!dictionary) {
+                throw std::runtime_error("Unknown ZSTD dictionary ID " + std::to_string(id) + ".");
+            }
+            return *dictionary;
+        }
+
+        /// \brief Returns the IDs of all registered dictionaries.
+        std::vector<uint32_t> ids() const {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            std::vector<uint32_t> result;
+            result.reserve(m_entries.size());
+            for (const auto& item : m_entries) result.push_back(item.first);
+            return result;
+        }
+
+        /// \brief Returns the number of registered dictionaries.
+        size_t size() const {
+            std::shared_lock<std::shared_mutex> lock(m_mutex);
+            return m_entries.size();
+        }
+
+    private:
+        /// \brief Dictionary bytes together with their digested form.
+        struct Entry {
+            std::vector<uint8_t>            data;       ///< Raw dictionary (referenced by `dictionary`).
+            std::unique_ptr<ZstdDictionary> dictionary; ///< Digested dictionary.
+        };
+
+        mutable std::shared_mutex m_mutex;
+        std::unordered_map<uint32_t, std::unique_ptr<Entry>> m_entries;
+    }; // ZstdDictionaryRegistry
+
+}; // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_UTILS_ZSTD_DICTIONARY_REGISTRY_HPP_INCLUDED
@@ -3,7 +3,7 @@
 #define _DFH_COMPRESSION_UTILS_FREQUENCY_ENCODING_HPP_INCLUDED
 
 /// \file frequency_encoding.hpp
-/// \brief
+/// \brief Frequency-based dictionary encoding of integer streams.
 
 namespace dfh::compression {
 
@@ -65,14 +65,330 @@ namespace dfh::compression {
         }
     }
 
-    /// \brief
-    /// \param encoded_values Закодированные индексы (значения)
-    /// \param decoded_results Декодированные значения
-    /// \param num_encoded Количество закодированных элементов
-    /// \param code_to_value Буфер для хранения таблицы преобразования
-    /// \param sorted_values Упорядоченные значения (по частоте)
-    /// \param sorted_to_index_map Отображение упорядоченных значений на исходные индексы
-    /// \param num_values
+    /// \class FrequencyEncoder
+    /// \brief Frequency encoder with reusable scratch buffers for `uint32_t` / `uint64_t` keys.
+    ///
+    /// Produces exactly the same output as the generic encode_frequency(), but counts values
+    /// in an open-addressing hash table (linear probing, Fibonacci hashing) and remembers the
+    /// table entry of every input value, so the final encoding pass needs no second lookup.
+    /// All buffers are kept between calls; keep one instance per compression context.
+    /// \tparam KeyType Type of the values being encoded.
+    template<class KeyType>
+    class FrequencyEncoder {
+    public:
+        static_assert(std::is_same<KeyType, uint32_t>::value || std::is_same<KeyType, uint64_t>::value,
+                      "FrequencyEncoder supports only uint32_t and uint64_t keys.");
+
+        /// \brief Encodes values into codes, where the most frequent values get the smallest codes.
+        /// \param input_values Pointer to the original array of values.
+        /// \param encoded_values Pointer to the array to store the codes (may alias input_values).
+        /// \param num_values Number of elements in the input array.
+        /// \param sorted_values Array to store the unique values ordered by descending frequency.
+        /// \param sorted_to_index_map Array to store the codes corresponding to each unique value.
+        template<class OutputType, class ValuesType, class IndexType>
+        void encode(
+                const KeyType* input_values,
+                OutputType* encoded_values,
+                size_t num_values,
+                ValuesType& sorted_values,
+                IndexType& sorted_to_index_map) {
+            // Step 1: Count frequencies, assigning dense ids in order of first appearance
+            reset_table(num_values);
+            m_ids.resize(num_values);
+            for (size_t i = 0; i < num_values; ++i) {
+                m_ids[i] = insert(input_values[i]);
+            }
+
+            // Step 2: Order unique values by frequency (desc), then by value (asc)
+            const size_t num_unique = m_keys.size();
+            m_order.resize(num_unique);
+            for (size_t i = 0; i < num_unique; ++i) {
+                m_order[i] = static_cast<uint32_t>(i);
+            }
+            std::sort(m_order.begin(), m_order.end(),
+                [this](uint32_t a, uint32_t b) {
+                    if (m_counts[a] != m_counts[b]) return m_counts[a] > m_counts[b];
+                    return m_keys[a] < m_keys[b];
+                });
+
+            // Step 3: Assign codes and populate sorted_values and sorted_to_index_map
+            m_codes.resize(num_unique);
+            sorted_values.resize(num_unique);
+            sorted_to_index_map.resize(num_unique);
+            for (size_t i = 0; i < num_unique; ++i) {
+                m_codes[m_order[i]] = static_cast<uint32_t>(i);
+                sorted_values[i] = m_keys[m_order[i]];
+                sorted_to_index_map[i] = static_cast<uint32_t>(i);
+            }
+
+            // Step 4: Encode input values
+            for (size_t i = 0; i < num_values; ++i) {
+                encoded_values[i] = m_codes[m_ids[i]];
+            }
+        }
+
+    private:
+        static constexpr uint32_t EMPTY_SLOT = 0xFFFFFFFF;   ///< Marker of an unused hash table slot.
+        static constexpr size_t   MAX_INITIAL_CAPACITY = 1024; ///< Upper bound of the table size before growth.
+
+        std::vector<KeyType>  m_slot_keys; ///< Keys stored in hash table slots.
+        std::vector<uint32_t> m_slot_ids;  ///< Dense ids stored in hash table slots.
+        std::vector<KeyType>  m_keys;      ///< Unique values by dense id.
+        std::vector<uint32_t> m_counts;    ///< Frequencies by dense id.
+        std::vector<uint32_t> m_ids;       ///< Dense id of every input value.
+        std::vector<uint32_t> m_order;     ///< Dense ids sorted by frequency.
+        std::vector<uint32_t> m_codes;     ///< Code by dense id.
+        size_t                m_mask  = 0; ///< Hash table capacity minus one.
+        unsigned              m_shift = 0; ///< Right shift applied to the multiplicative hash.
+
+        /// \brief Clears the table and sizes it for the expected number of values.
+        void reset_table(size_t num_values) {
+            size_t capacity = 16;
+            while (capacity < MAX_INITIAL_CAPACITY && capacity < num_values * 2) {
+                capacity <<= 1;
+            }
+            resize_table(capacity);
+            m_keys.clear();
+            m_counts.clear();
+        }
+
+        /// \brief Allocates an empty table of the given power-of-two capacity.
+        void resize_table(size_t capacity) {
+            m_slot_keys.resize(capacity);
+            m_slot_ids.assign(capacity, EMPTY_SLOT);
+            m_mask = capacity - 1;
+            m_shift = 64;
+            for (size_t c = capacity; c > 1; c >>= 1) --m_shift;
+        }
+
+        /// \brief Returns the home slot of a key.
+        size_t slot_of(KeyType key) const {
+            return static_cast<size_t>((static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ULL) >> m_shift) & m_mask;
+        }
+
+        /// \brief Counts a key and returns its dense id.
+        uint32_t insert(KeyType key) {
+            size_t slot = slot_of(key);
+            while (m_slot_ids[slot] != EMPTY_SLOT) {
+                if (m_slot_keys[slot] == key) {
+                    const uint32_t id = m_slot_ids[slot];
+                    ++m_counts[id];
+                    return id;
+                }
+                slot = (slot + 1) & m_mask;
+            }
+            const uint32_t id = static_cast<uint32_t>(m_keys.size());
+            m_slot_keys[slot] = key;
+            m_slot_ids[slot] = id;
+            m_keys.push_back(key);
+            m_counts.push_back(1);
+            if (m_keys.size() * 2 > m_mask + 1) {
+                grow();
+            }
+            return id;
+        }
+
+        /// \brief Doubles the table and reinserts all unique keys.
+        void grow() {
+            resize_table((m_mask + 1) << 1);
+            for (uint32_t id = 0; id < m_keys.size(); ++id) {
+                size_t slot = slot_of(m_keys[id]);
+                while (m_slot_ids[slot] != EMPTY_SLOT) {
+                    slot = (slot + 1) & m_mask;
+                }
+                m_slot_keys[slot] = m_keys[id];
+                m_slot_ids[slot] = id;
+            }
+        }
+    };
+
+    /// \brief Encodes an array of values into codes using reusable FrequencyEncoder scratch buffers.
+    /// \details Output is identical to the generic encode_frequency() overload.
+    /// \param input_values Pointer to the original array of values.
+    /// \param encoded_values Pointer to the array to store the encoded values (same size as input_values).
+    /// \param num_values Number of elements in the input array.
+    /// \param sorted_values Array to store the sorted unique values.
+    /// \param sorted_to_index_map Array to store the codes corresponding to each unique value.
+    /// \param encoder Frequency encoder holding the scratch buffers.
+    template<
+        class InputType,
+        class OutputType,
+        class ValuesType,
+        class IndexType>
+    void encode_frequency(
+            const InputType* input_values,
+            OutputType* encoded_values,
+            size_t num_values,
+            ValuesType& sorted_values,
+            IndexType& sorted_to_index_map,
+            FrequencyEncoder<InputType>& encoder) {
+        encoder.encode(input_values, encoded_values, num_values, sorted_values, sorted_to_index_map);
+    }
+
+    /// \brief Looks up codes in the code-to-value table: `output[i] = table[codes[i]]`.
+    /// \param codes Codes produced by encode_frequency().
+    /// \param output Decoded values.
+    /// \param size Number of codes.
+    /// \param table Code-to-value table.
+    template<class CodeType, class ValueType>
+    inline void gather_frequency_scalar(
+            const CodeType* codes,
+            ValueType* output,
+            size_t size,
+            const ValueType* table) {
+        for (size_t i = 0; i < size; ++i) {
+            output[i] = table[codes[i]];
+        }
+    }
+
+#   if defined(DFH_ARCH_X86)
+
+    /// \brief AVX2 variant of gather_frequency_scalar() for 64-bit codes and values.
+    DFH_TARGET_AVX2 inline void gather_frequency_avx2(
+            const uint64_t* codes,
+            uint64_t* output,
+            size_t size,
+            const uint64_t* table) {
+        const size_t aligned_size = size - (size % 4);
+        for (size_t i = 0; i < aligned_size; i += 4) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+                _mm256_i64gather_epi64(
+                    reinterpret_cast<const long long*>(table),
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&codes[i])),
+                    8));
+        }
+        gather_frequency_scalar(codes + aligned_size, output + aligned_size, size - aligned_size, table);
+    }
+
+    /// \brief AVX2 variant of gather_frequency_scalar() for 32-bit codes and 64-bit values.
+    DFH_TARGET_AVX2 inline void gather_frequency_avx2(
+            const uint32_t* codes,
+            uint64_t* output,
+            size_t size,
+            const uint64_t* table) {
+        const size_t aligned_size = size - (size % 8);
+        for (size_t i = 0; i < aligned_size; i += 8) {
+            const __m256i indices_32 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&codes[i]));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+                _mm256_i64gather_epi64(
+                    reinterpret_cast<const long long*>(table),
+                    _mm256_cvtepu32_epi64(_mm256_castsi256_si128(indices_32)),
+                    8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i + 4]),
+                _mm256_i64gather_epi64(
+                    reinterpret_cast<const long long*>(table),
+                    _mm256_cvtepu32_epi64(_mm256_extracti128_si256(indices_32, 1)),
+                    8));
+        }
+        gather_frequency_scalar(codes + aligned_size, output + aligned_size, size - aligned_size, table);
+    }
+
+    /// \brief AVX2 variant of gather_frequency_scalar() for 32-bit codes and values.
+    DFH_TARGET_AVX2 inline void gather_frequency_avx2(
+            const uint32_t* codes,
+            uint32_t* output,
+            size_t size,
+            const uint32_t* table) {
+        const size_t aligned_size = size - (size % 8);
+        for (size_t i = 0; i < aligned_size; i += 8) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&output[i]),
+                _mm256_i32gather_epi32(
+                    reinterpret_cast<const int*>(table),
+                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&codes[i])),
+                    4));
+        }
+        gather_frequency_scalar(codes + aligned_size, output + aligned_size, size - aligned_size, table);
+    }
+
+    /// \brief AVX-512 variant of gather_frequency_scalar() for 64-bit codes and values.
+    DFH_TARGET_AVX512 inline void gather_frequency_avx512(
+            const uint64_t* codes,
+            uint64_t* output,
+            size_t size,
+            const uint64_t* table) {
+        const size_t aligned_size = size - (size % 8);
+        for (size_t i = 0; i < aligned_size; i += 8) {
+            _mm512_storeu_si512(&output[i],
+                _mm512_i64gather_epi64(_mm512_loadu_si512(&codes[i]), table, 8));
+        }
+        gather_frequency_scalar(codes + aligned_size, output + aligned_size, size - aligned_size, table);
+    }
+
+    /// \brief AVX-512 variant of gather_frequency_scalar() for 32-bit codes and 64-bit values.
+    DFH_TARGET_AVX512 inline void gather_frequency_avx512(
+            const uint32_t* codes,
+            uint64_t* output,
+            size_t size,
+            const uint64_t* table) {
+        const size_t aligned_size = size - (size % 8);
+        for (size_t i = 0; i < aligned_size; i += 8) {
+            const __m512i indices = _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(&codes[i])));
+            _mm512_storeu_si512(&output[i], _mm512_i64gather_epi64(indices, table, 8));
+        }
+        gather_frequency_scalar(codes + aligned_size, output + aligned_size, size - aligned_size, table);
+    }
+
+    /// \brief AVX-512 variant of gather_frequency_scalar() for 32-bit codes and values.
+    DFH_TARGET_AVX512 inline void gather_frequency_avx512(
+            const uint32_t* codes,
+            uint32_t* output,
+            size_t size,
+            const uint32_t* table) {
+        const size_t aligned_size = size - (size % 16);
+        for (size_t i = 0; i < aligned_size; i += 16) {
+            _mm512_storeu_si512(&output[i],
+                _mm512_i32gather_epi32(_mm512_loadu_si512(&codes[i]), table, 4));
+        }
+        gather_frequency_scalar(codes + aligned_size, output + aligned_size, size - aligned_size, table);
+    }
+
+#   endif // DFH_ARCH_X86
+
+    /// \struct FrequencyDecodeKernels
+    /// \brief Code-to-value gather kernels selected for the current CPU.
+    struct FrequencyDecodeKernels {
+        dfh::utils::SimdLevel level = dfh::utils::SimdLevel::SCALAR; ///< Level of the selected variants.
+        void (*gather_u64_u64)(const uint64_t*, uint64_t*, size_t, const uint64_t*) = gather_frequency_scalar<uint64_t, uint64_t>;
+        void (*gather_u32_u64)(const uint32_t*, uint64_t*, size_t, const uint64_t*) = gather_frequency_scalar<uint32_t, uint64_t>;
+        void (*gather_u32_u32)(const uint32_t*, uint32_t*, size_t, const uint32_t*) = gather_frequency_scalar<uint32_t, uint32_t>;
+    };
+
+    /// \brief Returns the gather kernels for dfh::utils::active_simd_level(), resolved once per process.
+    /// \details There is no SSE4.1 gather instruction, so that level uses the scalar kernels.
+    inline const FrequencyDecodeKernels& frequency_decode_kernels() {
+        static const FrequencyDecodeKernels kernels = [] {
+            using dfh::utils::SimdLevel;
+            FrequencyDecodeKernels k;
+#           if defined(DFH_ARCH_X86)
+            using U64U64 = void (*)(const uint64_t*, uint64_t*, size_t, const uint64_t*);
+            using U32U64 = void (*)(const uint32_t*, uint64_t*, size_t, const uint64_t*);
+            using U32U32 = void (*)(const uint32_t*, uint32_t*, size_t, const uint32_t*);
+            const SimdLevel level = dfh::utils::active_simd_level();
+            if (level >= SimdLevel::AVX512) {
+                k.level = SimdLevel::AVX512;
+                k.gather_u64_u64 = static_cast<U64U64>(gather_frequency_avx512);
+                k.gather_u32_u64 = static_cast<U32U64>(gather_frequency_avx512);
+                k.gather_u32_u32 = static_cast<U32U32>(gather_frequency_avx512);
+            } else if (level >= SimdLevel::AVX2) {
+                k.level = SimdLevel::AVX2;
+                k.gather_u64_u64 = static_cast<U64U64>(gather_frequency_avx2);
+                k.gather_u32_u64 = static_cast<U32U64>(gather_frequency_avx2);
+                k.gather_u32_u32 = static_cast<U32U32>(gather_frequency_avx2);
+            }
+#           endif
+            return k;
+        }();
+        return kernels;
+    }
+
+    /// \brief Decodes values encoded by encode_frequency().
+    /// \param encoded_values Codes.
+    /// \param decoded_results Decoded values (may alias encoded_values when the element types match).
+    /// \param num_encoded Number of codes.
+    /// \param code_to_value Buffer for the code-to-value table (at least num_values elements).
+    /// \param sorted_values Unique values ordered by frequency.
+    /// \param sorted_to_index_map Codes of the ordered values.
+    /// \param num_values Number of unique values.
     inline void decode_frequency(
             const uint64_t* encoded_values,
             uint64_t* decoded_results,
@@ -84,37 +400,11 @@ namespace dfh::compression {
         for (size_t i = 0; i < num_values; ++i) {
             code_to_value[sorted_to_index_map[i]] = sorted_values[i];
         }
-
-#       if defined(__AVX2__)
-        constexpr size_t simd_width = 4;
-        const size_t aligned_size = num_encoded - (num_encoded % simd_width);
-
-        for (size_t i = 0; i < aligned_size; i += simd_width) {
-            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoded_results[i]),
-                _mm256_i64gather_epi64(
-                    reinterpret_cast<const long long*>(code_to_value),
-                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&encoded_values[i])),                                                   // Индексы
-                    8));
-        }
-
-        for (size_t i = aligned_size; i < num_encoded; ++i) {
-            decoded_results[i] = code_to_value[encoded_values[i]];
-        }
-#       else
-        for (size_t i = 0; i < num_encoded; ++i) {
-            decoded_results[i] = code_to_value[encoded_values[i]];
-        }
-#       endif
+        frequency_decode_kernels().gather_u64_u64(encoded_values, decoded_results, num_encoded, code_to_value);
     }
 
-    /// \brief
-    /// \param encoded_values Закодированные индексы (значения)
-    /// \param decoded_results Декодированные значения
-    /// \param num_encoded Количество закодированных элементов
-    /// \param code_to_value Буфер для хранения таблицы преобразования
-    /// \param sorted_values Упорядоченные значения (по частоте)
-    /// \param sorted_to_index_map Отображение упорядоченных значений на исходные индексы
-    /// \param num_values
+    /// \brief Decodes 32-bit codes into 64-bit values encoded by encode_frequency().
+    /// \copydetails decode_frequency(const uint64_t*, uint64_t*, size_t, uint64_t*, const uint64_t*, const uint32_t*, size_t)
     inline void decode_frequency(
             const uint32_t* encoded_values,
             uint64_t* decoded_results,
@@ -123,39 +413,14 @@ namespace dfh::compression {
             const uint64_t* sorted_values,
             const uint32_t* sorted_to_index_map,
             size_t num_values) {
-
         for (size_t i = 0; i < num_values; ++i) {
             code_to_value[sorted_to_index_map[i]] = sorted_values[i];
         }
-
-#       if defined(__AVX2__)
-        constexpr size_t simd_width = 8;
-        const size_t aligned_size = num_encoded - (num_encoded % simd_width);
-        for (size_t i = 0; i < aligned_size; i += simd_width) {
-            __m256i indices_32 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&encoded_values[i]));
-
-            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoded_results[i]),
-                _mm256_i64gather_epi64(
-                    reinterpret_cast<const long long*>(code_to_value),
-                    _mm256_cvtepi32_epi64(_mm256_castsi256_si128(indices_32)),
-                    8));
-            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoded_results[i + 4]),
-                _mm256_i64gather_epi64(
-                    reinterpret_cast<const long long*>(code_to_value),
-                    _mm256_cvtepi32_epi64(_mm256_extracti128_si256(indices_32, 1)),
-                    8));
-        }
-
-        for (size_t i = aligned_size; i < num_encoded; ++i) {
-            decoded_results[i] = code_to_value[encoded_values[i]];
-        }
-#       else
-        for (size_t i = 0; i < num_encoded; ++i) {
-            decoded_results[i] = code_to_value[encoded_values[i]];
-        }
-#       endif
+        frequency_decode_kernels().gather_u32_u64(encoded_values, decoded_results, num_encoded, code_to_value);
     }
 
+    /// \brief Decodes 32-bit codes into 32-bit values encoded by encode_frequency().
+    /// \copydetails decode_frequency(const uint64_t*, uint64_t*, size_t, uint64_t*, const uint64_t*, const uint32_t*, size_t)
     inline void decode_frequency(
             const uint32_t* encoded_values,
             uint32_t* decoded_results,
@@ -164,31 +429,10 @@ namespace dfh::compression {
             const uint32_t* sorted_values,
             const uint32_t* sorted_to_index_map,
             size_t num_values) {
-
         for (size_t i = 0; i < num_values; ++i) {
             code_to_value[sorted_to_index_map[i]] = sorted_values[i];
         }
-
-#       if defined(__AVX2__)
-        constexpr size_t simd_width = 8;
-        const size_t aligned_size = num_encoded - (num_encoded % simd_width);
-
-        for (size_t i = 0; i < aligned_size; i += simd_width) {
-            _mm256_storeu_si256(reinterpret_cast<__m256i*>(&decoded_results[i]),
-                _mm256_i32gather_epi32(
-                    reinterpret_cast<const int*>(code_to_value),
-                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&encoded_values[i])),
-                    4));
-        }
-
-        for (size_t i = aligned_size; i < num_encoded; ++i) {
-            decoded_results[i] = code_to_value[encoded_values[i]];
-        }
-#       else
-        for (size_t i = 0; i < num_encoded; ++i) {
-            decoded_results[i] = code_to_value[encoded_values[i]];
-        }
-#       endif
+        frequency_decode_kernels().gather_u32_u32(encoded_values, decoded_results, num_encoded, code_to_value);
     }
 
 };
@@ -0,0 +1,428 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_UTILS_PREFIX_SUM_HPP_INCLUDED
+#define _DFH_COMPRESSION_UTILS_PREFIX_SUM_HPP_INCLUDED
+
+/// \file prefix_sum.hpp
+/// \brief Vectorized prefix-sum kernels for decoding time and price delta streams.
+/// \details Each kernel accumulates a block of deltas in vector registers (log-step scan plus
+/// a broadcast carry), converts and scales prices there, and then stores the lanes either
+/// contiguously (SoA columns) or with a byte stride (fields of tick structures).
+/// The SSE4.1, AVX2 and AVX-512 kernels are selected at runtime from
+/// dfh::utils::active_simd_level() and produce exactly the same bits as the scalar kernels.
+
+namespace dfh::compression {
+
+    /// \brief Decodes time deltas: `output[i] = initial_time + deltas[0] + ... + deltas[i]`.
+    /// \param deltas Unsigned time deltas.
+    /// \param output Pointer to the first timestamp.
+    /// \param stride Distance in bytes between consecutive timestamps.
+    /// \param size Number of deltas.
+    /// \param initial_time Timestamp preceding the first delta.
+    inline void decode_time_delta_scalar(
+            const uint32_t* deltas,
+            uint64_t* output,
+            size_t stride,
+            size_t size,
+            int64_t initial_time) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        uint64_t time_ms = static_cast<uint64_t>(initial_time);
+        for (size_t i = 0; i < size; ++i, out += stride) {
+            time_ms += deltas[i];
+            *reinterpret_cast<uint64_t*>(out) = time_ms;
+        }
+    }
+
+    /// \brief Decodes Zig-Zag price deltas: `output[i] = (initial_price + delta[0] + ... + delta[i]) * inv_price_scale`.
+    /// \param deltas Zig-Zag encoded 32-bit price deltas.
+    /// \param output Pointer to the first price.
+    /// \param stride Distance in bytes between consecutive prices.
+    /// \param size Number of deltas.
+    /// \param inv_price_scale Inverse of the price scale.
+    /// \param initial_price Scaled price preceding the first delta.
+    inline void decode_last_delta_zig_zag_int32_scalar(
+            const uint32_t* deltas,
+            double* output,
+            size_t stride,
+            size_t size,
+            double inv_price_scale,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        for (size_t i = 0; i < size; ++i, out += stride) {
+            const int32_t delta = (deltas[i] >> 1) ^ -(deltas[i] & 1);
+            initial_price += delta;
+            *reinterpret_cast<double*>(out) = static_cast<double>(initial_price) * inv_price_scale;
+        }
+    }
+
+    /// \brief Decodes Zig-Zag price deltas into scaled integer prices: `output[i] = initial_price + delta[0] + ... + delta[i]`.
+    /// \details Fixed-point variant of decode_last_delta_zig_zag_int32_scalar(); prices stay multiplied
+    /// by `10^price_digits`, so no conversion to double (and back) is needed.
+    /// \param deltas Zig-Zag encoded 32-bit price deltas.
+    /// \param output Pointer to the first scaled price.
+    /// \param stride Distance in bytes between consecutive prices.
+    /// \param size Number of deltas.
+    /// \param initial_price Scaled price preceding the first delta.
+    inline void decode_scaled_last_delta_zig_zag_int32_scalar(
+            const uint32_t* deltas,
+            int64_t* output,
+            size_t stride,
+            size_t size,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        for (size_t i = 0; i < size; ++i, out += stride) {
+            const int32_t delta = (deltas[i] >> 1) ^ -(deltas[i] & 1);
+            initial_price += delta;
+            *reinterpret_cast<int64_t*>(out) = initial_price;
+        }
+    }
+
+#   if defined(DFH_ARCH_X86)
+
+    namespace detail {
+
+        /// \brief Inclusive prefix sum of two 64-bit lanes plus a broadcast carry.
+        DFH_TARGET_SSE41 inline __m128i prefix_sum_epi64_sse41(__m128i x, __m128i carry) {
+            return _mm_add_epi64(_mm_add_epi64(x, _mm_slli_si128(x, 8)), carry);
+        }
+
+        /// \brief Stores two 64-bit lanes either contiguously or with a byte stride.
+        DFH_TARGET_SSE41 inline void store_epi64_sse41(uint8_t* out, size_t stride, __m128i v) {
+            if (stride == sizeof(uint64_t)) {
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+                return;
+            }
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), v);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + stride), _mm_unpackhi_epi64(v, v));
+        }
+
+        /// \brief Inclusive prefix sum of four 64-bit lanes plus a broadcast carry.
+        DFH_TARGET_AVX2 inline __m256i prefix_sum_epi64_avx2(__m256i x, __m256i carry) {
+            const __m256i zero = _mm256_setzero_si256();
+            x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 1, 0, 0)), zero, 0x03));
+            x = _mm256_add_epi64(x, _mm256_blend_epi32(_mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 0, 0, 0)), zero, 0x0F));
+            return _mm256_add_epi64(x, carry);
+        }
+
+        /// \brief Inclusive prefix sum of eight 64-bit lanes plus a broadcast carry.
+        DFH_TARGET_AVX512 inline __m512i prefix_sum_epi64_avx512(__m512i x, __m512i carry) {
+            const __m512i zero = _mm512_setzero_si512();
+            x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 7));
+            x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 6));
+            x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 4));
+            return _mm512_add_epi64(x, carry);
+        }
+
+        /// \brief Stores four 64-bit lanes either contiguously or with a byte stride.
+        DFH_TARGET_AVX2 inline void store_epi64_avx2(uint8_t* out, size_t stride, __m256i v) {
+            if (stride == sizeof(uint64_t)) {
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), v);
+                return;
+            }
+            const __m128i lo = _mm256_castsi256_si128(v);
+            const __m128i hi = _mm256_extracti128_si256(v, 1);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out), lo);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + stride), _mm_unpackhi_epi64(lo, lo));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 2 * stride), hi);
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 3 * stride), _mm_unpackhi_epi64(hi, hi));
+        }
+
+    } // namespace detail
+
+    /// \brief SSE4.1 variant of decode_time_delta_scalar().
+    DFH_TARGET_SSE41 inline void decode_time_delta_sse41(
+            const uint32_t* deltas,
+            uint64_t* output,
+            size_t stride,
+            size_t size,
+            int64_t initial_time) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        __m128i carry = _mm_set1_epi64x(initial_time);
+        const size_t aligned_size = size - (size % 2);
+        for (size_t i = 0; i < aligned_size; i += 2, out += 2 * stride) {
+            const __m128i x = _mm_cvtepu32_epi64(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(deltas + i)));
+            const __m128i sum = detail::prefix_sum_epi64_sse41(x, carry);
+            detail::store_epi64_sse41(out, stride, sum);
+            carry = _mm_unpackhi_epi64(sum, sum);
+        }
+        decode_time_delta_scalar(
+            deltas + aligned_size, reinterpret_cast<uint64_t*>(out), stride, size - aligned_size,
+            _mm_cvtsi128_si64(carry));
+    }
+
+    /// \brief SSE4.1 variant of decode_last_delta_zig_zag_int32_scalar().
+    /// \details Prices outside [-2^51, 2^51) fall back to the scalar conversion, as in the AVX2 kernel.
+    DFH_TARGET_SSE41 inline void decode_last_delta_zig_zag_int32_sse41(
+            const uint32_t* deltas,
+            double* output,
+            size_t stride,
+            size_t size,
+            double inv_price_scale,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m128i bias  = _mm_set1_epi64x(1LL << 51);
+        const __m128d scale = _mm_set1_pd(inv_price_scale);
+        const __m128i one   = _mm_set1_epi32(1);
+        __m128i carry = _mm_set1_epi64x(initial_price);
+        const size_t aligned_size = size - (size % 2);
+        for (size_t i = 0; i < aligned_size; i += 2, out += 2 * stride) {
+            const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(deltas + i));
+            const __m128i delta = _mm_xor_si128(_mm_srli_epi32(v, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, one)));
+            const __m128i sum = detail::prefix_sum_epi64_sse41(_mm_cvtepi32_epi64(delta), carry);
+            carry = _mm_unpackhi_epi64(sum, sum);
+            if (!_mm_testz_si128(_mm_srli_epi64(_mm_add_epi64(sum, bias), 52), _mm_set1_epi64x(-1))) {
+                alignas(16) int64_t prices[2];
+                _mm_store_si128(reinterpret_cast<__m128i*>(prices), sum);
+                for (size_t j = 0; j < 2; ++j) {
+                    *reinterpret_cast<double*>(out + j * stride) = static_cast<double>(prices[j]) * inv_price_scale;
+                }
+                continue;
+            }
+            const __m128d price = _mm_mul_pd(dfh::utils::int64_to_double(sum), scale);
+            detail::store_epi64_sse41(out, stride, _mm_castpd_si128(price));
+        }
+        decode_last_delta_zig_zag_int32_scalar(
+            deltas + aligned_size, reinterpret_cast<double*>(out), stride, size - aligned_size,
+            inv_price_scale, _mm_cvtsi128_si64(carry));
+    }
+
+    /// \brief SSE4.1 variant of decode_scaled_last_delta_zig_zag_int32_scalar().
+    DFH_TARGET_SSE41 inline void decode_scaled_last_delta_zig_zag_int32_sse41(
+            const uint32_t* deltas,
+            int64_t* output,
+            size_t stride,
+            size_t size,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m128i one = _mm_set1_epi32(1);
+        __m128i carry = _mm_set1_epi64x(initial_price);
+        const size_t aligned_size = size - (size % 2);
+        for (size_t i = 0; i < aligned_size; i += 2, out += 2 * stride) {
+            const __m128i v = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(deltas + i));
+            const __m128i delta = _mm_xor_si128(_mm_srli_epi32(v, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, one)));
+            const __m128i sum = detail::prefix_sum_epi64_sse41(_mm_cvtepi32_epi64(delta), carry);
+            detail::store_epi64_sse41(out, stride, sum);
+            carry = _mm_unpackhi_epi64(sum, sum);
+        }
+        decode_scaled_last_delta_zig_zag_int32_scalar(
+            deltas + aligned_size, reinterpret_cast<int64_t*>(out), stride, size - aligned_size,
+            _mm_cvtsi128_si64(carry));
+    }
+
+    /// \brief AVX2 variant of decode_time_delta_scalar().
+    DFH_TARGET_AVX2 inline void decode_time_delta_avx2(
+            const uint32_t* deltas,
+            uint64_t* output,
+            size_t stride,
+            size_t size,
+            int64_t initial_time) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        __m256i carry = _mm256_set1_epi64x(initial_time);
+        const size_t aligned_size = size - (size % 4);
+        for (size_t i = 0; i < aligned_size; i += 4, out += 4 * stride) {
+            const __m256i x = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + i)));
+            const __m256i sum = detail::prefix_sum_epi64_avx2(x, carry);
+            detail::store_epi64_avx2(out, stride, sum);
+            carry = _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+        decode_time_delta_scalar(
+            deltas + aligned_size, reinterpret_cast<uint64_t*>(out), stride, size - aligned_size,
+            _mm_cvtsi128_si64(_mm256_castsi256_si128(carry)));
+    }
+
+    /// \brief AVX2 variant of decode_last_delta_zig_zag_int32_scalar().
+    /// \details AVX2 has no 64-bit integer to double conversion, so prices in [-2^51, 2^51)
+    /// are converted exactly with the magic-number trick; other lanes use the scalar conversion.
+    DFH_TARGET_AVX2 inline void decode_last_delta_zig_zag_int32_avx2(
+            const uint32_t* deltas,
+            double* output,
+            size_t stride,
+            size_t size,
+            double inv_price_scale,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m256i bias    = _mm256_set1_epi64x(1LL << 51);
+        const __m256d scale   = _mm256_set1_pd(inv_price_scale);
+        const __m128i one     = _mm_set1_epi32(1);
+        __m256i carry = _mm256_set1_epi64x(initial_price);
+        const size_t aligned_size = size - (size % 4);
+        for (size_t i = 0; i < aligned_size; i += 4, out += 4 * stride) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + i));
+            const __m128i delta = _mm_xor_si128(_mm_srli_epi32(v, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, one)));
+            const __m256i sum = detail::prefix_sum_epi64_avx2(_mm256_cvtepi32_epi64(delta), carry);
+            carry = _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 3, 3, 3));
+            if (!_mm256_testz_si256(_mm256_srli_epi64(_mm256_add_epi64(sum, bias), 52), _mm256_set1_epi64x(-1))) {
+                alignas(32) int64_t prices[4];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(prices), sum);
+                for (size_t j = 0; j < 4; ++j) {
+                    *reinterpret_cast<double*>(out + j * stride) = static_cast<double>(prices[j]) * inv_price_scale;
+                }
+                continue;
+            }
+            const __m256d price = _mm256_mul_pd(dfh::utils::int64_to_double(sum), scale);
+            detail::store_epi64_avx2(out, stride, _mm256_castpd_si256(price));
+        }
+        decode_last_delta_zig_zag_int32_scalar(
+            deltas + aligned_size, reinterpret_cast<double*>(out), stride, size - aligned_size,
+            inv_price_scale, _mm_cvtsi128_si64(_mm256_castsi256_si128(carry)));
+    }
+
+    /// \brief AVX2 variant of decode_scaled_last_delta_zig_zag_int32_scalar().
+    DFH_TARGET_AVX2 inline void decode_scaled_last_delta_zig_zag_int32_avx2(
+            const uint32_t* deltas,
+            int64_t* output,
+            size_t stride,
+            size_t size,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m128i one = _mm_set1_epi32(1);
+        __m256i carry = _mm256_set1_epi64x(initial_price);
+        const size_t aligned_size = size - (size % 4);
+        for (size_t i = 0; i < aligned_size; i += 4, out += 4 * stride) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(deltas + i));
+            const __m128i delta = _mm_xor_si128(_mm_srli_epi32(v, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, one)));
+            const __m256i sum = detail::prefix_sum_epi64_avx2(_mm256_cvtepi32_epi64(delta), carry);
+            detail::store_epi64_avx2(out, stride, sum);
+            carry = _mm256_permute4x64_epi64(sum, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+        decode_scaled_last_delta_zig_zag_int32_scalar(
+            deltas + aligned_size, reinterpret_cast<int64_t*>(out), stride, size - aligned_size,
+            _mm_cvtsi128_si64(_mm256_castsi256_si128(carry)));
+    }
+
+    /// \brief AVX-512 variant of decode_time_delta_scalar().
+    DFH_TARGET_AVX512 inline void decode_time_delta_avx512(
+            const uint32_t* deltas,
+            uint64_t* output,
+            size_t stride,
+            size_t size,
+            int64_t initial_time) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m512i last_lane = _mm512_set1_epi64(7);
+        const __m512i offsets = _mm512_mullo_epi64(
+            _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7),
+            _mm512_set1_epi64(static_cast<int64_t>(stride)));
+        __m512i carry = _mm512_set1_epi64(initial_time);
+        const size_t aligned_size = size - (size % 8);
+        for (size_t i = 0; i < aligned_size; i += 8, out += 8 * stride) {
+            const __m512i x = _mm512_cvtepu32_epi64(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(deltas + i)));
+            const __m512i sum = detail::prefix_sum_epi64_avx512(x, carry);
+            if (stride == sizeof(uint64_t)) {
+                _mm512_storeu_si512(out, sum);
+            } else {
+                _mm512_i64scatter_epi64(out, offsets, sum, 1);
+            }
+            carry = _mm512_permutexvar_epi64(last_lane, sum);
+        }
+        decode_time_delta_scalar(
+            deltas + aligned_size, reinterpret_cast<uint64_t*>(out), stride, size - aligned_size,
+            _mm_cvtsi128_si64(_mm512_castsi512_si128(carry)));
+    }
+
+    /// \brief AVX-512 variant of decode_last_delta_zig_zag_int32_scalar().
+    DFH_TARGET_AVX512 inline void decode_last_delta_zig_zag_int32_avx512(
+            const uint32_t* deltas,
+            double* output,
+            size_t stride,
+            size_t size,
+            double inv_price_scale,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m512i last_lane = _mm512_set1_epi64(7);
+        const __m512i offsets = _mm512_mullo_epi64(
+            _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7),
+            _mm512_set1_epi64(static_cast<int64_t>(stride)));
+        const __m512d scale = _mm512_set1_pd(inv_price_scale);
+        const __m256i one   = _mm256_set1_epi32(1);
+        __m512i carry = _mm512_set1_epi64(initial_price);
+        const size_t aligned_size = size - (size % 8);
+        for (size_t i = 0; i < aligned_size; i += 8, out += 8 * stride) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(deltas + i));
+            const __m256i delta = _mm256_xor_si256(_mm256_srli_epi32(v, 1), _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(v, one)));
+            const __m512i sum = detail::prefix_sum_epi64_avx512(_mm512_cvtepi32_epi64(delta), carry);
+            const __m512d price = _mm512_mul_pd(_mm512_cvtepi64_pd(sum), scale);
+            if (stride == sizeof(double)) {
+                _mm512_storeu_pd(out, price);
+            } else {
+                _mm512_i64scatter_pd(out, offsets, price, 1);
+            }
+            carry = _mm512_permutexvar_epi64(last_lane, sum);
+        }
+        decode_last_delta_zig_zag_int32_scalar(
+            deltas + aligned_size, reinterpret_cast<double*>(out), stride, size - aligned_size,
+            inv_price_scale, _mm_cvtsi128_si64(_mm512_castsi512_si128(carry)));
+    }
+
+    /// \brief AVX-512 variant of decode_scaled_last_delta_zig_zag_int32_scalar().
+    DFH_TARGET_AVX512 inline void decode_scaled_last_delta_zig_zag_int32_avx512(
+            const uint32_t* deltas,
+            int64_t* output,
+            size_t stride,
+            size_t size,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m512i last_lane = _mm512_set1_epi64(7);
+        const __m512i offsets = _mm512_mullo_epi64(
+            _mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7),
+            _mm512_set1_epi64(static_cast<int64_t>(stride)));
+        const __m256i one = _mm256_set1_epi32(1);
+        __m512i carry = _mm512_set1_epi64(initial_price);
+        const size_t aligned_size = size - (size % 8);
+        for (size_t i = 0; i < aligned_size; i += 8, out += 8 * stride) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(deltas + i));
+            const __m256i delta = _mm256_xor_si256(_mm256_srli_epi32(v, 1), _mm256_sub_epi32(_mm256_setzero_si256(), _mm256_and_si256(v, one)));
+            const __m512i sum = detail::prefix_sum_epi64_avx512(_mm512_cvtepi32_epi64(delta), carry);
+            if (stride == sizeof(int64_t)) {
+                _mm512_storeu_si512(out, sum);
+            } else {
+                _mm512_i64scatter_epi64(out, offsets, sum, 1);
+            }
+            carry = _mm512_permutexvar_epi64(last_lane, sum);
+        }
+        decode_scaled_last_delta_zig_zag_int32_scalar(
+            deltas + aligned_size, reinterpret_cast<int64_t*>(out), stride, size - aligned_size,
+            _mm_cvtsi128_si64(_mm512_castsi512_si128(carry)));
+    }
+
+#   endif // DFH_ARCH_X86
+
+    /// \struct PrefixSumKernels
+    /// \brief Prefix-sum decode kernels selected for the current CPU.
+    struct PrefixSumKernels {
+        dfh::utils::SimdLevel level = dfh::utils::SimdLevel::SCALAR; ///< Level of the selected variants.
+        void (*decode_time_delta)(const uint32_t*, uint64_t*, size_t, size_t, int64_t) = decode_time_delta_scalar;
+        void (*decode_last_delta_zig_zag_int32)(const uint32_t*, double*, size_t, size_t, double, int64_t) = decode_last_delta_zig_zag_int32_scalar;
+        void (*decode_scaled_last_delta_zig_zag_int32)(const uint32_t*, int64_t*, size_t, size_t, int64_t) = decode_scaled_last_delta_zig_zag_int32_scalar;
+    };
+
+    /// \brief Returns the prefix-sum kernels for dfh::utils::active_simd_level(), resolved once per process.
+    inline const PrefixSumKernels& prefix_sum_kernels() {
+        static const PrefixSumKernels kernels = [] {
+            using dfh::utils::SimdLevel;
+            PrefixSumKernels k;
+#           if defined(DFH_ARCH_X86)
+            const SimdLevel level = dfh::utils::active_simd_level();
+            if (level >= SimdLevel::AVX512) {
+                k.level = SimdLevel::AVX512;
+                k.decode_time_delta = decode_time_delta_avx512;
+                k.decode_last_delta_zig_zag_int32 = decode_last_delta_zig_zag_int32_avx512;
+                k.decode_scaled_last_delta_zig_zag_int32 = decode_scaled_last_delta_zig_zag_int32_avx512;
+            } else if (level >= SimdLevel::AVX2) {
+                k.level = SimdLevel::AVX2;
+                k.decode_time_delta = decode_time_delta_avx2;
+                k.decode_last_delta_zig_zag_int32 = decode_last_delta_zig_zag_int32_avx2;
+                k.decode_scaled_last_delta_zig_zag_int32 = decode_scaled_last_delta_zig_zag_int32_avx2;
+            } else if (level >= SimdLevel::SSE41) {
+                k.level = SimdLevel::SSE41;
+                k.decode_time_delta = decode_time_delta_sse41;
+                k.decode_last_delta_zig_zag_int32 = decode_last_delta_zig_zag_int32_sse41;
+                k.decode_scaled_last_delta_zig_zag_int32 = decode_scaled_last_delta_zig_zag_int32_sse41;
+            }
+#           endif
+            return k;
+        }();
+        return kernels;
+    }
+
+}; // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_UTILS_PREFIX_SUM_HPP_INCLUDED
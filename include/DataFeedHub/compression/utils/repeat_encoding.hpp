@@ -311,6 +311,27 @@ namespace dfh::compression {
         }
     }
 
+    inline void decode_run_length(
+            const uint64_t* encoded,
+            size_t encoded_size,
+            uint64_t* decoded,
+            size_t& decoded_size) {
+        uint64_t repeat_count, value, j;
+        decoded_size = 0;
+        for (size_t i = 0; i < encoded_size; ++i) {
+            value = encoded[i];
+            if (value & 0x1) {
+                value >>= 1; ++i;
+                repeat_count = encoded[i];
+                for (j = 0; j < repeat_count; ++j) {
+                    decoded[decoded_size++] = value;
+                }
+            } else {
+                decoded[decoded_size++] = value >> 1;
+            }
+        }
+    }
+
 };
 
 #endif // _DFH_COMPRESSION_UTILS_REPEAT_ENCODING_HPP_INCLUDED
@@ -0,0 +1,296 @@
+#pragma once
+#ifndef _DFH_COMPRESSION_UTILS_TIME_BITMAP_HPP_INCLUDED
+#define _DFH_COMPRESSION_UTILS_TIME_BITMAP_HPP_INCLUDED
+
+/// \file time_bitmap.hpp
+/// \brief Implicit timestamps for bars: a bitmap of occupied slots on the timeframe grid.
+/// \details A segment of bars starts at `base_time` and has a fixed number of slots of
+/// `bar_ms` each (3600 for S1 in an hourly segment, 7 for D1 in a weekly segment). Bit `i`
+/// of the bitmap is set when the segment holds a bar with `time_ms == base_time + i * bar_ms`,
+/// so timestamps cost one bit per slot instead of eight bytes per bar. Expansion back to
+/// timestamps uses AVX2/AVX-512 kernels selected at runtime from dfh::utils::active_simd_level().
+
+namespace dfh::compression {
+
+    namespace detail {
+
+        /// \brief Returns the index of the lowest set bit (the value must be non-zero).
+        inline unsigned count_trailing_zeros(uint64_t value) {
+#           if defined(_MSC_VER)
+            unsigned long index = 0;
+            _BitScanForward64(&index, value);
+            return static_cast<unsigned>(index);
+#           else
+            return static_cast<unsigned>(__builtin_ctzll(value));
+#           endif
+        }
+
+        /// \brief Returns the number of set bits of an 8-bit mask.
+        inline unsigned count_set_bits(uint32_t mask) {
+            mask = mask - ((mask >> 1) & 0x55u);
+            mask = (mask & 0x33u) + ((mask >> 2) & 0x33u);
+            return (mask + (mask >> 4)) & 0x0Fu;
+        }
+
+    } // namespace detail
+
+    /// \brief Marks the grid slots occupied by the bars.
+    /// \tparam BarType Bar type with a `time_ms` member.
+    /// \param bars Bars in strictly increasing time order.
+    /// \param num_bars Number of bars.
+    /// \param base_time Start of the segment in milliseconds.
+    /// \param bar_ms Bar duration in milliseconds.
+    /// \param num_slots Number of slots in the segment.
+    /// \param bitmap Receives the bitmap (resized to `num_slots`).
+    /// \return False if a bar is off the grid, outside the segment or out of order; the bitmap
+    ///         is then unspecified and the caller must store timestamps explicitly.
+    template<class BarType>
+    bool build_time_bitmap(
+            const BarType* bars,
+            size_t num_bars,
+            uint64_t base_time,
+            uint64_t bar_ms,
+            size_t num_slots,
+            dfh::utils::DynamicBitset& bitmap) {
+        bitmap.clear();
+        bitmap.resize(num_slots);
+        if (bar_ms == 0) return false;
+        uint64_t* blocks = bitmap.data();
+        uint64_t next_slot = 0;
+        for (size_t i = 0; i < num_bars; ++i) {
+            const uint64_t time_ms = bars[i].time_ms;
+            if (time_ms < base_time) return false;
+            const uint64_t offset = time_ms - base_time;
+            const uint64_t slot = offset / bar_ms;
+            if (slot * bar_ms != offset || slot < next_slot || slot >= num_slots) return false;
+            blocks[slot >> 6] |= (1ULL << (slot & 63));
+            next_slot = slot + 1;
+        }
+        return true;
+    }
+
+    /// \brief Appends the bitmap as `ceil(size / 8)` bytes, least significant bit first.
+    /// \param output Buffer to append to.
+    /// \param bitmap Bitmap built by build_time_bitmap().
+    inline void append_time_bitmap(std::vector<uint8_t>& output, const dfh::utils::DynamicBitset& bitmap) {
+        const size_t num_bytes = (bitmap.size() + 7) / 8;
+        const uint64_t* blocks = bitmap.data();
+        output.reserve(output.size() + num_bytes);
+        for (size_t i = 0; i < num_bytes; ++i) {
+            output.push_back(static_cast<uint8_t>(blocks[i >> 3] >> ((i & 7) * 8)));
+        }
+    }
+
+    /// \brief Reads a bitmap written by append_time_bitmap().
+    /// \param binary Buffer holding the bitmap.
+    /// \param offset Current offset in the buffer, advanced past the bitmap.
+    /// \param num_slots Number of slots in the segment.
+    /// \param bitmap Receives the bitmap.
+    inline void extract_time_bitmap(
+            const uint8_t* binary,
+            size_t& offset,
+            size_t num_slots,
+            dfh::utils::DynamicBitset& bitmap) {
+        bitmap.clear();
+        bitmap.resize(num_slots);
+        const size_t num_bytes = (num_slots + 7) / 8;
+        uint64_t* blocks = bitmap.data();
+        for (size_t i = 0; i < num_bytes; ++i) {
+            blocks[i >> 3] |= static_cast<uint64_t>(binary[offset + i]) << ((i & 7) * 8);
+        }
+        if (num_slots & 63) {
+            blocks[num_slots >> 6] &= (1ULL << (num_slots & 63)) - 1;
+        }
+        offset += num_bytes;
+    }
+
+    /// \brief Writes the timestamps of all set slots: one per set bit, in slot order.
+    /// \param blocks Bitmap blocks; bit `i` of block `b` is slot `64 * b + i`.
+    /// \param num_blocks Number of blocks.
+    /// \param base_time Time of slot 0 in milliseconds.
+    /// \param bar_ms Bar duration in milliseconds.
+    /// \param output Pointer to the first timestamp.
+    /// \param stride Distance in bytes between consecutive timestamps.
+    inline void expand_time_bitmap_scalar(
+            const uint64_t* blocks,
+            size_t num_blocks,
+            uint64_t base_time,
+            uint64_t bar_ms,
+            uint64_t* output,
+            size_t stride) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        for (size_t b = 0; b < num_blocks; ++b) {
+            const uint64_t block_time = base_time + static_cast<uint64_t>(b) * 64 * bar_ms;
+            for (uint64_t block = blocks[b]; block; block &= block - 1, out += stride) {
+                *reinterpret_cast<uint64_t*>(out) = block_time + detail::count_trailing_zeros(block) * bar_ms;
+            }
+        }
+    }
+
+#   if defined(DFH_ARCH_X86)
+
+    namespace detail {
+
+        /// \brief Lane permutations that move the 64-bit lanes selected by a 4-bit mask to the front.
+        /// \details Entry `m` holds 32-bit indices for `_mm256_permutevar8x32_epi32()`.
+        struct CompressPermutationsEpi64x4 {
+            alignas(32) uint32_t indices[16][8];
+
+            CompressPermutationsEpi64x4() : indices{} {
+                for (uint32_t mask = 0; mask < 16; ++mask) {
+                    uint32_t lane = 0;
+                    for (uint32_t j = 0; j < 4; ++j) {
+                        if (!(mask & (1u << j))) continue;
+                        indices[mask][2 * lane] = 2 * j;
+                        indices[mask][2 * lane + 1] = 2 * j + 1;
+                        ++lane;
+                    }
+                }
+            }
+        };
+
+        /// \brief Returns the shared permutation table.
+        inline const CompressPermutationsEpi64x4& compress_permutations_epi64x4() {
+            static const CompressPermutationsEpi64x4 table;
+            return table;
+        }
+
+    } // namespace detail
+
+    /// \brief AVX2 variant of expand_time_bitmap_scalar().
+    /// \details Builds the timestamps of four slots at once, packs the occupied ones to the front
+    /// with a lane permutation and writes them with a masked store.
+    DFH_TARGET_AVX2 inline void expand_time_bitmap_avx2(
+            const uint64_t* blocks,
+            size_t num_blocks,
+            uint64_t base_time,
+            uint64_t bar_ms,
+            uint64_t* output,
+            size_t stride) {
+        const auto& permutations = detail::compress_permutations_epi64x4();
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m256i lane_index = _mm256_set_epi64x(3, 2, 1, 0);
+        const __m256i nibble_step = _mm256_set1_epi64x(static_cast<int64_t>(4 * bar_ms));
+        const __m256i block_step = _mm256_set1_epi64x(static_cast<int64_t>(64 * bar_ms));
+        __m256i block_times = _mm256_set_epi64x(
+            static_cast<int64_t>(base_time + 3 * bar_ms), static_cast<int64_t>(base_time + 2 * bar_ms),
+            static_cast<int64_t>(base_time + bar_ms), static_cast<int64_t>(base_time));
+        alignas(32) uint64_t lanes[4];
+        for (size_t b = 0; b < num_blocks; ++b, block_times = _mm256_add_epi64(block_times, block_step)) {
+            const uint64_t block = blocks[b];
+            if (!block) continue;
+            __m256i times = block_times;
+            for (unsigned k = 0; k < 64; k += 4, times = _mm256_add_epi64(times, nibble_step)) {
+                const uint32_t mask = static_cast<uint32_t>(block >> k) & 0x0F;
+                if (!mask) continue;
+                const unsigned count = detail::count_set_bits(mask);
+                const __m256i packed = _mm256_permutevar8x32_epi32(
+                    times, _mm256_load_si256(reinterpret_cast<const __m256i*>(permutations.indices[mask])));
+                if (stride == sizeof(uint64_t)) {
+                    const __m256i store_mask = _mm256_cmpgt_epi64(_mm256_set1_epi64x(count), lane_index);
+                    _mm256_maskstore_epi64(reinterpret_cast<long long*>(out), store_mask, packed);
+                } else {
+                    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), packed);
+                    for (unsigned j = 0; j < count; ++j) {
+                        *reinterpret_cast<uint64_t*>(out + j * stride) = lanes[j];
+                    }
+                }
+                out += count * stride;
+            }
+        }
+    }
+
+    /// \brief AVX-512 variant of expand_time_bitmap_scalar().
+    /// \details Builds the timestamps of eight slots at once and writes the occupied ones with a
+    /// compress-store, or with a compress and a scatter for strided output.
+    DFH_TARGET_AVX512 inline void expand_time_bitmap_avx512(
+            const uint64_t* blocks,
+            size_t num_blocks,
+            uint64_t base_time,
+            uint64_t bar_ms,
+            uint64_t* output,
+            size_t stride) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(output);
+        const __m512i lane_index = _mm512_set_epi64(7, 6, 5, 4, 3, 2, 1, 0);
+        const __m512i scatter_index = _mm512_mullo_epi64(lane_index, _mm512_set1_epi64(static_cast<int64_t>(stride)));
+        const __m512i byte_step = _mm512_set1_epi64(static_cast<int64_t>(8 * bar_ms));
+        const __m512i block_step = _mm512_set1_epi64(static_cast<int64_t>(64 * bar_ms));
+        __m512i block_times = _mm512_add_epi64(
+            _mm512_set1_epi64(static_cast<int64_t>(base_time)),
+            _mm512_mullo_epi64(lane_index, _mm512_set1_epi64(static_cast<int64_t>(bar_ms))));
+        for (size_t b = 0; b < num_blocks; ++b, block_times = _mm512_add_epi64(block_times, block_step)) {
+            const uint64_t block = blocks[b];
+            if (!block) continue;
+            __m512i times = block_times;
+            for (unsigned k = 0; k < 64; k += 8, times = _mm512_add_epi64(times, byte_step)) {
+                const __mmask8 mask = static_cast<__mmask8>(block >> k);
+                if (!mask) continue;
+                const unsigned count = detail::count_set_bits(mask);
+                if (stride == sizeof(uint64_t)) {
+                    _mm512_mask_compressstoreu_epi64(out, mask, times);
+                } else {
+                    _mm512_mask_i64scatter_epi64(
+                        out, static_cast<__mmask8>((1u << count) - 1), scatter_index,
+                        _mm512_maskz_compress_epi64(mask, times), 1);
+                }
+                out += count * stride;
+            }
+        }
+    }
+
+#   endif // DFH_ARCH_X86
+
+    /// \struct TimeBitmapKernels
+    /// \brief Bitmap expansion kernels selected for the current CPU.
+    struct TimeBitmapKernels {
+        dfh::utils::SimdLevel level = dfh::utils::SimdLevel::SCALAR; ///< Level of the selected variant.
+        void (*expand)(const uint64_t*, size_t, uint64_t, uint64_t, uint64_t*, size_t) = expand_time_bitmap_scalar;
+    };
+
+    /// \brief Returns the expansion kernels for dfh::utils::active_simd_level(), resolved once per process.
+    /// \details The SSE4.1 level uses the scalar kernel; two lanes do not pay for the permutation.
+    inline const TimeBitmapKernels& time_bitmap_kernels() {
+        static const TimeBitmapKernels kernels = [] {
+            using dfh::utils::SimdLevel;
+            TimeBitmapKernels k;
+#           if defined(DFH_ARCH_X86)
+            const SimdLevel level = dfh::utils::active_simd_level();
+            if (level >= SimdLevel::AVX512) {
+                k.level = SimdLevel::AVX512;
+                k.expand = expand_time_bitmap_avx512;
+            } else if (level >= SimdLevel::AVX2) {
+                k.level = SimdLevel::AVX2;
+                k.expand = expand_time_bitmap_avx2;
+            }
+#           endif
+            return k;
+        }();
+        return kernels;
+    }
+
+    /// \brief Rebuilds bar timestamps from the slot bitmap.
+    /// \tparam BarType Bar type with a `time_ms` member.
+    /// \param bitmap Slot bitmap.
+    /// \param base_time Start of the segment in milliseconds.
+    /// \param bar_ms Bar duration in milliseconds.
+    /// \param bars Destination bars; `time_ms` of the first `num_bars` bars is written.
+    /// \param num_bars Number of bars; must equal the number of set bits.
+    /// \throw std::runtime_error if the bitmap does not hold exactly `num_bars` slots.
+    template<class BarType>
+    void expand_time_bitmap(
+            const dfh::utils::DynamicBitset& bitmap,
+            uint64_t base_time,
+            uint64_t bar_ms,
+            BarType* bars,
+            size_t num_bars) {
+        if (bitmap.count() != num_bars) {
+            throw std::runtime_error("Time bitmap does not match the number of bars.");
+        }
+        if (num_bars == 0) return;
+        time_bitmap_kernels().expand(
+            bitmap.data(), bitmap.num_blocks(), base_time, bar_ms, &bars[0].time_ms, sizeof(BarType));
+    }
+
+} // namespace dfh::compression
+
+#endif // _DFH_COMPRESSION_UTILS_TIME_BITMAP_HPP_INCLUDED
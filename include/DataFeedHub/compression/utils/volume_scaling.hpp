@@ -7,6 +7,47 @@
 
 namespace dfh::compression {
 
+    /// \brief Scales volumes read with a byte stride to `uint32_t`.
+    /// \param volume Pointer to the first volume.
+    /// \param stride Distance in bytes between consecutive volumes.
+    /// \param output Output array for scaled volume values.
+    /// \param size Number of elements to process.
+    /// \param scale Multiplicative scale factor.
+    /// \throw std::overflow_error if a scaled volume does not fit into uint32.
+    inline void scale_volume_int32_strided(
+            const double* volume,
+            size_t stride,
+            uint32_t* output,
+            size_t size,
+            double scale) {
+        constexpr int64_t max_val = static_cast<int64_t>(std::numeric_limits<uint32_t>::max());
+        const uint8_t* in = reinterpret_cast<const uint8_t*>(volume);
+        int64_t value;
+        for (size_t i = 0; i < size; ++i, in += stride) {
+            value = std::llround(*reinterpret_cast<const double*>(in) * scale);
+            if (value > max_val) throw std::overflow_error("?");
+            output[i] = static_cast<uint32_t>(value);
+        }
+    }
+
+    /// \brief Scales volumes read with a byte stride to `uint64_t`.
+    /// \param volume Pointer to the first volume.
+    /// \param stride Distance in bytes between consecutive volumes.
+    /// \param output Output array for scaled volume values.
+    /// \param size Number of elements to process.
+    /// \param scale Multiplicative scale factor.
+    inline void scale_volume_int64_strided(
+            const double* volume,
+            size_t stride,
+            uint64_t* output,
+            size_t size,
+            double scale) {
+        const uint8_t* in = reinterpret_cast<const uint8_t*>(volume);
+        for (size_t i = 0; i < size; ++i, in += stride) {
+            output[i] = static_cast<uint64_t>(std::llround(*reinterpret_cast<const double*>(in) * scale));
+        }
+    }
+
     /// \brief Scales the `volume` field of tick data to `uint32_t` using the provided scale factor.
     /// \tparam TickType Type of tick structure.
     /// \param ticks Pointer to input ticks.
@@ -19,13 +60,17 @@ namespace dfh::compression {
             uint32_t* output,
             size_t size,
             double scale) {
-        constexpr int64_t max_val = static_cast<int64_t>(std::numeric_limits<uint32_t>::max());
-        int64_t volume;
-        for (size_t i = 0; i < size; ++i) {
-            volume = std::llround(ticks[i].volume * scale);
-            if (volume > max_val) throw std::overflow_error("?");
-            output[i] = static_cast<uint32_t>(volume);
-        }
+        if (size == 0) return;
+        scale_volume_int32_strided(&ticks[0].volume, sizeof(TickType), output, size, scale);
+    }
+
+    /// \brief Scales a contiguous volume column to `uint32_t`.
+    inline void scale_volume_int32(
+            const double* volume,
+            uint32_t* output,
+            size_t size,
+            double scale) {
+        scale_volume_int32_strided(volume, sizeof(double), output, size, scale);
     }
 
     /// \brief Scales the `volume` field of tick data to `uint64_t` using the provided scale factor.
@@ -40,8 +85,37 @@ namespace dfh::compression {
             uint64_t* output,
             size_t size,
             double scale) {
-        for (size_t i = 0; i < size; ++i) {
-            output[i] = static_cast<uint64_t>(std::llround(ticks[i].volume * scale));
+        if (size == 0) return;
+        scale_volume_int64_strided(&ticks[0].volume, sizeof(TickType), output, size, scale);
+    }
+
+    /// \brief Scales a contiguous volume column to `uint64_t`.
+    inline void scale_volume_int64(
+            const double* volume,
+            uint64_t* output,
+            size_t size,
+            double scale) {
+        scale_volume_int64_strided(volume, sizeof(double), output, size, scale);
+    }
+
+    /// \brief Restores scaled volumes into values written with a byte stride.
+    /// \tparam InputType Scaled input type (e.g., uint32_t).
+    /// \param input Pointer to scaled volume values.
+    /// \param volume Pointer to the first restored volume.
+    /// \param stride Distance in bytes between consecutive volumes.
+    /// \param size Number of elements to process.
+    /// \param scale Original scale factor used in compression.
+    template<class InputType>
+    void scale_volume_strided(
+            const InputType* input,
+            double* volume,
+            size_t stride,
+            size_t size,
+            double scale) {
+        const double inv_scale = 1.0 / scale;
+        uint8_t* out = reinterpret_cast<uint8_t*>(volume);
+        for (size_t i = 0; i < size; ++i, out += stride) {
+            *reinterpret_cast<double*>(out) = static_cast<double>(input[i]) * inv_scale;
         }
     }
 
@@ -58,10 +132,18 @@ namespace dfh::compression {
             TickType* ticks,
             size_t size,
             double scale) {
-        const double inv_scale = 1.0 / scale;
-        for (size_t i = 0; i < size; ++i) {
-            ticks[i].volume = static_cast<double>(input[i]) * inv_scale;
-        }
+        if (size == 0) return;
+        scale_volume_strided(input, &ticks[0].volume, sizeof(TickType), size, scale);
+    }
+
+    /// \brief Restores scaled volumes into a contiguous volume column.
+    template<class InputType>
+    void scale_volume(
+            const InputType* input,
+            double* volume,
+            size_t size,
+            double scale) {
+        scale_volume_strided(input, volume, sizeof(double), size, scale);
     }
 
 }; // namespace dfh::compression
@@ -134,37 +134,68 @@ namespace dfh::compression {
 
 //------------------------------------------------------------------------------
 
-    template<class TickType>
-    void encode_time_delta(
-            const TickType* ticks,
+    /// \brief Encodes timestamps read with a byte stride as unsigned deltas.
+    /// \param time_ms Pointer to the first timestamp.
+    /// \param stride Distance in bytes between consecutive timestamps.
+    /// \param output Output deltas.
+    /// \param size Number of timestamps.
+    /// \param initial_time Timestamp preceding the first one.
+    /// \throw std::overflow_error if timestamps are not sorted.
+    inline void encode_time_delta_strided(
+            const uint64_t* time_ms,
+            size_t stride,
             uint32_t* output,
             size_t size,
             int64_t initial_time) {
         if (size == 0) return;
 
-        if (ticks[0].time_ms < static_cast<uint64_t>(initial_time)) {
+        const uint8_t* in = reinterpret_cast<const uint8_t*>(time_ms);
+        uint64_t prev = *reinterpret_cast<const uint64_t*>(in);
+        if (prev < static_cast<uint64_t>(initial_time)) {
             throw std::overflow_error(
                 "encode_time_delta: The first tick's timestamp ("
-                + std::to_string(ticks[0].time_ms)
+                + std::to_string(prev)
                 + ") is less than the initial_time ("
                 + std::to_string(initial_time) + ")."
             );
         }
 
-        output[0] = ticks[0].time_ms - initial_time;
+        output[0] = prev - initial_time;
         for (size_t i = 1; i < size; ++i) {
-            if (ticks[i].time_ms < ticks[i - 1].time_ms) {
+            in += stride;
+            const uint64_t time = *reinterpret_cast<const uint64_t*>(in);
+            if (time < prev) {
                 throw std::overflow_error(
                     "encode_time_delta: The timestamp of tick at index "
-                    + std::to_string(i) + " (" + std::to_string(ticks[i].time_ms)
+                    + std::to_string(i) + " (" + std::to_string(time)
                     + ") is less than the timestamp of the previous tick ("
-                    + std::to_string(ticks[i - 1].time_ms) + ")."
+                    + std::to_string(prev) + ")."
                 );
             }
-            output[i] = ticks[i].time_ms - ticks[i - 1].time_ms;
+            output[i] = time - prev;
+            prev = time;
         }
     }
 
+    template<class TickType>
+    void encode_time_delta(
+            const TickType* ticks,
+            uint32_t* output,
+            size_t size,
+            int64_t initial_time) {
+        if (size == 0) return;
+        encode_time_delta_strided(&ticks[0].time_ms, sizeof(TickType), output, size, initial_time);
+    }
+
+    /// \brief Encodes a contiguous timestamp column as unsigned deltas.
+    inline void encode_time_delta(
+            const uint64_t* time_ms,
+            uint32_t* output,
+            size_t size,
+            int64_t initial_time) {
+        encode_time_delta_strided(time_ms, sizeof(uint64_t), output, size, initial_time);
+    }
+
     template<class TickType>
     void decode_time_delta(
             const uint32_t* deltas,
@@ -172,30 +203,73 @@ namespace dfh::compression {
             size_t size,
             int64_t initial_time) {
         if (size == 0) return;
+        prefix_sum_kernels().decode_time_delta(deltas, &ticks[0].time_ms, sizeof(TickType), size, initial_time);
+    }
 
-        ticks[0].time_ms = deltas[0] + initial_time;
-        for (size_t i = 1; i < size; ++i) {
-            ticks[i].time_ms = ticks[i - 1].time_ms + deltas[i];
+    /// \brief Decodes time deltas into a contiguous timestamp column.
+    inline void decode_time_delta(
+            const uint32_t* deltas,
+            uint64_t* time_ms,
+            size_t size,
+            int64_t initial_time) {
+        prefix_sum_kernels().decode_time_delta(deltas, time_ms, sizeof(uint64_t), size, initial_time);
+    }
+
+    /// \brief Replaces time deltas by their Zig-Zag encoded differences (delta-of-delta), in place.
+    /// \details `deltas[i] - deltas[i - 1]` with `deltas[-1] = 0`. Regular feeds turn into runs of zeros.
+    /// \param deltas Time deltas; overwritten with the second-order deltas.
+    /// \param size Number of deltas.
+    /// \return False (with `deltas` unchanged) if a delta does not fit into int32.
+    inline bool encode_delta_of_delta_int32(uint32_t* deltas, size_t size) {
+        constexpr uint32_t max_delta = static_cast<uint32_t>(std::numeric_limits<int32_t>::max());
+        for (size_t i = 0; i < size; ++i) {
+            if (deltas[i] > max_delta) return false;
+        }
+        int32_t prev = 0;
+        for (size_t i = 0; i < size; ++i) {
+            const int32_t delta = static_cast<int32_t>(deltas[i]);
+            const int32_t dod = delta - prev;
+            deltas[i] = (static_cast<uint32_t>(dod) << 1) ^ static_cast<uint32_t>(dod >> 31);
+            prev = delta;
+        }
+        return true;
+    }
+
+    /// \brief Restores time deltas from Zig-Zag encoded delta-of-delta values, in place.
+    /// \param deltas Second-order deltas; overwritten with the time deltas.
+    /// \param size Number of deltas.
+    inline void decode_delta_of_delta_int32(uint32_t* deltas, size_t size) {
+        uint32_t delta = 0;
+        for (size_t i = 0; i < size; ++i) {
+            delta += static_cast<uint32_t>((deltas[i] >> 1) ^ -(deltas[i] & 1));
+            deltas[i] = delta;
         }
     }
 
 //------------------------------------------------------------------------------
 
-    template<class TickType>
-    void encode_last_delta_zig_zag_int32(
-            const TickType* ticks,
+    /// \brief Encodes prices read with a byte stride as Zig-Zag 32-bit deltas of scaled prices.
+    /// \param last Pointer to the first price.
+    /// \param stride Distance in bytes between consecutive prices.
+    /// \param output Output deltas.
+    /// \param size Number of prices.
+    /// \param price_scale Price scale.
+    /// \param initial_price Scaled price preceding the first one.
+    /// \throw std::overflow_error if a delta does not fit into int32.
+    inline void encode_last_delta_zig_zag_int32_strided(
+            const double* last,
+            size_t stride,
             uint32_t* output,
             size_t size,
             double price_scale,
             int64_t initial_price) {
-        if (size == 0) return;
-
         constexpr int64_t min_val = static_cast<int64_t>(std::numeric_limits<int32_t>::min());
         constexpr int64_t max_val = static_cast<int64_t>(std::numeric_limits<int32_t>::max());
+        const uint8_t* in = reinterpret_cast<const uint8_t*>(last);
         int64_t raw_delta, scaled_price;
         int32_t delta;
-        for (size_t i = 0; i < size; ++i) {
-            scaled_price = std::llround(ticks[i].last * price_scale);
+        for (size_t i = 0; i < size; ++i, in += stride) {
+            scaled_price = std::llround(*reinterpret_cast<const double*>(in) * price_scale);
             raw_delta = scaled_price - initial_price;
             if (raw_delta < min_val || raw_delta > max_val) throw std::overflow_error("Delta overflow: scaled_price - initial_price > int32 range");
             delta = static_cast<int32_t>(raw_delta);
@@ -204,6 +278,27 @@ namespace dfh::compression {
         }
     }
 
+    template<class TickType>
+    void encode_last_delta_zig_zag_int32(
+            const TickType* ticks,
+            uint32_t* output,
+            size_t size,
+            double price_scale,
+            int64_t initial_price) {
+        if (size == 0) return;
+        encode_last_delta_zig_zag_int32_strided(&ticks[0].last, sizeof(TickType), output, size, price_scale, initial_price);
+    }
+
+    /// \brief Encodes a contiguous price column as Zig-Zag 32-bit deltas of scaled prices.
+    inline void encode_last_delta_zig_zag_int32(
+            const double* last,
+            uint32_t* output,
+            size_t size,
+            double price_scale,
+            int64_t initial_price) {
+        encode_last_delta_zig_zag_int32_strided(last, sizeof(double), output, size, price_scale, initial_price);
+    }
+
     template<class TickType>
     void decode_last_delta_zig_zag_int32(
             const uint32_t* deltas,
@@ -211,13 +306,48 @@ namespace dfh::compression {
             size_t size,
             double price_scale,
             int64_t initial_price) {
-        int64_t scaled_price;
-        double inv_initial_price = 1.0 / price_scale;
-        int32_t delta;
-        for (size_t i = 0; i < size; ++i) {
-            delta = (deltas[i] >> 1) ^ -(deltas[i] & 1);
-            scaled_price = initial_price + delta;
-            ticks[i].last = static_cast<double>(scaled_price) * inv_initial_price;
+        if (size == 0) return;
+        prefix_sum_kernels().decode_last_delta_zig_zag_int32(
+            deltas, &ticks[0].last, sizeof(TickType), size, 1.0 / price_scale, initial_price);
+    }
+
+    /// \brief Decodes Zig-Zag price deltas into a contiguous price column.
+    inline void decode_last_delta_zig_zag_int32(
+            const uint32_t* deltas,
+            double* last,
+            size_t size,
+            double price_scale,
+            int64_t initial_price) {
+        prefix_sum_kernels().decode_last_delta_zig_zag_int32(
+            deltas, last, sizeof(double), size, 1.0 / price_scale, initial_price);
+    }
+
+    /// \brief Decodes Zig-Zag price deltas into a column of scaled integer prices.
+    /// \param price_scale Ignored; prices stay multiplied by the scale of the segment.
+    inline void decode_last_delta_zig_zag_int32(
+            const uint32_t* deltas,
+            int64_t* last,
+            size_t size,
+            double /*price_scale*/,
+            int64_t initial_price) {
+        prefix_sum_kernels().decode_scaled_last_delta_zig_zag_int32(
+            deltas, last, sizeof(int64_t), size, initial_price);
+    }
+
+    /// \brief Encodes prices read with a byte stride as Zig-Zag 64-bit deltas of scaled prices.
+    inline void encode_last_delta_zig_zag_int64_strided(
+            const double* last,
+            size_t stride,
+            uint64_t* output,
+            size_t size,
+            double price_scale,
+            int64_t initial_price) {
+        const uint8_t* in = reinterpret_cast<const uint8_t*>(last);
+        int64_t scaled_price, delta;
+        for (size_t i = 0; i < size; ++i, in += stride) {
+            scaled_price = std::llround(*reinterpret_cast<const double*>(in) * price_scale);
+            delta = scaled_price - initial_price;
+            output[i] = (delta << 1) ^ (delta >> 63);
             initial_price = scaled_price;
         }
     }
@@ -230,11 +360,34 @@ namespace dfh::compression {
             double price_scale,
             int64_t initial_price) {
         if (size == 0) return;
+        encode_last_delta_zig_zag_int64_strided(&ticks[0].last, sizeof(TickType), output, size, price_scale, initial_price);
+    }
+
+    /// \brief Encodes a contiguous price column as Zig-Zag 64-bit deltas of scaled prices.
+    inline void encode_last_delta_zig_zag_int64(
+            const double* last,
+            uint64_t* output,
+            size_t size,
+            double price_scale,
+            int64_t initial_price) {
+        encode_last_delta_zig_zag_int64_strided(last, sizeof(double), output, size, price_scale, initial_price);
+    }
+
+    /// \brief Decodes Zig-Zag 64-bit price deltas into prices written with a byte stride.
+    inline void decode_last_delta_zig_zag_int64_strided(
+            const uint64_t* deltas,
+            double* last,
+            size_t stride,
+            size_t size,
+            double price_scale,
+            int64_t initial_price) {
+        uint8_t* out = reinterpret_cast<uint8_t*>(last);
         int64_t scaled_price, delta;
-        for (size_t i = 0; i < size; ++i) {
-            scaled_price = std::llround(ticks[i].last * price_scale);
-            delta = scaled_price - initial_price;
-            output[i] = (delta << 1) ^ (delta >> 63);
+        double inv_initial_price = 1.0 / price_scale;
+        for (size_t i = 0; i < size; ++i, out += stride) {
+            delta = (deltas[i] >> 1) ^ -(deltas[i] & 1);
+            scaled_price = initial_price + delta;
+            *reinterpret_cast<double*>(out) = static_cast<double>(scaled_price) * inv_initial_price;
             initial_price = scaled_price;
         }
     }
@@ -246,13 +399,31 @@ namespace dfh::compression {
             size_t size,
             double price_scale,
             int64_t initial_price) {
-        int64_t scaled_price, delta;
-        double inv_initial_price = 1.0 / price_scale;
+        if (size == 0) return;
+        decode_last_delta_zig_zag_int64_strided(deltas, &ticks[0].last, sizeof(TickType), size, price_scale, initial_price);
+    }
+
+    /// \brief Decodes Zig-Zag 64-bit price deltas into a contiguous price column.
+    inline void decode_last_delta_zig_zag_int64(
+            const uint64_t* deltas,
+            double* last,
+            size_t size,
+            double price_scale,
+            int64_t initial_price) {
+        decode_last_delta_zig_zag_int64_strided(deltas, last, sizeof(double), size, price_scale, initial_price);
+    }
+
+    /// \brief Decodes Zig-Zag 64-bit price deltas into a column of scaled integer prices.
+    /// \param price_scale Ignored; prices stay multiplied by the scale of the segment.
+    inline void decode_last_delta_zig_zag_int64(
+            const uint64_t* deltas,
+            int64_t* last,
+            size_t size,
+            double /*price_scale*/,
+            int64_t initial_price) {
         for (size_t i = 0; i < size; ++i) {
-            delta = (deltas[i] >> 1) ^ -(deltas[i] & 1);
-            scaled_price = initial_price + delta;
-            ticks[i].last = static_cast<double>(scaled_price) * inv_initial_price;
-            initial_price = scaled_price;
+            initial_price += static_cast<int64_t>((deltas[i] >> 1) ^ -(deltas[i] & 1));
+            last[i] = initial_price;
         }
     }
 
@@ -7,6 +7,18 @@
 
 namespace dfh::compression {
 
+    /// \brief Maps a tick compression profile to a ZSTD compression level.
+    /// \param profile Speed/ratio profile.
+    /// \return ZSTD compression level.
+    inline int zstd_compression_level(TickCompressionProfile profile) {
+        switch (profile) {
+            case TickCompressionProfile::INGEST_FAST: return 1;
+            case TickCompressionProfile::BALANCED:    return 9;
+            case TickCompressionProfile::ARCHIVE:
+            default:                                  return ZSTD_maxCLevel();
+        }
+    }
+
     /// \brief Compresses binary data using ZSTD and a dictionary.
     /// \param input Pointer to the input binary data.
     /// \param input_size Size of the input binary data.
@@ -165,6 +177,218 @@ namespace dfh::compression {
         output.resize(result_size);
     }
 
+    /// \brief Compresses binary data using a reusable ZSTD context and a pre-digested dictionary.
+    /// \param cctx Reusable compression context.
+    /// \param cdict Pre-digested compression dictionary (compression level is taken from it).
+    /// \param input Pointer to the input binary data.
+    /// \param input_size Size of the input binary data.
+    /// \param signature Unique signature for the compressed format.
+    /// \param num_samples Number of elements in the input data, stored before the compressed data.
+    /// \param output Reference to a vector for storing compressed data.
+    /// \throw std::runtime_error if compression fails.
+    /// \throw std::invalid_argument if input, context or dictionary are invalid.
+    void compress_zstd_data(
+            ZSTD_CCtx* cctx,
+            const ZSTD_CDict* cdict,
+            const void* input,
+            size_t input_size,
+            uint8_t signature,
+            uint32_t num_samples,
+            std::vector<uint8_t>& output) {
+        if (!cctx || !cdict || !input || input_size == 0) {
+            throw std::invalid_argument("Invalid input, context or dictionary.");
+        }
+
+        const size_t max_compressed_size = ZSTD_compressBound(input_size);
+        output.reserve(output.size() + max_compressed_size + 6);
+        output.push_back(signature);
+        dfh::utils::append_vbyte<uint32_t>(output, num_samples);
+        const size_t initial_size = output.size();
+        output.resize(max_compressed_size + initial_size);
+
+        size_t compressed_size = ZSTD_compress_usingCDict(
+            cctx,
+            output.data() + initial_size,
+            max_compressed_size,
+            input,
+            input_size,
+            cdict
+        );
+
+        if (ZSTD_isError(compressed_size)) {
+            throw std::runtime_error(std::string("Compression error: ") + ZSTD_getErrorName(compressed_size));
+        }
+
+        output.resize(compressed_size + initial_size);
+    }
+
+    /// \brief Decompresses binary data using a reusable ZSTD context and a pre-digested dictionary.
+    /// \param dctx Reusable decompression context.
+    /// \param ddict Pre-digested decompression dictionary.
+    /// \param input Pointer to the compressed binary data.
+    /// \param input_size Size of the compressed binary data.
+    /// \param output Reference to a vector for storing decompressed data.
+    /// \throw std::invalid_argument if input, context or dictionary are invalid.
+    /// \throw std::runtime_error if decompression fails.
+    void decompress_zstd_data(
+            ZSTD_DCtx* dctx,
+            const ZSTD_DDict* ddict,
+            const void* input,
+            size_t input_size,
+            std::vector<uint8_t>& output) {
+        if (!dctx || !ddict || !input || input_size == 0) {
+            throw std::invalid_argument("Invalid input, context or dictionary.");
+        }
+
+        unsigned long long decompressed_size = ZSTD_getFrameContentSize(input, input_size);
+        if (decompressed_size == ZSTD_CONTENTSIZE_ERROR) {
+            throw std::runtime_error("Input was not compressed by ZSTD.");
+        }
+        if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+            throw std::runtime_error("Original size is unknown.");
+        }
+
+        output.resize(decompressed_size);
+
+        size_t result_size = ZSTD_decompress_usingDDict(
+            dctx,
+            output.data(),
+            decompressed_size,
+            input,
+            input_size,
+            ddict
+        );
+
+        if (ZSTD_isError(result_size)) {
+            throw std::runtime_error(std::string("Decompression error: ") + ZSTD_getErrorName(result_size));
+        }
+
+        output.resize(result_size);
+    }
+
+    /// \brief Compresses binary data using a reusable ZSTD context without a dictionary.
+    /// \param cctx Reusable compression context.
+    /// \param compress_level ZSTD compression level.
+    /// \param input Pointer to the input binary data.
+    /// \param input_size Size of the input binary data.
+    /// \param signature Unique signature for the compressed format.
+    /// \param num_samples Number of elements in the input data, stored before the compressed data.
+    /// \param output Reference to a vector for storing compressed data.
+    /// \throw std::runtime_error if compression fails.
+    /// \throw std::invalid_argument if input or context are invalid.
+    void compress_zstd_data(
+            ZSTD_CCtx* cctx,
+            int compress_level,
+            const void* input,
+            size_t input_size,
+            uint8_t signature,
+            uint32_t num_samples,
+            std::vector<uint8_t>& output) {
+        if (!cctx || !input || input_size == 0) {
+            throw std::invalid_argument("Invalid input or context.");
+        }
+
+        const size_t max_compressed_size = ZSTD_compressBound(input_size);
+        output.reserve(output.size() + max_compressed_size + 6);
+        output.push_back(signature);
+        dfh::utils::append_vbyte<uint32_t>(output, num_samples);
+        const size_t initial_size = output.size();
+        output.resize(max_compressed_size + initial_size);
+
+        size_t compressed_size = ZSTD_compressCCtx(
+            cctx,
+            output.data() + initial_size,
+            max_compressed_size,
+            input,
+            input_size,
+            compress_level
+        );
+
+        if (ZSTD_isError(compressed_size)) {
+            throw std::runtime_error(std::string("Compression error: ") + ZSTD_getErrorName(compressed_size));
+        }
+
+        output.resize(compressed_size + initial_size);
+    }
+
+    /// \brief Decompresses binary data using a reusable ZSTD context without a dictionary.
+    /// \param dctx Reusable decompression context.
+    /// \param input Pointer to the compressed binary data.
+    /// \param input_size Size of the compressed binary data.
+    /// \param output Reference to a vector for storing decompressed data.
+    /// \throw std::invalid_argument if input or context are invalid.
+    /// \throw std::runtime_error if decompression fails.
+    void decompress_zstd_data(
+            ZSTD_DCtx* dctx,
+            const void* input,
+            size_t input_size,
+            std::vector<uint8_t>& output) {
+        if (!dctx || !input || input_size == 0) {
+            throw std::invalid_argument("Invalid input or context.");
+        }
+
+        unsigned long long decompressed_size = ZSTD_getFrameContentSize(input, input_size);
+        if (decompressed_size == ZSTD_CONTENTSIZE_ERROR) {
+            throw std::runtime_error("Input was not compressed by ZSTD.");
+        }
+        if (decompressed_size == ZSTD_CONTENTSIZE_UNKNOWN) {
+            throw std::runtime_error("Original size is unknown.");
+        }
+
+        output.resize(decompressed_size);
+
+        size_t result_size = ZSTD_decompressDCtx(
+            dctx,
+            output.data(),
+            decompressed_size,
+            input,
+            input_size
+        );
+
+        if (ZSTD_isError(result_size)) {
+            throw std::runtime_error(std::string("Decompression error: ") + ZSTD_getErrorName(result_size));
+        }
+
+        output.resize(result_size);
+    }
+
+    /// \brief Rebuilds the ZSTD frame of a `[signature][vbyte num_samples][frame]` block.
+    ///
+    /// The frame is decompressed into `buffer` and compressed again with `cdict`, while the
+    /// signature and number of samples are copied unchanged.
+    /// \param dctx Reusable decompression context.
+    /// \param ddict Pre-digested decompression dictionary.
+    /// \param cctx Reusable compression context.
+    /// \param cdict Pre-digested compression dictionary with the target compression level.
+    /// \param input Pointer to the compressed block.
+    /// \param input_size Size of the compressed block.
+    /// \param buffer Scratch buffer for the decompressed frame.
+    /// \param output Reference to a vector where the rebuilt block is appended.
+    /// \throw std::invalid_argument if input, contexts or dictionaries are invalid.
+    /// \throw std::runtime_error if decompression or compression fails.
+    void recompress_zstd_data(
+            ZSTD_DCtx* dctx,
+            const ZSTD_DDict* ddict,
+            ZSTD_CCtx* cctx,
+            const ZSTD_CDict* cdict,
+            const uint8_t* input,
+            size_t input_size,
+            std::vector<uint8_t>& buffer,
+            std::vector<uint8_t>& output) {
+        if (!input || input_size < 2) {
+            throw std::invalid_argument("Invalid input data.");
+        }
+        const uint8_t signature = input[0];
+        size_t offset = 1;
+        const uint32_t num_samples = dfh::utils::extract_vbyte<uint32_t>(input, offset);
+        if (offset >= input_size) {
+            throw std::invalid_argument("Invalid input data.");
+        }
+
+        decompress_zstd_data(dctx, ddict, input + offset, input_size - offset, buffer);
+        compress_zstd_data(cctx, cdict, buffer.data(), buffer.size(), signature, num_samples, output);
+    }
+
     /// \brief Extracts signature byte from compressed data.
     /// \param data Pointer to compressed data.
     /// \param size Size of the compressed data.
@@ -190,6 +414,23 @@ namespace dfh::compression {
         return dfh::utils::extract_vbyte<uint32_t>(data, offset);
     }
 
+    /// \brief Extracts the ID of the dictionary used for the ZSTD frame that follows the number of samples.
+    /// \param data Pointer to compressed data.
+    /// \param size Size of the compressed data.
+    /// \return Dictionary ID stored in the frame header; 0 if the frame names no dictionary.
+    /// \throw std::invalid_argument If the data is too small.
+    inline uint32_t extract_zstd_dictionary_id(const uint8_t* data, size_t size) {
+        if (!data || size < 2) {
+            throw std::invalid_argument("Data is too small to contain a VByte.");
+        }
+        size_t offset = 1; // skip signature
+        dfh::utils::extract_vbyte<uint32_t>(data, offset);
+        if (offset >= size) {
+            throw std::invalid_argument("Data is too small to contain a ZSTD frame.");
+        }
+        return ZSTD_getDictID_fromFrame(data + offset, size - offset);
+    }
+
     /// \brief Trains a ZSTD dictionary from binary samples and returns it as a binary array.
     /// \param samples A vector of pairs, where each pair contains a pointer to binary data and its size.
     /// \param dict_buffer_capacity The maximum size of the dictionary in bytes (default: 102400).
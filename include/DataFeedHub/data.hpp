@@ -44,6 +44,7 @@
 // Utility headers
 //------------------------------------------------------------------------------
 
+#include "utils/aligned_allocator.hpp"
 #include "utils/string_utils.hpp"
 #include "utils/enum_utils.hpp"
 
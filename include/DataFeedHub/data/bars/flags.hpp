@@ -34,7 +34,8 @@ namespace dfh {
         SPREAD_AVG              = 1 << 10,  ///< Spread is stored as average over interval
         SPREAD_MAX              = 1 << 11,  ///< Spread is stored as maximum in interval
         STORE_RAW_BINARY        = 1 << 12,  ///< Store data in raw binary format (no compression)
-        FINALIZED_BARS          = 1 << 13   ///< All bars in the dataset are fully finalized (no incomplete bar at end)
+        FINALIZED_BARS          = 1 << 13,  ///< All bars in the dataset are fully finalized (no incomplete bar at end)
+        IMPLICIT_TIME           = 1 << 14   ///< Raw binary format: store bar times as a bitmap of occupied timeframe slots
     };
 
     /// \brief Enables bitwise OR for BarStorageFlags.
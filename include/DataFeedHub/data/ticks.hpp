@@ -37,5 +37,6 @@
 #include "ticks/TickMetadata.hpp"
 #include "ticks/TickCodecConfig.hpp"
 #include "ticks/TickSpan.hpp"
+#include "ticks/TickColumns.hpp"
 
 #endif // _DTH_DATA_TICKS_HPP_INCLUDED
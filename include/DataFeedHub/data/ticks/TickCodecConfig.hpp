@@ -24,7 +24,8 @@ namespace dfh {
         TickStorageFlags flags{TickStorageFlags::NONE}; ///< Encoding flags.
         std::uint8_t price_digits{0};             ///< Number of decimal places for prices.
         std::uint8_t volume_digits{0};            ///< Number of decimal places for volumes.
-        std::array<std::uint8_t, 2> reserved{};   ///< Reserved for future use; keeps structure 32 bytes long.
+        TickCompressionProfile compression_profile{TickCompressionProfile::ARCHIVE}; ///< Speed/ratio profile of the compressor (not stored in the segment).
+        std::array<std::uint8_t, 1> reserved{};   ///< Reserved for future use; keeps structure 32 bytes long.
 
         /// \brief Default constructor for TickCodecConfig.
         constexpr TickCodecConfig() noexcept = default;
@@ -86,6 +87,8 @@ namespace dfh {
                   "TickCodecConfig layout changed: next_expiration_time_ms offset mismatch.");
     static_assert(offsetof(TickCodecConfig, flags) == 24,
                   "TickCodecConfig layout changed: flags offset mismatch.");
+    static_assert(offsetof(TickCodecConfig, compression_profile) == 30,
+                  "TickCodecConfig layout changed: compression_profile offset mismatch.");
 
     static_assert(std::is_trivially_copyable_v<TickCodecConfig>,
                   "TickCodecConfig must stay trivially copyable.");
@@ -100,7 +103,8 @@ namespace dfh {
             {"next_expiration_time_ms", cfg.next_expiration_time_ms},
             {"flags", static_cast<std::uint64_t>(cfg.flags)},
             {"price_digits", cfg.price_digits},
-            {"volume_digits", cfg.volume_digits}
+            {"volume_digits", cfg.volume_digits},
+            {"compression_profile", static_cast<std::uint8_t>(cfg.compression_profile)}
         };
 
         nlohmann::json reserved = nlohmann::json::array();
@@ -120,6 +124,8 @@ namespace dfh {
         cfg.flags = static_cast<TickStorageFlags>(raw_flags);
         j.at("price_digits").get_to(cfg.price_digits);
         j.at("volume_digits").get_to(cfg.volume_digits);
+        cfg.compression_profile = static_cast<TickCompressionProfile>(
+            j.value("compression_profile", static_cast<std::uint8_t>(TickCompressionProfile::ARCHIVE)));
 
         auto reserved = j.value("reserved", std::vector<std::uint8_t>(cfg.reserved.size(), 0));
         for (std::size_t i = 0; i < cfg.reserved.size(); ++i) {
@@ -0,0 +1,252 @@
+#pragma once
+#ifndef _DFH_DATA_TICK_COLUMNS_HPP_INCLUDED
+#define _DFH_DATA_TICK_COLUMNS_HPP_INCLUDED
+
+/// \file TickColumns.hpp
+/// \brief Structure-of-arrays storage for trade ticks.
+
+namespace dfh {
+
+    /// \struct TickColumnsView
+    /// \brief Non-owning read-only view over tick columns.
+    ///
+    /// Column pointers may be null when the column is not present; all non-null columns
+    /// hold at least `size` elements.
+    struct TickColumnsView {
+        const std::uint64_t* time_ms{nullptr};      ///< Timestamps (ms since Unix epoch).
+        const std::uint64_t* received_ms{nullptr};  ///< Receive timestamps (ms since Unix epoch).
+        const double* last{nullptr};                ///< Last trade prices.
+        const double* volume{nullptr};              ///< Trade volumes.
+        const TickUpdateFlags* flags{nullptr};      ///< Update flags.
+        std::size_t size{0};                        ///< Number of ticks.
+
+        /// \brief Checks if the view is empty.
+        [[nodiscard]] constexpr bool empty() const noexcept { return size == 0; }
+
+        /// \brief Returns a view over `count` ticks starting at `offset` (no bounds check).
+        [[nodiscard]] constexpr TickColumnsView subview(std::size_t offset, std::size_t count) const noexcept {
+            TickColumnsView view;
+            view.time_ms     = time_ms     ? time_ms + offset : nullptr;
+            view.received_ms = received_ms ? received_ms + offset : nullptr;
+            view.last        = last        ? last + offset : nullptr;
+            view.volume      = volume      ? volume + offset : nullptr;
+            view.flags       = flags       ? flags + offset : nullptr;
+            view.size        = count;
+            return view;
+        }
+
+        /// \brief Assembles the tick at the given index (missing columns yield default values).
+        [[nodiscard]] MarketTick tick(std::size_t i) const noexcept {
+            MarketTick tick;
+            if (time_ms)     tick.time_ms = time_ms[i];
+            if (received_ms) tick.received_ms = received_ms[i];
+            if (last)        tick.last = last[i];
+            if (volume)      tick.volume = volume[i];
+            if (flags)       tick.flags = flags[i];
+            return tick;
+        }
+    };
+
+    /// \struct TickColumns
+    /// \brief Owning structure-of-arrays container of trade ticks.
+    ///
+    /// Keeps `time_ms`, `received_ms`, `last`, `volume` and `flags` in separate 64-byte aligned
+    /// arrays, so codecs can load and store each field with full-width vector instructions
+    /// instead of gathering it from 48-byte MarketTick records. All columns have the same size.
+    struct TickColumns {
+        static constexpr std::size_t ALIGNMENT = 64; ///< Byte alignment of every column.
+
+        template<class T>
+        using Column = std::vector<T, dfh::utils::aligned_allocator<T, ALIGNMENT>>;
+
+        Column<std::uint64_t> time_ms;      ///< Timestamps (ms since Unix epoch).
+        Column<std::uint64_t> received_ms;  ///< Receive timestamps (ms since Unix epoch).
+        Column<double> last;                ///< Last trade prices.
+        Column<double> volume;              ///< Trade volumes.
+        Column<TickUpdateFlags> flags;      ///< Update flags.
+
+        /// \brief Returns the number of ticks.
+        [[nodiscard]] std::size_t size() const noexcept { return time_ms.size(); }
+
+        /// \brief Checks if the container is empty.
+        [[nodiscard]] bool empty() const noexcept { return time_ms.empty(); }
+
+        /// \brief Resizes all columns; new ticks are value-initialized.
+        void resize(std::size_t size) {
+            time_ms.resize(size);
+            received_ms.resize(size);
+            last.resize(size);
+            volume.resize(size);
+            flags.resize(size, TickUpdateFlags::NONE);
+        }
+
+        /// \brief Reserves capacity in all columns.
+        void reserve(std::size_t capacity) {
+            time_ms.reserve(capacity);
+            received_ms.reserve(capacity);
+            last.reserve(capacity);
+            volume.reserve(capacity);
+            flags.reserve(capacity);
+        }
+
+        /// \brief Removes all ticks, keeping the capacity.
+        void clear() noexcept {
+            time_ms.clear();
+            received_ms.clear();
+            last.clear();
+            volume.clear();
+            flags.clear();
+        }
+
+        /// \brief Appends a tick (bid and ask are not stored).
+        void push_back(const MarketTick& tick) {
+            time_ms.push_back(tick.time_ms);
+            received_ms.push_back(tick.received_ms);
+            last.push_back(tick.last);
+            volume.push_back(tick.volume);
+            flags.push_back(tick.flags);
+        }
+
+        /// \brief Assembles the tick at the given index.
+        [[nodiscard]] MarketTick tick(std::size_t i) const noexcept {
+            return view().tick(i);
+        }
+
+        /// \brief Returns a view over all ticks.
+        [[nodiscard]] TickColumnsView view() const noexcept {
+            TickColumnsView view;
+            view.time_ms     = time_ms.data();
+            view.received_ms = received_ms.data();
+            view.last        = last.data();
+            view.volume      = volume.data();
+            view.flags       = flags.data();
+            view.size        = size();
+            return view;
+        }
+
+        /// \brief Returns a view over `count` ticks starting at `offset` (no bounds check).
+        [[nodiscard]] TickColumnsView view(std::size_t offset, std::size_t count) const noexcept {
+            return view().subview(offset, count);
+        }
+    };
+
+    /// \struct ScaledTickColumns
+    /// \brief Tick columns with prices kept as scaled integers.
+    ///
+    /// Same layout as TickColumns, but `last` holds prices multiplied by `10^price_digits`,
+    /// exactly as the codecs store them. Fixed-point consumers (matching, spreads) read the
+    /// prices without the int64 -> double -> int64 round trip and its rounding hazards.
+    struct ScaledTickColumns {
+        static constexpr std::size_t ALIGNMENT = TickColumns::ALIGNMENT; ///< Byte alignment of every column.
+
+        template<class T>
+        using Column = TickColumns::Column<T>;
+
+        Column<std::uint64_t> time_ms;      ///< Timestamps (ms since Unix epoch).
+        Column<std::uint64_t> received_ms;  ///< Receive timestamps (ms since Unix epoch).
+        Column<std::int64_t> last;          ///< Last trade prices multiplied by `10^price_digits`.
+        Column<double> volume;              ///< Trade volumes.
+        Column<TickUpdateFlags> flags;      ///< Update flags.
+        std::uint8_t price_digits{0};       ///< Number of decimal places of the scaled prices.
+
+        /// \brief Returns the number of ticks.
+        [[nodiscard]] std::size_t size() const noexcept { return time_ms.size(); }
+
+        /// \brief Checks if the container is empty.
+        [[nodiscard]] bool empty() const noexcept { return time_ms.empty(); }
+
+        /// \brief Resizes all columns; new ticks are value-initialized.
+        void resize(std::size_t size) {
+            time_ms.resize(size);
+            received_ms.resize(size);
+            last.resize(size);
+            volume.resize(size);
+            flags.resize(size, TickUpdateFlags::NONE);
+        }
+
+        /// \brief Reserves capacity in all columns.
+        void reserve(std::size_t capacity) {
+            time_ms.reserve(capacity);
+            received_ms.reserve(capacity);
+            last.reserve(capacity);
+            volume.reserve(capacity);
+            flags.reserve(capacity);
+        }
+
+        /// \brief Removes all ticks, keeping the capacity.
+        void clear() noexcept {
+            time_ms.clear();
+            received_ms.clear();
+            last.clear();
+            volume.clear();
+            flags.clear();
+        }
+
+        /// \brief Returns the price at the given index as a double, rounded as the codecs do.
+        [[nodiscard]] double price(std::size_t i) const noexcept {
+            double price_scale = 1.0;
+            for (std::uint8_t d = 0; d < price_digits; ++d) price_scale *= 10.0;
+            return static_cast<double>(last[i]) * (1.0 / price_scale);
+        }
+
+        /// \brief Assembles the tick at the given index (bid and ask are not stored).
+        [[nodiscard]] MarketTick tick(std::size_t i) const noexcept {
+            MarketTick tick;
+            tick.time_ms     = time_ms[i];
+            tick.received_ms = received_ms[i];
+            tick.last        = price(i);
+            tick.volume      = volume[i];
+            tick.flags       = flags[i];
+            return tick;
+        }
+    };
+
+    /// \brief Appends MarketTick records to tick columns.
+    /// \param ticks Pointer to the first tick.
+    /// \param count Number of ticks.
+    /// \param columns Destination columns.
+    inline void to_columns(const MarketTick* ticks, std::size_t count, TickColumns& columns) {
+        const std::size_t offset = columns.size();
+        columns.resize(offset + count);
+        for (std::size_t i = 0; i < count; ++i) {
+            columns.time_ms[offset + i]     = ticks[i].time_ms;
+            columns.received_ms[offset + i] = ticks[i].received_ms;
+            columns.last[offset + i]        = ticks[i].last;
+            columns.volume[offset + i]      = ticks[i].volume;
+            columns.flags[offset + i]       = ticks[i].flags;
+        }
+    }
+
+    /// \brief Appends MarketTick records to tick columns.
+    inline void to_columns(const std::vector<MarketTick>& ticks, TickColumns& columns) {
+        to_columns(ticks.data(), ticks.size(), columns);
+    }
+
+    /// \brief Appends the ticks of a column view to a vector of MarketTick.
+    /// \param view Source columns; missing columns yield default values.
+    /// \param ticks Destination vector.
+    inline void to_ticks(const TickColumnsView& view, std::vector<MarketTick>& ticks) {
+        const std::size_t offset = ticks.size();
+        ticks.resize(offset + view.size);
+        for (std::size_t i = 0; i < view.size; ++i) {
+            ticks[offset + i] = view.tick(i);
+        }
+    }
+
+    /// \brief Appends the ticks of tick columns to a vector of MarketTick.
+    inline void to_ticks(const TickColumns& columns, std::vector<MarketTick>& ticks) {
+        to_ticks(columns.view(), ticks);
+    }
+
+    /// \brief Appends the ticks of scaled tick columns to a vector of MarketTick.
+    inline void to_ticks(const ScaledTickColumns& columns, std::vector<MarketTick>& ticks) {
+        const std::size_t offset = ticks.size();
+        ticks.resize(offset + columns.size());
+        for (std::size_t i = 0; i < columns.size(); ++i) {
+            ticks[offset + i] = columns.tick(i);
+        }
+    }
+
+} // namespace dfh
+
+#endif // _DFH_DATA_TICK_COLUMNS_HPP_INCLUDED
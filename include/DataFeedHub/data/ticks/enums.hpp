@@ -30,6 +30,17 @@ namespace dfh {
     static_assert(sizeof(TradeSide) == sizeof(std::uint8_t),
                   "TradeSide size must remain 8-bit for packing.");
 
+    /// \enum TickCompressionProfile
+    /// \brief Trade-off between encoding speed and compression ratio of the final entropy stage.
+    enum class TickCompressionProfile : std::uint8_t {
+        ARCHIVE     = 0, ///< Maximum compression ratio (default, slowest encoding).
+        BALANCED    = 1, ///< Moderate ratio with noticeably faster encoding.
+        INGEST_FAST = 2  ///< Fastest encoding for live ingestion; recompress later for archiving.
+    };
+
+    static_assert(sizeof(TickCompressionProfile) == sizeof(std::uint8_t),
+                  "TickCompressionProfile size must remain 8-bit for compact storage.");
+
 } // namespace dfh
 
 #endif // _DFH_DATA_TICK_ENUMS_HPP_INCLUDED
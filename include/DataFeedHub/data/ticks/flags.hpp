@@ -36,7 +36,22 @@ namespace dfh {
         ENABLE_TICK_FLAGS  = 1 << 1,  ///< Encode TickUpdateFlags.
         ENABLE_RECV_TIME   = 1 << 2,  ///< Include received_time in encoded data.
         ENABLE_VOLUME      = 1 << 3,  ///< Store base asset volume.
-        STORE_RAW_BINARY   = 1 << 5   ///< Use raw binary format (no compression).
+        STORE_RAW_BINARY   = 1 << 5,  ///< Use raw binary format (no compression).
+        AUTO_CODEC         = 1 << 6,  ///< Per segment, keep the smaller of the compressed and raw binary encodings.
+        BLOCK_INDEX        = 1 << 7,  ///< Split segments into independently decodable blocks behind a time index.
+        DELTA_OF_DELTA_TIME = 1 << 8  ///< Store timestamps as second-order deltas instead of deltas.
+    };
+
+    /// \enum TickField
+    /// \brief Tick fields requested from a projected decode.
+    enum class TickField : std::uint32_t {
+        NONE      = 0,       ///< No fields.
+        TIME      = 1 << 0,  ///< `time_ms`.
+        LAST      = 1 << 1,  ///< `last` price.
+        VOLUME    = 1 << 2,  ///< `volume`.
+        RECV_TIME = 1 << 3,  ///< `received_ms` (implies decoding the time stream).
+        FLAGS     = 1 << 4,  ///< `flags` (TickUpdateFlags).
+        ALL       = 0x1F     ///< All fields.
     };
 
 //------------------------------------------------------------------------------
@@ -169,6 +184,25 @@ namespace dfh {
         return (flags & flag) != TickStorageFlags::NONE;
     }
 
+    //------------------------------------------------------------------------------
+    // TickField operators
+    //------------------------------------------------------------------------------
+
+    /// \brief Enables bitwise OR for TickField.
+    [[nodiscard]] constexpr TickField operator|(TickField a, TickField b) noexcept {
+        return static_cast<TickField>(static_cast<std::uint32_t>(a) | static_cast<std::uint32_t>(b));
+    }
+
+    /// \brief Enables bitwise AND for TickField.
+    [[nodiscard]] constexpr TickField operator&(TickField a, TickField b) noexcept {
+        return static_cast<TickField>(static_cast<std::uint32_t>(a) & static_cast<std::uint32_t>(b));
+    }
+
+    /// \brief Checks if a TickField mask contains any of the given fields.
+    [[nodiscard]] constexpr bool has_flag(TickField fields, TickField field) noexcept {
+        return (fields & field) != TickField::NONE;
+    }
+
 } // namespace dfh
 
 #endif // _DFH_DATA_TICKS_FLAGS_HPP_INCLUDED
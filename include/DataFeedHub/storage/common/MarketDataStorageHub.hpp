@@ -185,7 +185,7 @@ namespace dfh::storage {
         /// \param time_frame Target time frame (e.g., M1, H1).
         /// \param start_time_ms Start of desired data range (inclusive).
         /// \param end_time_ms End of desired data range (exclusive).
-        /// \param bars Output vector to hold the retrieved bar data.
+        /// \param bars Output vector; replaced by the bars of all segments in the range, in time order.
         /// \param config Output structure to receive the codec configuration.
         /// \return True if at least one segment was successfully retrieved, false otherwise.
         bool fetch(
@@ -202,6 +202,9 @@ namespace dfh::storage {
             const uint64_t segment_start = start_time_ms / duration_ms;
             const uint64_t segment_stop  = (end_time_ms - 1) / duration_ms;
 
+            // Backends replace their output, so every segment is decoded separately and appended.
+            bars.clear();
+            std::vector<dfh::MarketBar> segment_bars;
             bool success = false;
             for (uint64_t segment = segment_start; segment <= segment_stop; ++segment) {
                 const size_t db_index = find_storage_index(
@@ -211,15 +214,17 @@ namespace dfh::storage {
                         symbol_id,
                         segment * duration_ms);
 
-                success |= m_storage_list[db_index]->fetch(
-                    get_transaction(guard.get(), db_index),
-                    market_type,
-                    exchange_id,
-                    symbol_id,
-                    time_frame,
-                    segment,
-                    bars,
-                    config);
+                if (!m_storage_list[db_index]->fetch(
+                        get_transaction(guard.get(), db_index),
+                        market_type,
+                        exchange_id,
+                        symbol_id,
+                        time_frame,
+                        segment,
+                        segment_bars,
+                        config)) continue;
+                bars.insert(bars.end(), segment_bars.begin(), segment_bars.end());
+                success = true;
             }
 
             if (start_time_ms > (segment_start * duration_ms)) {
@@ -9,7 +9,8 @@
 /// MDBX as a backend for market data storage. This header provides
 /// access to configuration (`MDBXConfig`), connection management
 /// (`MDBXConnection`), transactions (`MDBXTransaction`), and the
-/// main storage interface implementation (`MDBXMarketDataStorage`).
+/// main storage interface implementation (`MDBXMarketDataStorage`) with its
+/// bulk importer (`MDBXBulkLoader`).
 
 #include <mdbx.h>
 
@@ -17,5 +18,6 @@
 #include "mdbx/MDBXConnection.hpp"
 #include "mdbx/MDBXTransaction.hpp"
 #include "mdbx/MDBXMarketDataStorage.hpp"
+#include "mdbx/MDBXBulkLoader.hpp"
 
 #endif // _DFH_STORAGE_MDBX_HPP_INCLUDED
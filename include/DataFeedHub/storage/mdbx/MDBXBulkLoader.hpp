@@ -0,0 +1,155 @@
+#pragma once
+#ifndef _DFH_STORAGE_MDBX_BULK_LOADER_HPP_INCLUDED
+#define _DFH_STORAGE_MDBX_BULK_LOADER_HPP_INCLUDED
+
+/// \file MDBXBulkLoader.hpp
+/// \brief Bulk import of bar history into MDBX storage.
+
+namespace dfh::storage::mdbx {
+
+    /// \class MDBXBulkLoader
+    /// \brief Imports large amounts of bars with few, large write transactions.
+    ///
+    /// Segments are buffered and written in batches of `segments_per_txn`. Each batch is written
+    /// in key order in one transaction, and segments beyond the end of their table are
+    /// appended with `MDBX_APPEND` (see MDBXMarketDataStorage::bulk_upsert()). Feeding the
+    /// loader in key order (symbol by symbol, oldest segment first) makes every write an append.
+    ///
+    /// With `safe_nosync` the environment runs with `MDBX_SAFE_NOSYNC` until finish(), which
+    /// restores durable commits and flushes everything to disk once. A system crash during the
+    /// load may lose the latest batches but does not corrupt the database.
+    ///
+    /// The loader writes bars and bar metadata only; register new symbols in StorageMetadata
+    /// with IMarketDataStorage::extend_metadata().
+    ///
+    /// \thread_safety Not thread-safe. Other writers must not use the storage during the load.
+    class MDBXBulkLoader {
+    public:
+        /// \brief Starts a bulk load.
+        /// \param storage Connected storage to load into.
+        /// \param segments_per_txn Number of segments written per transaction.
+        /// \param safe_nosync True to skip the flush to disk on every commit until finish().
+        /// \throws MDBXException if `MDBX_SAFE_NOSYNC` cannot be enabled.
+        explicit MDBXBulkLoader(
+                MDBXMarketDataStorage& storage,
+                size_t segments_per_txn = 4096,
+                bool safe_nosync = true)
+            : m_storage(storage),
+              m_segments_per_txn(std::max<size_t>(segments_per_txn, 1)),
+              m_safe_nosync(safe_nosync) {
+            if (m_safe_nosync) m_storage.connection().set_safe_nosync(true);
+            m_pending.reserve(m_segments_per_txn);
+        }
+
+        MDBXBulkLoader(const MDBXBulkLoader&) = delete;
+        MDBXBulkLoader& operator=(const MDBXBulkLoader&) = delete;
+
+        /// \brief Finishes the load; errors are ignored, call finish() to observe them.
+        ~MDBXBulkLoader() {
+            try {
+                finish();
+            } catch (...) {}
+        }
+
+        /// \brief Adds bars of one symbol; they are split into segments.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param bars Bars in ascending time order; may span many segments.
+        /// \param config Codec config describing compression and metadata.
+        /// \throws MDBXException if the bars are not in time order or a batch fails.
+        void add(
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                const std::vector<MarketBar>& bars,
+                const BarCodecConfig& config) {
+            if (bars.empty()) return;
+            std::vector<std::vector<MarketBar>> segments;
+            if (!dfh::transform::split_bars(config.time_frame, bars, segments)) {
+                throw MDBXException("MDBXBulkLoader::add(): Bars are not in ascending time order.");
+            }
+            for (auto& segment_bars : segments) {
+                add(BarBulkSegment{market_type, exchange_id, symbol_id, std::move(segment_bars), config});
+            }
+        }
+
+        /// \brief Adds one segment of bars.
+        /// \param segment Segment; its bars must fit within one segment of its time frame.
+        /// \throws MDBXException if the load is finished or a batch fails.
+        void add(BarBulkSegment segment) {
+            if (m_finished) throw MDBXException("MDBXBulkLoader::add(): Load is already finished.");
+            if (segment.bars.empty()) return;
+            m_pending.push_back(std::move(segment));
+            if (m_pending.size() >= m_segments_per_txn) flush();
+        }
+
+        /// \brief Adds a sequence of segments.
+        /// \tparam InputIt Iterator whose value converts to BarBulkSegment.
+        /// \param first Beginning of the sequence.
+        /// \param last End of the sequence.
+        /// \throws MDBXException if the load is finished or a batch fails.
+        template<class InputIt>
+        void add(InputIt first, InputIt last) {
+            for (; first != last; ++first) {
+                add(BarBulkSegment(*first));
+            }
+        }
+
+        /// \brief Writes the buffered segments in one transaction.
+        /// \throws MDBXException if the transaction fails; the buffered segments are kept.
+        void flush() {
+            if (m_pending.empty()) return;
+            m_storage.bulk_upsert(m_pending);
+            m_num_segments += m_pending.size();
+            ++m_num_transactions;
+            m_pending.clear();
+        }
+
+        /// \brief Writes the remaining segments and, with `safe_nosync`, restores durable commits and syncs.
+        /// \details Further calls do nothing.
+        /// \throws MDBXException if the last batch, the mode switch or the sync fails.
+        void finish() {
+            if (m_finished) return;
+            m_finished = true;
+            try {
+                flush();
+            } catch (...) {
+                try {
+                    restore_sync();
+                } catch (...) {}
+                throw;
+            }
+            restore_sync();
+        }
+
+        /// \brief Returns the number of segments written so far.
+        size_t num_segments() const noexcept {
+            return m_num_segments;
+        }
+
+        /// \brief Returns the number of committed transactions.
+        size_t num_transactions() const noexcept {
+            return m_num_transactions;
+        }
+
+    private:
+        MDBXMarketDataStorage&      m_storage;              ///< Storage being loaded.
+        size_t                      m_segments_per_txn;     ///< Batch size in segments.
+        bool                        m_safe_nosync;          ///< True if `MDBX_SAFE_NOSYNC` was enabled.
+        bool                        m_finished = false;     ///< Set by finish().
+        std::vector<BarBulkSegment> m_pending;              ///< Segments of the next batch.
+        size_t                      m_num_segments = 0;     ///< Segments written so far.
+        size_t                      m_num_transactions = 0; ///< Committed batches.
+
+        /// \brief Restores durable commits and flushes all data to disk.
+        void restore_sync() {
+            if (!m_safe_nosync) return;
+            m_storage.connection().set_safe_nosync(false);
+            m_storage.connection().sync(true);
+        }
+    };
+
+} // namespace dfh::storage::mdbx
+
+#endif // _DFH_STORAGE_MDBX_BULK_LOADER_HPP_INCLUDED
@@ -7,6 +7,7 @@
 
 #include "MDBXConnection/MDBXException.hpp"
 #include "MDBXConnection/utils.hpp"
+#include "MDBXConnection/MDBXReadTxnPool.hpp"
 
 namespace dfh::storage::mdbx {
 
@@ -35,6 +36,7 @@ namespace dfh::storage::mdbx {
         /// \brief Destructor that ensures proper cleanup of resources.
         virtual ~MDBXConnection() {
 			if (!m_env) return;
+            m_read_pool.close();
             mdbx_env_close(m_env);
             m_env = nullptr;
         }
@@ -54,7 +56,7 @@ namespace dfh::storage::mdbx {
             m_config = std::unique_ptr<MDBXConfig>(raw);
         }
 
-        /// \brief Establishes and configures the MDBX environment and opens a read-only transaction.
+        /// \brief Establishes and configures the MDBX environment and opens the read transaction pool.
         /// \throws MDBXException if the connection fails or configuration is invalid.
         void connect() override final {
             std::lock_guard<std::mutex> locker(m_mdbx_mutex);
@@ -64,6 +66,7 @@ namespace dfh::storage::mdbx {
                 create_directories();
                 db_init();
             } catch (...) {
+                m_read_pool.close();
                 if (m_env) {
 					int rc = mdbx_env_close(m_env);
 					if (rc != MDBX_SUCCESS) throw MDBXException("Failed to close environment: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
@@ -77,6 +80,7 @@ namespace dfh::storage::mdbx {
         /// \throws MDBXException if closing the environment fails.
         void disconnect() override final {
             std::lock_guard<std::mutex> locker(m_mdbx_mutex);
+            m_read_pool.close();
             if (m_env) {
 				int rc = mdbx_env_close(m_env);
 				if (rc != MDBX_SUCCESS) throw MDBXException("Failed to close environment: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
@@ -91,11 +95,35 @@ namespace dfh::storage::mdbx {
             return (m_env != nullptr);
         }
 
-		/// \brief Returns a pointer to the internally managed read-only transaction.
-        /// \return Pointer to the MDBX read-only transaction.
-		MDBX_txn *rdonly_handle() noexcept {
-			return m_rdonly_txn;
-		}
+        /// \brief Switches commits between durable mode and `MDBX_SAFE_NOSYNC`.
+        /// \details With `MDBX_SAFE_NOSYNC` commits skip the flush to disk. A system crash may
+        /// lose the latest commits but leaves the database consistent. Call sync() afterwards.
+        /// \param enable True to enable `MDBX_SAFE_NOSYNC`, false to restore durable commits.
+        /// \throws MDBXException if the connection is not established or the flag cannot be changed.
+        void set_safe_nosync(bool enable) {
+            std::lock_guard<std::mutex> locker(m_mdbx_mutex);
+            if (!m_env) throw MDBXException("Connection is not established");
+            int rc = mdbx_env_set_flags(m_env, MDBX_SAFE_NOSYNC, enable);
+            if (rc != MDBX_SUCCESS) throw MDBXException(
+                "Failed to change MDBX_SAFE_NOSYNC: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+        }
+
+        /// \brief Flushes committed data to disk.
+        /// \param force True to flush even if the sync thresholds are not reached.
+        /// \throws MDBXException if the connection is not established or the flush fails.
+        void sync(bool force = true) {
+            std::lock_guard<std::mutex> locker(m_mdbx_mutex);
+            if (!m_env) throw MDBXException("Connection is not established");
+            int rc = mdbx_env_sync_ex(m_env, force, false);
+            if (rc != MDBX_SUCCESS && rc != MDBX_RESULT_TRUE) throw MDBXException(
+                "Failed to sync MDBX environment: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+        }
+
+        /// \brief Returns the pool of per-thread read-only transactions.
+        /// \return Pool to lease read transactions from (see MDBXReadLease).
+        MDBXReadTxnPool& read_pool() noexcept {
+            return m_read_pool;
+        }
 
 		/// \brief Returns the MDBX environment handle.
         /// \return The MDBX environment handle.
@@ -105,7 +133,7 @@ namespace dfh::storage::mdbx {
 
     private:
 		MDBX_env *m_env = nullptr;            ///< Pointer to the MDBX environment handle.
-        MDBX_txn *m_rdonly_txn = nullptr;     ///< The MDBX transaction handle.
+        MDBXReadTxnPool m_read_pool;          ///< Per-thread read-only transactions.
         mutable std::mutex m_mdbx_mutex;      ///< Mutex for thread-safe access.
         std::unique_ptr<MDBXConfig> m_config; ///< Database configuration object.
 
@@ -172,19 +200,13 @@ namespace dfh::storage::mdbx {
             std::wstring wide_pathname = converter.from_bytes(m_config->pathname);
 			rc = mdbx_env_openW(m_env, wide_pathname.c_str(), env_flags, 0664);
 #           else
-			rc = mdbx_env_open(m_env, m_config->pathname, env_flags, 0664);
+			rc = mdbx_env_open(m_env, m_config->pathname.c_str(), env_flags, 0664);
 #           endif
             std::cout << "--3" << std::endl;
 			if (rc != MDBX_SUCCESS) throw MDBXException(
                 "mdbx_env_open failed: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
 
-			rc = mdbx_txn_begin(m_env, nullptr, MDBX_TXN_RDONLY, &m_rdonly_txn);
-			if (rc != MDBX_SUCCESS) throw MDBXException(
-                "mdbx_txn_begin failed: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
-
-            rc = mdbx_txn_reset(m_rdonly_txn);
-            if (rc != MDBX_SUCCESS) throw MDBXException(
-                "mdbx_txn_reset failed: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+			m_read_pool.open(m_env);
 		}
 
     }; // MDBXConnection
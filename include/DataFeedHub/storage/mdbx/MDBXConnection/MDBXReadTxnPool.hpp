@@ -0,0 +1,174 @@
+#pragma once
+#ifndef _DFH_STORAGE_MDBX_READ_TXN_POOL_HPP_INCLUDED
+#define _DFH_STORAGE_MDBX_READ_TXN_POOL_HPP_INCLUDED
+
+/// \file MDBXReadTxnPool.hpp
+/// \brief Pool of reusable read-only MDBX transactions, one per thread.
+
+namespace dfh::storage::mdbx {
+
+    /// \class MDBXReadTxnPool
+    /// \brief Keeps one read-only transaction per thread and renews/resets it on demand.
+    ///
+    /// A read-only MDBX transaction must not be used by two threads at once. The pool gives
+    /// every thread its own transaction, created on first use and afterwards only renewed
+    /// and reset, so concurrent readers neither share a handle nor pay for `mdbx_txn_begin`.
+    /// Leases nest: a thread that acquires its transaction again while holding it gets the
+    /// same snapshot, and the transaction is reset when the last lease is released.
+    ///
+    /// Each thread keeps one MDBX reader slot while the pool is open; size
+    /// MDBXConfig::max_readers for the number of reader threads.
+    ///
+    /// \thread_safety acquire() and release() are thread-safe and must be paired on the
+    /// same thread. open() and close() must not run concurrently with readers.
+    class MDBXReadTxnPool {
+    public:
+        MDBXReadTxnPool() = default;
+        MDBXReadTxnPool(const MDBXReadTxnPool&) = delete;
+        MDBXReadTxnPool& operator=(const MDBXReadTxnPool&) = delete;
+
+        /// \brief Aborts all pooled transactions.
+        ~MDBXReadTxnPool() {
+            close();
+        }
+
+        /// \brief Binds the pool to an open environment.
+        /// \param env MDBX environment handle.
+        void open(MDBX_env* env) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_env = env;
+            m_generation = next_generation();
+        }
+
+        /// \brief Aborts all pooled transactions; must be called before the environment is closed.
+        void close() noexcept {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& item : m_slots) {
+                if (item.second->txn) mdbx_txn_abort(item.second->txn);
+            }
+            m_slots.clear();
+            m_env = nullptr;
+            m_generation = next_generation();
+        }
+
+        /// \brief Returns the read transaction of the calling thread, renewed to the latest snapshot.
+        /// \return Transaction handle, valid until the matching release().
+        /// \throws MDBXException if the pool is not open or the transaction cannot be started.
+        MDBX_txn* acquire() {
+            Slot& slot = thread_slot();
+            if (slot.depth == 0) {
+                int rc = slot.txn
+                    ? mdbx_txn_renew(slot.txn)
+                    : mdbx_txn_begin(m_env, nullptr, MDBX_TXN_RDONLY, &slot.txn);
+                if (rc != MDBX_SUCCESS) throw MDBXException(
+                    "Failed to start read transaction: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+            }
+            ++slot.depth;
+            return slot.txn;
+        }
+
+        /// \brief Releases a lease of the calling thread; the last one resets the transaction.
+        /// \throws MDBXException if the thread holds no lease or the reset fails.
+        void release() {
+            Slot& slot = thread_slot();
+            if (slot.depth == 0) throw MDBXException("Read transaction released without a lease.");
+            if (--slot.depth > 0) return;
+            int rc = mdbx_txn_reset(slot.txn);
+            if (rc != MDBX_SUCCESS) throw MDBXException(
+                "Failed to reset read transaction: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+        }
+
+        /// \brief Aborts the transaction of the calling thread and frees its reader slot.
+        /// \details Call before a long-lived worker thread exits; a later acquire() starts a new transaction.
+        /// \throws MDBXException if the thread still holds a lease.
+        void detach() {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            auto it = m_slots.find(std::this_thread::get_id());
+            if (it == m_slots.end()) return;
+            if (it->second->depth) throw MDBXException("Cannot detach a leased read transaction.");
+            if (it->second->txn) mdbx_txn_abort(it->second->txn);
+            m_slots.erase(it);
+            m_generation = next_generation();
+        }
+
+        /// \brief Returns the number of threads that own a pooled transaction.
+        size_t size() const {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            return m_slots.size();
+        }
+
+    private:
+        /// \struct Slot
+        /// \brief Read transaction of one thread.
+        struct Slot {
+            MDBX_txn* txn   = nullptr; ///< Transaction handle; nullptr until first use.
+            size_t    depth = 0;       ///< Number of active leases.
+        };
+
+        /// \struct ThreadCache
+        /// \brief Last slot looked up by a thread, so repeated leases skip the mutex.
+        struct ThreadCache {
+            const MDBXReadTxnPool* pool = nullptr;
+            uint64_t generation = 0;
+            Slot*    slot = nullptr;
+        };
+
+        mutable std::mutex    m_mutex;         ///< Guards m_slots and m_env.
+        MDBX_env*             m_env = nullptr; ///< Environment of the pooled transactions.
+        std::atomic<uint64_t> m_generation{0}; ///< Changes whenever slots may have been freed; invalidates thread caches.
+        std::unordered_map<std::thread::id, std::unique_ptr<Slot>> m_slots; ///< Transaction of every thread.
+
+        /// \brief Returns a process-wide unique generation number.
+        static uint64_t next_generation() noexcept {
+            static std::atomic<uint64_t> counter{0};
+            return ++counter;
+        }
+
+        /// \brief Returns the slot of the calling thread, creating it on first use.
+        Slot& thread_slot() {
+            thread_local ThreadCache cache;
+            const uint64_t generation = m_generation.load(std::memory_order_acquire);
+            if (cache.pool == this && cache.generation == generation) return *cache.slot;
+
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_env) throw MDBXException("Read transaction pool is not open.");
+            auto& slot = m_slots[std::this_thread::get_id()];
+            if (!slot) slot = std::make_unique<Slot>();
+            cache = ThreadCache{this, m_generation.load(std::memory_order_relaxed), slot.get()};
+            return *slot;
+        }
+    };
+
+    /// \class MDBXReadLease
+    /// \brief RAII lease of the calling thread's pooled read transaction.
+    class MDBXReadLease {
+    public:
+        /// \brief Acquires the read transaction of the calling thread.
+        /// \param pool Pool of the connection (see MDBXConnection::read_pool()).
+        /// \throws MDBXException if the transaction cannot be started.
+        explicit MDBXReadLease(MDBXReadTxnPool& pool)
+            : m_pool(pool), m_txn(pool.acquire()) {}
+
+        MDBXReadLease(const MDBXReadLease&) = delete;
+        MDBXReadLease& operator=(const MDBXReadLease&) = delete;
+
+        /// \brief Releases the lease; the last lease of the thread resets the transaction.
+        ~MDBXReadLease() {
+            try {
+                m_pool.release();
+            } catch (...) {}
+        }
+
+        /// \brief Returns the leased transaction handle.
+        MDBX_txn* handle() const noexcept {
+            return m_txn;
+        }
+
+    private:
+        MDBXReadTxnPool& m_pool; ///< Pool the transaction belongs to.
+        MDBX_txn*        m_txn;  ///< Leased transaction.
+    };
+
+} // namespace dfh::storage::mdbx
+
+#endif // _DFH_STORAGE_MDBX_READ_TXN_POOL_HPP_INCLUDED
@@ -81,6 +81,81 @@ namespace dfh::storage::mdbx {
         return true;
     }
 
+    /// \brief Retrieves raw binary data using an integral key without copying it.
+    /// \details The returned pointer refers to the memory map of the database and stays valid
+    /// until the transaction ends or, for a write transaction, until the next modification.
+    /// \tparam Key Type of the key (must be 32-bit or 64-bit integral type).
+    /// \param txn MDBX transaction handle.
+    /// \param dbi Target database handle.
+    /// \param key Key to retrieve data by.
+    /// \param out_data Receives the pointer to the stored value.
+    /// \param out_size Receives the size of the stored value in bytes.
+    /// \return True if data was found, false otherwise.
+    /// \throws MDBXException if retrieval fails.
+    template<typename Key>
+    bool get_raw_view(MDBX_txn* txn, MDBX_dbi dbi, Key key, const uint8_t*& out_data, size_t& out_size) {
+        static_assert(std::is_same<Key, uint32_t>::value || std::is_same<Key, uint64_t>::value,"Key must be either uint32_t or uint64_t (supported by MDBX)");
+
+        MDBX_val db_key{std::addressof(key), sizeof(Key)};
+        MDBX_val db_data;
+
+        int rc = mdbx_get(txn, dbi, &db_key, &db_data);
+        if (rc == MDBX_NOTFOUND) return false;
+        if (rc != MDBX_SUCCESS) throw MDBXException(
+            "Failed to get raw data: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+
+        out_data = static_cast<const uint8_t*>(db_data.iov_base);
+        out_size = db_data.iov_len;
+        return true;
+    }
+
+    /// \brief Visits the raw values of all keys in `[first_key, last_key]` with one cursor walk.
+    /// \details Positions a cursor with `MDBX_SET_RANGE` and advances with `MDBX_NEXT`, so a
+    /// range of adjacent keys costs one B-tree descent instead of one lookup per key. Values
+    /// are passed without copying and stay valid until the transaction ends.
+    /// \tparam Key Must be uint32_t or uint64_t.
+    /// \tparam Callback Callable as `void(Key key, const uint8_t* data, size_t size)`.
+    /// \param txn MDBX transaction handle.
+    /// \param dbi Target database handle (opened with MDBX_INTEGERKEY).
+    /// \param first_key First key of the range (inclusive).
+    /// \param last_key Last key of the range (inclusive).
+    /// \param callback Called for every key in the range, in key order.
+    /// \return Number of visited keys.
+    /// \throws MDBXException if cursor operations fail.
+    template<typename Key, typename Callback>
+    size_t for_each_raw_in_range(MDBX_txn* txn, MDBX_dbi dbi, Key first_key, Key last_key, Callback&& callback) {
+        static_assert(std::is_same<Key, uint32_t>::value || std::is_same<Key, uint64_t>::value,"Key must be either uint32_t or uint64_t (supported by MDBX)");
+
+        MDBX_cursor* cursor = nullptr;
+        int rc = mdbx_cursor_open(txn, dbi, &cursor);
+        if (rc != MDBX_SUCCESS) throw MDBXException(
+            "Failed to open cursor: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+
+        size_t count = 0;
+        try {
+            MDBX_val db_key{std::addressof(first_key), sizeof(Key)};
+            MDBX_val db_data;
+            rc = mdbx_cursor_get(cursor, &db_key, &db_data, MDBX_SET_RANGE);
+            while (rc == MDBX_SUCCESS) {
+                if (db_key.iov_len != sizeof(Key)) throw MDBXException("Invalid key size.");
+                Key key;
+                std::memcpy(&key, db_key.iov_base, sizeof(Key));
+                if (key > last_key) break;
+                callback(key, static_cast<const uint8_t*>(db_data.iov_base), db_data.iov_len);
+                ++count;
+                rc = mdbx_cursor_get(cursor, &db_key, &db_data, MDBX_NEXT);
+            }
+            if (rc != MDBX_SUCCESS && rc != MDBX_NOTFOUND) throw MDBXException(
+                "Cursor iteration failed: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+        } catch (...) {
+            mdbx_cursor_close(cursor);
+            throw;
+        }
+
+        mdbx_cursor_close(cursor);
+        return count;
+    }
+
     /// \brief Retrieves a fixed-size object using an integral key (32-bit or 64-bit).
     /// \tparam Key Integral key type (must be 32-bit or 64-bit).
     /// \tparam T Type of object to retrieve (e.g., struct).
@@ -152,7 +227,108 @@ namespace dfh::storage::mdbx {
             std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
     }
 
+    /// \brief Deletes all entries whose keys fall into any of the given ranges.
+    /// \details One cursor seeks to the start of every range with `MDBX_SET_RANGE` and deletes
+    /// until the key leaves the range, so the cost depends on the number of deleted entries and
+    /// ranges, not on the size of the table.
+    /// \tparam Key Must be uint32_t or uint64_t.
+    /// \param txn MDBX transaction handle.
+    /// \param dbi Target database handle (opened with MDBX_INTEGERKEY).
+    /// \param ranges Inclusive key ranges `[first, last]`, in any order.
+    /// \return Number of deleted entries.
+    /// \throws MDBXException if cursor or delete operations fail.
+    template<typename Key>
+    size_t erase_key_ranges(MDBX_txn* txn, MDBX_dbi dbi, std::vector<std::pair<Key, Key>> ranges) {
+        static_assert(std::is_same<Key, uint32_t>::value || std::is_same<Key, uint64_t>::value,"Key must be either uint32_t or uint64_t (supported by MDBX)");
+        if (ranges.empty()) return 0;
+        std::sort(ranges.begin(), ranges.end());
+
+        MDBX_cursor* cursor = nullptr;
+        int rc = mdbx_cursor_open(txn, dbi, &cursor);
+        if (rc != MDBX_SUCCESS) throw MDBXException(
+            "Failed to open cursor for erase_key_ranges: (" +
+            std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+
+        size_t count = 0;
+        try {
+            for (const auto& range : ranges) {
+                Key first_key = range.first;
+                MDBX_val db_key{std::addressof(first_key), sizeof(Key)};
+                MDBX_val db_data;
+                rc = mdbx_cursor_get(cursor, &db_key, &db_data, MDBX_SET_RANGE);
+                while (rc == MDBX_SUCCESS) {
+                    if (db_key.iov_len != sizeof(Key)) throw MDBXException("Invalid key size.");
+                    Key key;
+                    std::memcpy(&key, db_key.iov_base, sizeof(Key));
+                    if (key > range.second) break;
+                    rc = mdbx_cursor_del(cursor, MDBX_CURRENT);
+                    if (rc != MDBX_SUCCESS) throw MDBXException(
+                        "Failed to delete entry in erase_key_ranges: (" +
+                        std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+                    ++count;
+                    rc = mdbx_cursor_get(cursor, &db_key, &db_data, MDBX_NEXT);
+                }
+                if (rc != MDBX_SUCCESS && rc != MDBX_NOTFOUND) throw MDBXException(
+                    "Cursor iteration failed in erase_key_ranges: (" +
+                    std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+            }
+        } catch (...) {
+            mdbx_cursor_close(cursor);
+            throw;
+        }
+
+        mdbx_cursor_close(cursor);
+        return count;
+    }
+
+    /// \brief Deletes all entries with keys in `[first_key, last_key]`.
+    /// \details Seeks to `first_key` and deletes until the key leaves the range; for keys that
+    /// place an ID in the high bits (see make_symbol_key64()) this removes one ID without
+    /// scanning the table.
+    /// \tparam Key Must be uint32_t or uint64_t.
+    /// \param txn MDBX transaction handle.
+    /// \param dbi Target database handle (opened with MDBX_INTEGERKEY).
+    /// \param first_key First key to delete (inclusive).
+    /// \param last_key Last key to delete (inclusive).
+    /// \return Number of deleted entries.
+    /// \throws MDBXException if cursor or delete operations fail.
+    template<typename Key>
+    inline size_t erase_key_range(MDBX_txn* txn, MDBX_dbi dbi, Key first_key, Key last_key) {
+        return erase_key_ranges<Key>(txn, dbi, {{first_key, last_key}});
+    }
+
+    /// \brief Retrieves the largest key of a table.
+    /// \details Used to decide whether a key can be written with `MDBX_APPEND`.
+    /// \tparam Key Must be uint32_t or uint64_t.
+    /// \param txn MDBX transaction handle.
+    /// \param dbi Target database handle (opened with MDBX_INTEGERKEY).
+    /// \param out_key Receives the last key.
+    /// \return True if the table is not empty, false otherwise.
+    /// \throws MDBXException if cursor operations fail.
+    template<typename Key>
+    bool get_last_key(MDBX_txn* txn, MDBX_dbi dbi, Key& out_key) {
+        static_assert(std::is_same<Key, uint32_t>::value || std::is_same<Key, uint64_t>::value,"Key must be either uint32_t or uint64_t (supported by MDBX)");
+
+        MDBX_cursor* cursor = nullptr;
+        int rc = mdbx_cursor_open(txn, dbi, &cursor);
+        if (rc != MDBX_SUCCESS) throw MDBXException(
+            "Failed to open cursor for get_last_key: (" +
+            std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+
+        MDBX_val db_key;
+        MDBX_val db_data;
+        rc = mdbx_cursor_get(cursor, &db_key, &db_data, MDBX_LAST);
+        mdbx_cursor_close(cursor);
+        if (rc == MDBX_NOTFOUND) return false;
+        if (rc != MDBX_SUCCESS) throw MDBXException(
+            "Failed to get last key: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+        if (db_key.iov_len != sizeof(Key)) throw MDBXException("Invalid key size.");
+        std::memcpy(&out_key, db_key.iov_base, sizeof(Key));
+        return true;
+    }
+
     /// \brief Deletes entries from a table where a key (32-bit or 64-bit) matches a masked value.
+    /// \note Scans the whole table; use erase_key_range() when the mask selects a key prefix.
     /// \tparam KeyType Either uint32_t or uint64_t.
     /// \param txn MDBX transaction handle.
     /// \param dbi Target database handle.
@@ -7,6 +7,8 @@
 
 #include "MDBXStorage/MetadataBD.hpp"
 #include "MDBXStorage/BarBD.hpp"
+#include "MDBXStorage/ZstdDictionaryBD.hpp"
+#include "MDBXStorage/TickDB.hpp"
 
 namespace dfh::storage::mdbx {
 
@@ -17,19 +19,27 @@ namespace dfh::storage::mdbx {
 
         /// \brief Constructs the market data storage.
         /// \param config Unique pointer to the MDBX configuration.
+        /// \param tick_threads Number of pooled threads compressing and decoding hourly tick segments;
+        ///        1 works serially, 0 uses the number of CPU cores (see TickBD).
         /// \throws MDBXException if connection or configuration fails.
-        explicit MDBXMarketDataStorage(ConfigPtr config)
+        explicit MDBXMarketDataStorage(ConfigPtr config, size_t tick_threads = 1)
             : m_connection(std::make_shared<MDBXConnection>(std::move(config))),
               m_metadata_db(m_connection.get()),
-              m_bar_db(m_connection.get()) {
+              m_bar_db(m_connection.get()),
+              m_tick_db(m_connection.get(), tick_threads),
+              m_dictionary_db(m_connection.get()) {
         }
 
         /// \brief Constructs storage using a shared MDBX connection.
         /// \param connection Shared pointer to an active MDBX connection.
-        explicit MDBXMarketDataStorage(std::shared_ptr<MDBXConnection> connection)
+        /// \param tick_threads Number of pooled threads compressing and decoding hourly tick segments;
+        ///        1 works serially, 0 uses the number of CPU cores (see TickBD).
+        explicit MDBXMarketDataStorage(std::shared_ptr<MDBXConnection> connection, size_t tick_threads = 1)
             : m_connection(std::move(connection)),
               m_metadata_db(m_connection.get()),
-              m_bar_db(m_connection.get()) {
+              m_bar_db(m_connection.get()),
+              m_tick_db(m_connection.get(), tick_threads),
+              m_dictionary_db(m_connection.get()) {
         }
 
         /// \brief Destructor that attempts to stop the backend.
@@ -38,6 +48,8 @@ namespace dfh::storage::mdbx {
                 if (!m_connection->is_connected()) return;
                 m_metadata_db.stop();
                 m_bar_db.stop();
+                m_tick_db.stop();
+                m_dictionary_db.stop();
             } catch(...) {};
         }
 
@@ -64,12 +76,16 @@ namespace dfh::storage::mdbx {
         }
 
         /// \copydoc IMarketDataStorage::start
+        /// \details Also registers all stored ZSTD dictionaries in ZstdDictionaryRegistry::instance().
         void start(const TransactionPtr& txn) override final {
             if (!m_connection->is_connected()) throw MDBXException("Connection is not established");
             MDBXTransaction* txn_ptr = dynamic_cast<MDBXTransaction*>(txn.get());
             if (!txn_ptr) throw MDBXException("Invalid transaction type");
             m_metadata_db.start(txn_ptr);
             m_bar_db.start(txn_ptr);
+            m_tick_db.start(txn_ptr);
+            m_dictionary_db.start(txn_ptr);
+            m_dictionary_db.load(txn_ptr, dfh::compression::ZstdDictionaryRegistry::instance());
         }
 
         /// \copydoc IMarketDataStorage::stop
@@ -77,6 +93,8 @@ namespace dfh::storage::mdbx {
             if (!m_connection->is_connected()) throw MDBXException("Connection is not established");
             m_metadata_db.stop();
             m_bar_db.stop();
+            m_tick_db.stop();
+            m_dictionary_db.stop();
         }
 
         /// \copydoc IMarketDataStorage::create_transaction
@@ -88,8 +106,11 @@ namespace dfh::storage::mdbx {
         void before_transaction(const TransactionPtr& txn) override final {}
 
         /// \copydoc IMarketDataStorage::after_transaction
+        /// \details Read-only transactions leave the backend state untouched, so readers on
+        /// different threads do not race with each other.
         void after_transaction(const TransactionPtr& txn) override final {
             MDBXTransaction* txn_ptr = dynamic_cast<MDBXTransaction*>(txn.get());
+            if (!txn_ptr || txn_ptr->mode() == TransactionMode::READ_ONLY) return;
             m_bar_db.after_transaction(txn_ptr);
         }
 
@@ -132,6 +153,49 @@ namespace dfh::storage::mdbx {
             m_bar_db.upsert(dynamic_cast<MDBXTransaction*>(txn.get()), market_type, exchange_id, symbol_id, bars, config);
         }
 
+        /// \brief Inserts or updates ticks of one symbol in hourly segments.
+        /// \details With more than one tick thread the hours are compressed in parallel
+        /// (see TickBatchSerializer); the writes stay on the calling thread.
+        /// \param txn Active read-write transaction.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param ticks Ticks in time order; every hour they touch is replaced.
+        /// \param config Codec config describing compression and metadata.
+        /// \throws MDBXException if the ticks are not in time order or the write fails.
+        void upsert(
+                const TransactionPtr& txn,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                const std::vector<dfh::MarketTick>& ticks,
+                const dfh::TickCodecConfig& config) {
+            m_tick_db.upsert(dynamic_cast<MDBXTransaction*>(txn.get()), market_type, exchange_id, symbol_id, ticks, config);
+        }
+
+        //--- ZSTD dictionaries ---
+
+        /// \brief Stores a trained ZSTD dictionary and registers it in ZstdDictionaryRegistry::instance().
+        /// \param txn Active read-write transaction.
+        /// \param dictionary Dictionary in ZDICT format (see TickDictionaryTrainer).
+        /// \return The dictionary ID to pass to TickSerializer::set_dictionary_id().
+        /// \throws std::invalid_argument If the dictionary carries no ID.
+        /// \throws MDBXException if the write fails.
+        uint32_t upsert_dictionary(const TransactionPtr& txn, const std::vector<uint8_t>& dictionary) {
+            const uint32_t id = m_dictionary_db.upsert(dynamic_cast<MDBXTransaction*>(txn.get()), dictionary);
+            dfh::compression::ZstdDictionaryRegistry::instance().add(dictionary);
+            return id;
+        }
+
+        /// \brief Loads a stored ZSTD dictionary.
+        /// \param txn Active transaction.
+        /// \param id Dictionary ID.
+        /// \param dictionary Receives the dictionary bytes.
+        /// \return True if the dictionary was found.
+        bool fetch_dictionary(const TransactionPtr& txn, uint32_t id, std::vector<uint8_t>& dictionary) {
+            return m_dictionary_db.fetch(dynamic_cast<MDBXTransaction*>(txn.get()), id, dictionary);
+        }
+
         //--- Data fetch ---
 
          /// \copydoc IMarketDataStorage::fetch(const TransactionPtr&, StorageMetadata&)
@@ -168,6 +232,47 @@ namespace dfh::storage::mdbx {
                 segment_key, out_bars, out_configs);
         }
 
+        /// \brief Fetches the tick metadata of a symbol.
+        /// \param txn Active transaction.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param metadata Output metadata object.
+        /// \return True if metadata is found, false otherwise.
+        bool fetch(
+                const TransactionPtr& txn,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                dfh::TickMetadata& metadata) {
+            return m_tick_db.fetch(dynamic_cast<MDBXTransaction*>(txn.get()),
+                market_type, exchange_id, symbol_id, metadata);
+        }
+
+        /// \brief Fetches the ticks of a symbol within `[start_time_ms, end_time_ms)`.
+        /// \param txn Active transaction.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param start_time_ms Start of the range in milliseconds (inclusive).
+        /// \param end_time_ms End of the range in milliseconds (exclusive).
+        /// \param out_ticks Output vector; the ticks of the range are appended.
+        /// \param out_config Receives the codec config of the decoded segments.
+        /// \return True if any ticks were appended, false otherwise.
+        bool fetch(
+                const TransactionPtr& txn,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                uint64_t start_time_ms,
+                uint64_t end_time_ms,
+                std::vector<dfh::MarketTick>& out_ticks,
+                dfh::TickCodecConfig& out_config) {
+            return m_tick_db.fetch(dynamic_cast<MDBXTransaction*>(txn.get()),
+                market_type, exchange_id, symbol_id, start_time_ms, end_time_ms,
+                out_ticks, out_config);
+        }
+
         //--- Data deletion --
 
         /// \copydoc IMarketDataStorage::erase(const TransactionPtr&, MarketType, uint16_t, uint16_t, TimeFrame, uint64_t)
@@ -201,16 +306,99 @@ namespace dfh::storage::mdbx {
             m_bar_db.erase(dynamic_cast<MDBXTransaction*>(txn.get()), time_frame);
         }
 
+        /// \brief Recompresses the stored tick segments of a symbol with another profile.
+        /// \details Idle-time pass that upgrades hours ingested with TickCompressionProfile::INGEST_FAST
+        /// to archive level; a segment is replaced only if it gets smaller (see TickBD::recompress()).
+        /// \param txn Active read-write transaction.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param start_time_ms Start of the range in milliseconds (inclusive).
+        /// \param end_time_ms End of the range in milliseconds (exclusive).
+        /// \param profile Target compression profile.
+        /// \return Number of replaced segments.
+        size_t recompress_ticks(
+                const TransactionPtr& txn,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                uint64_t start_time_ms,
+                uint64_t end_time_ms,
+                dfh::TickCompressionProfile profile = dfh::TickCompressionProfile::ARCHIVE) {
+            return m_tick_db.recompress(dynamic_cast<MDBXTransaction*>(txn.get()),
+                market_type, exchange_id, symbol_id, start_time_ms, end_time_ms, profile);
+        }
+
+        //--- Legacy tick migration ---
+
+        /// \brief Checks whether the database still holds ticks in the former hour-major `ticks` table.
+        /// \param txn Active transaction.
+        /// \return True if migrate_legacy_ticks() has work left.
+        bool has_legacy_ticks(const TransactionPtr& txn) {
+            return m_tick_db.has_legacy_segments(dynamic_cast<MDBXTransaction*>(txn.get()));
+        }
+
+        /// \brief Moves one batch of legacy tick segments to the current layout.
+        /// \details The migration is never run implicitly. Call this in a fresh write transaction,
+        /// commit, and repeat until it returns 0; every segment is copied, verified and only then
+        /// deleted, so an interrupted migration resumes where its last committed batch ended
+        /// (see TickBD::migrate_legacy_segments()).
+        /// \param txn Active read-write transaction.
+        /// \param market_type Market type of the legacy segments, which the old keys do not record.
+        /// \param max_segments Maximum number of segments to move in this transaction.
+        /// \return Number of legacy segments removed.
+        /// \throws MDBXException if a segment cannot be migrated; roll back the transaction then.
+        size_t migrate_legacy_ticks(
+                const TransactionPtr& txn,
+                dfh::MarketType market_type,
+                size_t max_segments = 4096) {
+            return m_tick_db.migrate_legacy_segments(dynamic_cast<MDBXTransaction*>(txn.get()), market_type, max_segments);
+        }
+
+        //--- Bulk loading ---
+
+        /// \brief Returns the MDBX connection used by the storage.
+        MDBXConnection& connection() noexcept {
+            return *m_connection;
+        }
+
+        /// \brief Writes many bar segments in one write transaction.
+        /// \details Segments are written in key order and appended with `MDBX_APPEND` where possible
+        /// (see BarBD::upsert(MDBXTransaction*, const std::vector<BarBulkSegment>&)). Bar metadata is
+        /// updated in the same transaction. Used by MDBXBulkLoader.
+        /// \param segments Segments to write, in any order; not modified.
+        /// \throws MDBXException if the transaction fails; nothing is written in that case.
+        void bulk_upsert(const std::vector<BarBulkSegment>& segments) {
+            if (!m_connection->is_connected()) throw MDBXException("Connection is not established");
+            MDBXTransaction txn(m_connection, TransactionMode::WRITABLE);
+            txn.begin();
+            try {
+                m_bar_db.prepare_metadata(&txn);
+                m_bar_db.upsert(&txn, segments);
+                m_bar_db.after_transaction(&txn);
+            } catch (...) {
+                m_bar_db.discard_metadata();
+                try {
+                    txn.rollback();
+                } catch (...) {}
+                throw;
+            }
+            txn.commit();
+        }
+
         /// \copydoc IMarketDataStorage::erase_all_data
         void erase_all_data(const TransactionPtr& txn) override final {
             m_metadata_db.erase_all_data(dynamic_cast<MDBXTransaction*>(txn.get()));
             m_bar_db.erase_all_data(dynamic_cast<MDBXTransaction*>(txn.get()));
+            m_tick_db.erase_all_data(dynamic_cast<MDBXTransaction*>(txn.get()));
         }
 
 	private:
         std::shared_ptr<MDBXConnection> m_connection;   ///< Shared pointer to the MDBX connection.
         MetadataBD m_metadata_db;                       ///< Interface to metadata database.
         BarBD      m_bar_db;                            ///< Interface to bar data database.
+        TickBD     m_tick_db;                           ///< Interface to tick data database.
+        ZstdDictionaryBD m_dictionary_db;               ///< Interface to the ZSTD dictionary database.
     };
 
 }; // namespace dfh::storage::mdbx
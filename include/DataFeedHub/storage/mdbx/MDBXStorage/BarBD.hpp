@@ -7,8 +7,21 @@
 
 namespace dfh::storage::mdbx {
 
+    /// \struct BarBulkSegment
+    /// \brief One segment of bars of one symbol, as passed to the bulk write path.
+    struct BarBulkSegment {
+        dfh::MarketType market_type = dfh::MarketType::UNKNOWN; ///< Market type.
+        uint16_t exchange_id = 0;           ///< Exchange identifier.
+        uint16_t symbol_id   = 0;           ///< Symbol identifier.
+        std::vector<MarketBar> bars;        ///< Bars that fit within one segment.
+        BarCodecConfig config;              ///< Codec config describing compression and metadata.
+    };
+
     /// \class BarBD
     /// \brief Handles saving and loading of bar data in MDBX.
+    ///
+    /// \thread_safety fetch() may run concurrently on different threads, each in its own
+    /// read-only transaction; writes must be serialized by the caller.
     class BarBD {
     public:
 
@@ -87,6 +100,7 @@ namespace dfh::storage::mdbx {
         /// \param symbol_id Symbol identifier.
         /// \param bars Vector of bars to store.
         /// \param config Codec config describing compression and metadata.
+        /// \param append True if the segment key is greater than every key of its table; writes with `MDBX_APPEND`.
         /// \throws MDBXException if serialization or insertion fails.
         void upsert(
                 MDBXTransaction *txn,
@@ -94,7 +108,8 @@ namespace dfh::storage::mdbx {
                 uint16_t exchange_id,
                 uint16_t symbol_id,
                 const std::vector<MarketBar>& bars,
-                const BarCodecConfig& config) {
+                const BarCodecConfig& config,
+                bool append = false) {
             if (bars.empty()) return;
             const uint64_t duration_ms = dfh::get_segment_duration_ms(config.time_frame);
             const uint64_t segment_key = bars.front().time_ms / duration_ms;
@@ -111,9 +126,10 @@ namespace dfh::storage::mdbx {
                 if (it_metadata != m_metadata.end()) {
                     BarMetadata& meta = it_metadata->second;
 
-                    m_buffer.clear();
-                    if (get_raw_key<uint64_t>(txn->handle(), m_dbi_bars[tf_index(config.time_frame)], data_key, m_buffer)) {
-                        uint32_t count = dfh::compression::extract_num_samples(m_buffer.data(), m_buffer.size());
+                    const uint8_t* data = nullptr;
+                    size_t size = 0;
+                    if (!append && get_raw_view<uint64_t>(txn->handle(), m_dbi_bars[tf_index(config.time_frame)], data_key, data, size)) {
+                        uint32_t count = dfh::compression::extract_num_samples(data, size);
                         if (meta.count >= count) {
                             meta.count -= count;
                             meta.count += static_cast<uint32_t>(bars.size());
@@ -166,7 +182,61 @@ namespace dfh::storage::mdbx {
                 txn->handle(),
                 m_dbi_bars[tf_index(config.time_frame)],
                 data_key,
-                m_buffer.data(), m_buffer.size());
+                m_buffer.data(), m_buffer.size(),
+                append);
+        }
+
+        /// \brief Writes many bar segments in key order.
+        ///
+        /// Segments are written ordered by table and key, so every table is filled front to back.
+        /// A segment whose key is greater than the last key of its table is written with
+        /// `MDBX_APPEND`, which skips the B-tree search and fills pages completely; other
+        /// segments are written as in upsert().
+        /// \param txn Active write transaction.
+        /// \param segments Segments to write, in any order; not modified. Each must fit within one segment.
+        /// \throws MDBXException if serialization or insertion fails.
+        void upsert(MDBXTransaction *txn, const std::vector<BarBulkSegment>& segments) {
+            std::vector<std::pair<uint64_t, size_t>> order;
+            order.reserve(segments.size());
+            for (size_t i = 0; i < segments.size(); ++i) {
+                const BarBulkSegment& segment = segments[i];
+                if (segment.bars.empty()) continue;
+                const uint64_t segment_key = segment.bars.front().time_ms / dfh::get_segment_duration_ms(segment.config.time_frame);
+                const uint32_t symbol_key = dfh::make_symbol_key32(segment.market_type, segment.exchange_id, segment.symbol_id);
+                order.emplace_back(dfh::make_symbol_key64(symbol_key, segment_key), i);
+            }
+            std::stable_sort(order.begin(), order.end(), [this, &segments](const auto& a, const auto& b) {
+                const size_t a_table = tf_index(segments[a.second].config.time_frame);
+                const size_t b_table = tf_index(segments[b.second].config.time_frame);
+                if (a_table != b_table) return a_table < b_table;
+                return a.first < b.first;
+            });
+
+            std::array<uint64_t, 11> last_keys{};
+            std::array<bool, 11> has_last_key{};
+            std::array<bool, 11> loaded{};
+            for (const auto& [data_key, index] : order) {
+                const BarBulkSegment& segment = segments[index];
+                const size_t table = tf_index(segment.config.time_frame);
+                if (!loaded[table]) {
+                    has_last_key[table] = get_last_key<uint64_t>(txn->handle(), m_dbi_bars[table], last_keys[table]);
+                    loaded[table] = true;
+                }
+                const bool append = !has_last_key[table] || data_key > last_keys[table];
+                upsert(txn, segment.market_type, segment.exchange_id, segment.symbol_id,
+                       segment.bars, segment.config, append);
+                if (append) {
+                    last_keys[table] = data_key;
+                    has_last_key[table] = true;
+                }
+            }
+        }
+
+        /// \brief Drops metadata loaded by prepare_metadata() without writing it.
+        /// \details Call when the transaction it belongs to is rolled back.
+        void discard_metadata() noexcept {
+            m_metadata.clear();
+            m_prepare_metadata = false;
         }
 
         /// \brief Fetches a bar metadata by symbol components.
@@ -209,14 +279,16 @@ namespace dfh::storage::mdbx {
                 uint64_t segment_key,
                 std::vector<dfh::MarketBar>& out_bars,
                 dfh::BarCodecConfig& out_configs) {
-            m_buffer.clear();
-            if (!get_raw_key<uint64_t>(txn->handle(), m_dbi_bars[tf_index(time_frame)],
+            const uint8_t* data = nullptr;
+            size_t size = 0;
+            if (!get_raw_view<uint64_t>(txn->handle(), m_dbi_bars[tf_index(time_frame)],
                     dfh::make_symbol_key64(
                     dfh::make_symbol_key32(market_type, exchange_id, symbol_id),
-                    segment_key), m_buffer)) {
+                    segment_key), data, size)) {
                 return false;
             }
-            m_serializer.deserialize(m_buffer, out_bars, out_configs);
+            // The segment is decoded straight from the memory map.
+            read_serializer().deserialize(data, size, out_bars, out_configs);
             return true;
         }
 
@@ -224,17 +296,19 @@ namespace dfh::storage::mdbx {
         /// \param txn Active transaction.
         /// \param metadata Metadata describing the data to be removed.
         void erase_data(MDBXTransaction *txn, const StorageMetadata& metadata) {
+            if (metadata.start_time_ms() == 0 || metadata.end_time_ms() == 0) {
+                std::vector<uint32_t> symbol_keys;
+                for (auto market_type : metadata.market_types())
+                for (auto exchange_id : metadata.exchange_ids())
+                for (auto symbol_id : metadata.symbol_ids()) {
+                    symbol_keys.push_back(dfh::make_symbol_key32(market_type, exchange_id, symbol_id));
+                }
+                erase(txn, symbol_keys);
+                return;
+            }
             for (auto market_type : metadata.market_types())
             for (auto exchange_id : metadata.exchange_ids())
             for (auto symbol_id : metadata.symbol_ids()) {
-                if (metadata.start_time_ms() == 0 || metadata.end_time_ms() == 0) {
-                    for (size_t i = 0; i < m_dbi_bars.size(); ++i) {
-                        erase_key_masked<uint64_t>(txn->handle(), m_dbi_bars[i],
-                            dfh::KEY64_SYMBOL_PART_MASK,
-                            dfh::make_symbol_key64(dfh::make_symbol_key32(market_type, exchange_id, symbol_id), 0));
-                    }
-                    continue;
-                }
                 for (size_t i = 0; i < timeframe_values.size(); ++i) {
                     const uint64_t duration_ms = dfh::get_segment_duration_ms(time_shield::sec_to_ms(timeframe_values[i]));
                     const uint64_t segment_start = metadata.start_time_ms() / duration_ms;
@@ -280,9 +354,10 @@ namespace dfh::storage::mdbx {
             }
 
             if (has_meta) {
-                m_buffer.clear();
-                if (get_raw_key<uint64_t>(txn->handle(), m_dbi_bars[tf_index(time_frame)], data_key, m_buffer)) {
-                    uint32_t count = dfh::compression::extract_num_samples(m_buffer.data(), m_buffer.size());
+                const uint8_t* data = nullptr;
+                size_t size = 0;
+                if (get_raw_view<uint64_t>(txn->handle(), m_dbi_bars[tf_index(time_frame)], data_key, data, size)) {
+                    uint32_t count = dfh::compression::extract_num_samples(data, size);
                     if (meta.count >= count) {
                         meta.count -= count;
                     } else {
@@ -315,9 +390,32 @@ namespace dfh::storage::mdbx {
                 uint16_t exchange_id,
                 uint16_t symbol_id,
                 dfh::TimeFrame time_frame) {
-            erase_key_masked<uint64_t>(txn->handle(), m_dbi_bars[tf_index(time_frame)],
-                dfh::KEY64_SYMBOL_PART_MASK,
-                dfh::make_symbol_key64(dfh::make_symbol_key32(market_type, exchange_id, symbol_id), 0));
+            const uint32_t symbol_key = dfh::make_symbol_key32(market_type, exchange_id, symbol_id);
+            erase_key_range<uint64_t>(txn->handle(), m_dbi_bars[tf_index(time_frame)],
+                dfh::make_symbol_key64(symbol_key, 0),
+                dfh::make_symbol_key64(symbol_key, dfh::KEY64_TIMESTAMP_MASK));
+        }
+
+        /// \brief Erases all bar segments of many symbols in every time frame.
+        /// \details Each table is purged with a single cursor that seeks to the key range of every
+        /// symbol (see erase_key_ranges()), so the cost does not depend on the size of the tables.
+        /// Bar metadata records are left untouched.
+        /// \param txn Active transaction.
+        /// \param symbol_keys Symbol keys created with make_symbol_key32().
+        void erase(
+                MDBXTransaction *txn,
+                const std::vector<uint32_t>& symbol_keys) {
+            if (symbol_keys.empty()) return;
+            std::vector<std::pair<uint64_t, uint64_t>> ranges;
+            ranges.reserve(symbol_keys.size());
+            for (uint32_t symbol_key : symbol_keys) {
+                ranges.emplace_back(
+                    dfh::make_symbol_key64(symbol_key, 0),
+                    dfh::make_symbol_key64(symbol_key, dfh::KEY64_TIMESTAMP_MASK));
+            }
+            for (size_t i = 0; i < m_dbi_bars.size(); ++i) {
+                erase_key_ranges<uint64_t>(txn->handle(), m_dbi_bars[i], ranges);
+            }
         }
 
         /// \brief Erases all bar data for the given time frame.
@@ -348,6 +446,12 @@ namespace dfh::storage::mdbx {
         std::vector<uint8_t> m_buffer;
         bool m_prepare_metadata = false;
 
+        /// \brief Returns the decoder of fetch() for the calling thread, so concurrent readers share nothing.
+        static dfh::compression::BarSerializer& read_serializer() {
+            thread_local dfh::compression::BarSerializer serializer;
+            return serializer;
+        }
+
         static constexpr std::array<uint32_t, 11> timeframe_values = {
             1,      // 0
             3,      // 1
@@ -9,6 +9,9 @@ namespace dfh::storage::mdbx {
 
 	/// \class FundingDB
     /// \brief Manages the storage and retrieval of funding rate data in an MDBX database.
+    ///
+    /// \thread_safety fetch_funding() may run concurrently on different threads, each in its own
+    /// read-only transaction; writes must be serialized by the caller.
     class FundingDB {
     public:
 
@@ -116,14 +119,8 @@ namespace dfh::storage::mdbx {
                 FundingMetadata& metadata) {
             uint32_t metadata_key = generate_metadata_key(symbol_id, provider_id);
             bool res;
-            m_connection.renew();
-            try {
-                res = get_fixed_key32(m_connection.rdonly_handle(), m_dbi_metadata, metadata_key, metadata);
-            } catch(...) {
-                m_connection.reset();
-                throw;
-            }
-            m_connection.reset();
+            MDBXReadLease lease(m_connection.read_pool());
+            res = get_fixed_key32(lease.handle(), m_dbi_metadata, metadata_key, metadata);
             return res;
         }
 
@@ -135,14 +132,8 @@ namespace dfh::storage::mdbx {
             int rc = 0;
             bool res;
             MDBX_cursor *cursor = nullptr;
-            m_connection.renew();
-            try {
-                res = get_all_metadata(m_connection.rdonly_handle(), metadata_records);
-            } catch(...) {
-                m_connection.reset();
-                throw;
-            }
-            m_connection.reset();
+            MDBXReadLease lease(m_connection.read_pool());
+            res = get_all_metadata(lease.handle(), metadata_records);
             return res;
         }
 
@@ -154,14 +145,8 @@ namespace dfh::storage::mdbx {
         bool fetch_metadata(std::unordered_map<uint32_t, FundingMetadata>& metadata_map) {
             bool res;
             MDBX_cursor *cursor = nullptr;
-            m_connection.renew();
-            try {
-                res = get_all_metadata(m_connection.rdonly_handle(), metadata_map);
-            } catch(...) {
-                m_connection.reset();
-                throw;
-            }
-            m_connection.reset();
+            MDBXReadLease lease(m_connection.read_pool());
+            res = get_all_metadata(lease.handle(), metadata_map);
             return res;
         }
 
@@ -274,50 +259,56 @@ namespace dfh::storage::mdbx {
                 std::vector<FundingRate>& fundings) {
             uint64_t start_hour = time_shield::ms_to_hour(start_ts);
             uint64_t end_hour = time_shield::ms_to_hour(end_ts - 1);
-            m_connection.renew();
-            try {
-                for (uint64_t unix_hour = start_hour; unix_hour <= end_hour; ++unix_hour) {
-                    uint64_t key = generate_tick_key(symbol_id, provider_id, unix_hour);
-                    m_buffer.clear();
-                    if (!get_tick(m_connection.rdonly_handle(), key, m_buffer)) continue;
-                    m_tick_serializer.deserialize(m_buffer, ticks, codec_config);
-                }
+            MDBXReadLease lease(m_connection.read_pool());
+            for (uint64_t unix_hour = start_hour; unix_hour <= end_hour; ++unix_hour) {
+                uint64_t key = generate_tick_key(symbol_id, provider_id, unix_hour);
+                std::vector<uint8_t>& buffer = read_buffer();
+                buffer.clear();
+                if (!get_tick(lease.handle(), key, buffer)) continue;
+                read_serializer().deserialize(buffer, ticks, codec_config);
+            }
 
-                if (start_ts > time_shield::hour_to_ms(start_hour)) {
-                    auto it_start = std::lower_bound(ticks.begin(), ticks.end(), start_ts,
-                        [](const MarketTick& tick, uint64_t timestamp) {
-                            return tick.time_ms < timestamp;
-                        });
-                    if (it_start != ticks.begin()) {
-                        ticks.erase(ticks.begin(), it_start); // Remove elements before start_ts
-                    }
+            if (start_ts > time_shield::hour_to_ms(start_hour)) {
+                auto it_start = std::lower_bound(ticks.begin(), ticks.end(), start_ts,
+                    [](const MarketTick& tick, uint64_t timestamp) {
+                        return tick.time_ms < timestamp;
+                    });
+                if (it_start != ticks.begin()) {
+                    ticks.erase(ticks.begin(), it_start); // Remove elements before start_ts
                 }
+            }
 
-                if (end_ts < (time_shield::hour_to_ms(end_hour) + time_shield::MS_PER_HOUR)) {
-                    auto it_end = std::lower_bound(ticks.begin(), ticks.end(), end_ts,
-                        [](const MarketTick& tick, uint64_t timestamp) {
-                            return tick.time_ms < timestamp;
-                        });
-                    if (it_end != ticks.end()) {
-                        ticks.erase(it_end, ticks.end());    // Remove elements >= end_ts
-                    }
+            if (end_ts < (time_shield::hour_to_ms(end_hour) + time_shield::MS_PER_HOUR)) {
+                auto it_end = std::lower_bound(ticks.begin(), ticks.end(), end_ts,
+                    [](const MarketTick& tick, uint64_t timestamp) {
+                        return tick.time_ms < timestamp;
+                    });
+                if (it_end != ticks.end()) {
+                    ticks.erase(it_end, ticks.end());    // Remove elements >= end_ts
                 }
-            } catch(...) {
-                m_connection.reset();
-                throw;
             }
-            m_connection.reset();
             return !ticks.empty();
         }
 
 	private:
 		std::unordered_map<uint32_t, FundingMetadata> m_metadata;
-		std::vector<uint8_t> m_buffer;
 		MDBXConnection& m_connection;
 		MDBX_dbi m_dbi_funding_rates = 0;
 		MDBX_dbi m_dbi_metadata      = 0;
 		MDBX_cursor *m_ticks_cursor  = nullptr;
 
+        /// \brief Returns the decoder of fetch_funding() for the calling thread, so concurrent readers share nothing.
+        static TickSerializer& read_serializer() {
+            thread_local TickSerializer serializer;
+            return serializer;
+        }
+
+        /// \brief Returns the value buffer of fetch_funding() for the calling thread.
+        static std::vector<uint8_t>& read_buffer() {
+            thread_local std::vector<uint8_t> buffer;
+            return buffer;
+        }
+
 		/// \brief Inserts or updates funding data in the database.
 		/// \param txn A pointer to the MDBX transaction handle.
 		/// \param key The funding identifier (64-bit key, e.g. timestamp-based).
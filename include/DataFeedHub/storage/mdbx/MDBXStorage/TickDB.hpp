@@ -2,469 +2,486 @@
 #ifndef _DFH_MDBX_TICK_BD_HPP_INCLUDED
 #define _DFH_MDBX_TICK_BD_HPP_INCLUDED
 
-/// \file TickBD.hpp
-/// \brief Provides an interface for storing and retrieving tick data in MDBX.
+/// \file TickDB.hpp
+/// \brief Manages the storage and retrieval of tick data in an MDBX database.
 
 namespace dfh::storage::mdbx {
 
-	/// \class TickBD
-    /// \brief Manages the storage and retrieval of tick data in an MDBX database.
+    /// \class TickBD
+    /// \brief Handles saving and loading of hourly tick segments in MDBX.
+    ///
+    /// Segments are stored in the `tick_segments` table under make_symbol_key64() keys with the
+    /// Unix hour as the time part, so the hours of one symbol are adjacent in the B-tree and a
+    /// range fetch is a single cursor walk. Metadata of every symbol is kept in
+    /// `tick_segment_metadata` under its make_symbol_key32() key.
+    ///
+    /// Databases written by earlier versions keep their segments in the hour-major `ticks`
+    /// table. start() only detects it; the segments are moved by migrate_legacy_segments(),
+    /// which the owner calls explicitly. The former `tick_metadata` table is left untouched.
+    ///
+    /// \thread_safety fetch() may run concurrently on different threads, each in its own
+    /// read-only transaction; multi-hour fetches on the worker pool run one at a time.
+    /// Writes must be serialized by the caller.
     class TickBD {
     public:
 
-		/// \brief Constructs a `TickBD` instance.
-        /// \param connection Reference to an active MDBX connection.
-		TickBD(MDBXConnection &connection) : m_connection(connection) {}
-
-		/// \brief Destructor.
-		~TickBD() {
-			if (m_dbi_ticks) {
-                mdbx_dbi_close(m_connection.env_handle(), m_dbi_ticks);
+        /// \brief Initializes the TickBD instance with the given MDBX connection.
+        /// \param connection Pointer to an active MDBX connection.
+        /// \param num_threads Number of pooled threads compressing hourly segments on upsert and decoding
+        ///        them on multi-hour fetches; 1 works serially, 0 uses the number of CPU cores.
+        TickBD(MDBXConnection* connection, size_t num_threads = 1)
+            : m_connection(connection),
+              m_pool(std::make_shared<dfh::compression::TickWorkerPool>(num_threads)),
+              m_batch_serializer(m_pool),
+              m_batch_deserializer(m_pool) {}
+
+        /// \brief Cleans up database handles on destruction.
+        ~TickBD() {
+            if (m_dbi_ticks) {
+                mdbx_dbi_close(m_connection->env_handle(), m_dbi_ticks);
             }
-			if (m_dbi_metadata) {
-                mdbx_dbi_close(m_connection.env_handle(), m_dbi_metadata);
+            if (m_dbi_legacy_ticks) {
+                mdbx_dbi_close(m_connection->env_handle(), m_dbi_legacy_ticks);
             }
-		}
-
-		/// \brief Initializes the database and loads metadata.
-        /// \throws MDBXException if database initialization fails.
-		void start() {
-			MDBXTransaction transaction(m_connection.env_handle(), MDBX_TXN_READWRITE);
-			int rc = 0;
-			try {
-                // Открываем (или создаем) подбазу данных "ticks"
-                rc = mdbx_dbi_open(transaction.handle(), "ticks", MDBX_CREATE | MDBX_INTEGERKEY, &m_dbi_ticks);
-                if (rc != MDBX_SUCCESS) {
-                    throw MDBXException("Failed to open 'ticks' database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc), rc));
-                }
-                // Открываем (или создаем) подбазу данных "tick_metadata"
-                rc = mdbx_dbi_open(transaction.handle(), "tick_metadata", MDBX_CREATE | MDBX_INTEGERKEY, &m_dbi_metadata);
-                if (rc != MDBX_SUCCESS) {
-                    throw MDBXException("Failed to open 'tick_metadata' database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc), rc));
-                }
-                // Читаем мета данные
-                get_all_fixed_map_key32(transaction.handle(), m_dbi_metadata, m_metadata);
-            } catch(...) {
-                transaction.abort();
-                throw;
+            if (m_dbi_metadata) {
+                mdbx_dbi_close(m_connection->env_handle(), m_dbi_metadata);
             }
-			transaction.commit();
-		}
+        }
 
-		/// \brief Closes the database connections.
-        /// \throws MDBXException if closing fails.
-        void stop() {
-			int rc = 0;
-			if (m_dbi_ticks) {
-				rc |= mdbx_dbi_close(m_connection.env_handle(), m_dbi_ticks);
-			}
-			if (m_dbi_metadata) {
-				rc |= mdbx_dbi_close(m_connection.env_handle(), m_dbi_metadata);
-			}
-			if (rc != MDBX_SUCCESS) {
-				throw MDBXException("Failed to close database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc), rc));
-			}
-		}
-
-        /// \brief Inserts or updates tick metadata.
-        /// \param metadata The metadata entry to insert or update.
-		void upsert(const TickMetadata& metadata) {
-            uint32_t metadata_key = generate_metadata_key(metadata.symbol_id, metadata.provider_id);
-            auto it_metadata = m_metadata.find(metadata_key);
-            if (it_metadata == m_metadata.end()) {
-                m_metadata[metadata_key] = metadata;
-            } else
-            if (std::memcmp(&it_metadata->second, &metadata, sizeof(TickMetadata)) == 0) {
-                return;
+        /// \brief Opens the tick segment and metadata tables.
+        /// \details The former `ticks` table is opened only if it exists; nothing is migrated here
+        /// (see migrate_legacy_segments()).
+        /// \param txn MDBX transaction used to open the tables.
+        /// \throws MDBXException if any table fails to open.
+        void start(MDBXTransaction *txn) {
+            int rc = mdbx_dbi_open(txn->handle(), "tick_segments", MDBX_CREATE | MDBX_INTEGERKEY, &m_dbi_ticks);
+            if (rc != MDBX_SUCCESS) {
+                throw MDBXException("Failed to open 'tick_segments' database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
             }
 
-            MDBXTransaction transaction(m_connection.env_handle(), MDBX_TXN_READWRITE);
-            put_fixed_key32(transaction.handle(), m_dbi_metadata, metadata_key, metadata);
-            transaction.commit();
-        }
-
-        /// \brief Inserts or updates tick metadata.
-        /// \details If metadata with the same symbol and provider already exists, it will be updated.
-        /// \param metadata_list The metadata entry to insert or update.
-        /// \throws MDBXException if the operation fails.
-        void upsert(const std::vector<TickMetadata>& metadata_list) {
-            MDBXTransaction transaction(m_connection.env_handle(), MDBX_TXN_READWRITE);
-            for (const auto& metadata : metadata_list) {
-                uint32_t metadata_key = generate_metadata_key(metadata.symbol_id, metadata.provider_id);
-                auto it_metadata = m_metadata.find(metadata_key);
-                if (it_metadata == m_metadata.end()) {
-                    m_metadata[metadata_key] = metadata;
-                } else
-                if (std::memcmp(&it_metadata->second, &metadata, sizeof(TickMetadata)) == 0) {
-                    continue;
-                } else {
-                    it_metadata->second = metadata;
-                }
-                put_fixed_key32(transaction.handle(), m_dbi_metadata, metadata_key, metadata);
+            rc = mdbx_dbi_open(txn->handle(), "tick_segment_metadata", MDBX_CREATE | MDBX_INTEGERKEY, &m_dbi_metadata);
+            if (rc != MDBX_SUCCESS) {
+                throw MDBXException("Failed to open 'tick_segment_metadata' database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
             }
-            transaction.commit();
-        }
 
-        /// \brief Retrieves tick metadata by symbol and provider.
-        /// \param symbol_id The symbol identifier.
-        /// \param provider_id The provider identifier.
-        /// \param metadata Reference to store the retrieved metadata.
-        /// \return True if metadata was found, false otherwise.
-        bool fetch(
-                uint16_t symbol_id,
-                uint16_t provider_id,
-                TickMetadata& metadata) {
-            uint32_t metadata_key = generate_metadata_key(symbol_id, provider_id);
-            bool res;
-            m_connection.renew();
-            try {
-                res = get_fixed_key32(m_connection.rdonly_handle(), m_dbi_metadata, metadata_key, metadata);
-            } catch(...) {
-                m_connection.reset();
-                throw;
+            rc = mdbx_dbi_open(txn->handle(), "ticks", MDBX_INTEGERKEY, &m_dbi_legacy_ticks);
+            if (rc == MDBX_NOTFOUND) {
+                m_dbi_legacy_ticks = 0;
+            } else
+            if (rc != MDBX_SUCCESS) {
+                throw MDBXException("Failed to open 'ticks' database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
             }
-            m_connection.reset();
-            return res;
         }
 
-        /// \brief Retrieves all tick metadata records.
-        /// \param metadata_records Reference to a vector where the retrieved metadata will be stored.
-        /// \return True if at least one metadata record was found, false otherwise.
-        /// \throws MDBXException if retrieval fails.
-        bool fetch(std::vector<TickMetadata>& metadata_records) {
+        /// \brief Closes all opened database handles.
+        /// \throws MDBXException if any close operation fails.
+        void stop() {
             int rc = 0;
-            bool res;
-            m_connection.renew();
-            try {
-                res = get_all_fixed_key32(m_connection.rdonly_handle(), m_dbi_metadata, metadata_records);
-            } catch(...) {
-                m_connection.reset();
-                throw;
+            if (m_dbi_ticks) {
+                rc |= mdbx_dbi_close(m_connection->env_handle(), m_dbi_ticks);
+                m_dbi_ticks = 0;
+            }
+            if (m_dbi_legacy_ticks) {
+                rc |= mdbx_dbi_close(m_connection->env_handle(), m_dbi_legacy_ticks);
+                m_dbi_legacy_ticks = 0;
+            }
+            if (m_dbi_metadata) {
+                rc |= mdbx_dbi_close(m_connection->env_handle(), m_dbi_metadata);
+                m_dbi_metadata = 0;
+            }
+            if (rc != MDBX_SUCCESS) {
+                throw MDBXException("Failed to close database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
             }
-            m_connection.reset();
-            return res;
         }
 
-        /// \brief Retrieves all tick metadata records as a key-value map.
-        /// \param metadata_map Reference to a map where the retrieved metadata will be stored.
-        ///        The key is a unique metadata identifier (uint32_t).
-        /// \return True if at least one metadata record was found, false otherwise.
-        /// \throws MDBXException if retrieval fails.
-        bool fetch(std::unordered_map<uint32_t, TickMetadata>& metadata_map) {
-            bool res;
-            m_connection.renew();
-            try {
-                res = get_all_fixed_map_key32(m_connection.rdonly_handle(), m_dbi_metadata, metadata_map);
-            } catch(...) {
-                m_connection.reset();
-                throw;
+        /// \brief Inserts or updates ticks of one symbol in hourly segments.
+        /// \details Every hour touched by `ticks` is replaced as a whole. Segments are compressed on
+        /// the worker pool and written in key order; the symbol's metadata is updated in the same
+        /// transaction.
+        /// \param txn Active read-write transaction.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param ticks Ticks in time order.
+        /// \param config Codec config describing compression and metadata.
+        /// \throws MDBXException if the ticks are not in time order or the write fails.
+        void upsert(
+                MDBXTransaction *txn,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                const std::vector<MarketTick>& ticks,
+                const TickCodecConfig& config) {
+            if (ticks.empty()) return;
+            std::vector<std::vector<MarketTick>> segments;
+            if (!split_ticks(ticks, segments)) throw MDBXException("TickBD::upsert(): Ticks are not in time order.");
+
+            const uint32_t symbol_key = dfh::make_symbol_key32(market_type, exchange_id, symbol_id);
+            TickMetadata meta;
+            if (!get_fixed_key<uint32_t>(txn->handle(), m_dbi_metadata, symbol_key, meta)) {
+                meta.start_time_ms = ticks.front().time_ms;
+                meta.end_time_ms   = ticks.back().time_ms;
+                meta.market_type   = market_type;
+                meta.exchange_id   = exchange_id;
+                meta.symbol_id     = symbol_id;
             }
-            m_connection.reset();
-            return res;
+            if (ticks.front().time_ms < meta.start_time_ms) meta.start_time_ms = ticks.front().time_ms;
+            if (ticks.back().time_ms > meta.end_time_ms) meta.end_time_ms = ticks.back().time_ms;
+            meta.expiration_time_ms      = config.expiration_time_ms;
+            meta.next_expiration_time_ms = config.next_expiration_time_ms;
+            meta.tick_size     = config.tick_size;
+            meta.price_digits  = config.price_digits;
+            meta.volume_digits = config.volume_digits;
+            meta.flags         = config.flags;
+
+            put_segments(txn, symbol_key, segments, config, meta);
+            put_fixed_key<uint32_t>(txn->handle(), m_dbi_metadata, symbol_key, meta);
         }
 
-        /// \brief Returns a copy of all cached metadata.
-        /// \return A map containing all cached tick metadata.
-        std::unordered_map<uint32_t, TickMetadata> cached_metadata() const {
-            return m_metadata;
+        /// \brief Fetches the tick metadata of a symbol.
+        /// \param txn Active transaction.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param metadata Output metadata object.
+        /// \return True if metadata is found, false otherwise.
+        bool fetch(
+                MDBXTransaction *txn,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                TickMetadata& metadata) {
+            return get_fixed_key<uint32_t>(txn->handle(), m_dbi_metadata,
+                dfh::make_symbol_key32(market_type, exchange_id, symbol_id), metadata);
         }
 
-        /// \brief Retrieves tick metadata from the in-memory cache by symbol and provider.
-        /// \param symbol_id The symbol identifier.
-        /// \param provider_id The provider identifier.
-        /// \param metadata Reference to store the retrieved metadata.
-        /// \return True if metadata was found in cache, false otherwise.
-        bool get_cached(
+        /// \brief Fetches the ticks of a symbol within `[start_time_ms, end_time_ms)`.
+        /// \details The segments of the range are collected with one cursor walk over the
+        /// symbol-major keys and referenced in place inside the transaction. Segments written with
+        /// `BLOCK_INDEX` only decode the blocks overlapping the range; other segments are decoded in
+        /// full and trimmed. Ranges spanning several stored hours are decoded on the worker pool
+        /// when the instance was constructed with more than one thread (see TickBatchDeserializer).
+        /// \param txn Active transaction.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param start_time_ms Start of the range in milliseconds (inclusive).
+        /// \param end_time_ms End of the range in milliseconds (exclusive).
+        /// \param ticks Output vector; the ticks of the range are appended.
+        /// \param config Receives the codec config of the decoded segments.
+        /// \return True if any ticks were appended, false otherwise.
+        /// \throws MDBXException if retrieval fails.
+        bool fetch(
+                MDBXTransaction *txn,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
                 uint16_t symbol_id,
-                uint16_t provider_id,
-                TickMetadata& metadata) const {
-            uint32_t metadata_key = generate_metadata_key(symbol_id, provider_id);
-            auto it = m_metadata.find(metadata_key);
-            if (it != m_metadata.end()) {
-                metadata = it->second;
-                return true;
+                uint64_t start_time_ms,
+                uint64_t end_time_ms,
+                std::vector<MarketTick>& ticks,
+                TickCodecConfig& config) {
+            if (end_time_ms <= start_time_ms) return false;
+            const uint32_t symbol_key = dfh::make_symbol_key32(market_type, exchange_id, symbol_id);
+            std::vector<dfh::compression::TickSegmentRef>& segments = read_segments();
+            segments.clear();
+            for_each_raw_in_range<uint64_t>(
+                txn->handle(),
+                m_dbi_ticks,
+                dfh::make_symbol_key64(symbol_key, time_shield::ms_to_hour(start_time_ms)),
+                dfh::make_symbol_key64(symbol_key, time_shield::ms_to_hour(end_time_ms - 1)),
+                [&segments](uint64_t, const uint8_t* data, size_t size) {
+                    segments.push_back(dfh::compression::TickSegmentRef{data, size});
+                });
+
+            const size_t initial_size = ticks.size();
+            if (segments.size() >= 2 && m_batch_deserializer.num_threads() > 1) {
+                m_batch_deserializer.deserialize_range(segments, start_time_ms, end_time_ms, ticks, config);
+            } else {
+                for (const auto& segment : segments) {
+                    read_serializer().deserialize_range(segment.data, segment.size, start_time_ms, end_time_ms, ticks, config);
+                }
             }
-            return false;
+            return ticks.size() > initial_size;
         }
 
-        /// \brief Retrieves all cached tick metadata records.
-        /// \param metadata_records Reference to a vector where the cached metadata will be stored.
-        /// \return True if at least one metadata record was found in cache, false otherwise.
-        bool get_cached(std::vector<TickMetadata>& metadata_records) const {
-            if (m_metadata.empty()) return false;
-            metadata_records.reserve(metadata_records.size() + m_metadata.size());
-            for (const auto& [key, metadata] : m_metadata) {
-                metadata_records.push_back(metadata);
+        /// \brief Rebuilds the stored segments of a symbol with another compression profile.
+        /// \details Idle-time pass for ticks ingested with TickCompressionProfile::INGEST_FAST: every
+        /// segment whose hour overlaps `[start_time_ms, end_time_ms)` is recompressed without
+        /// re-encoding the ticks (see TickSerializer::recompress()) and replaced only if the result
+        /// is smaller. Segments already at the target level are therefore left as they are, and
+        /// ticks and metadata do not change. Keep the range short enough for one write transaction.
+        /// \param txn Active read-write transaction.
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param start_time_ms Start of the range in milliseconds (inclusive).
+        /// \param end_time_ms End of the range in milliseconds (exclusive).
+        /// \param profile Target compression profile.
+        /// \return Number of replaced segments.
+        /// \throws MDBXException if reading or writing fails.
+        /// \throws std::runtime_error If a segment cannot be recompressed.
+        size_t recompress(
+                MDBXTransaction *txn,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                uint64_t start_time_ms,
+                uint64_t end_time_ms,
+                dfh::TickCompressionProfile profile) {
+            if (end_time_ms <= start_time_ms) return 0;
+            const uint32_t symbol_key = dfh::make_symbol_key32(market_type, exchange_id, symbol_id);
+            std::vector<uint64_t> keys;
+            for_each_raw_in_range<uint64_t>(
+                txn->handle(),
+                m_dbi_ticks,
+                dfh::make_symbol_key64(symbol_key, time_shield::ms_to_hour(start_time_ms)),
+                dfh::make_symbol_key64(symbol_key, time_shield::ms_to_hour(end_time_ms - 1)),
+                [&keys](uint64_t key, const uint8_t*, size_t) {
+                    keys.push_back(key);
+                });
+
+            size_t count = 0;
+            std::vector<uint8_t> output;
+            for (uint64_t key : keys) {
+                const uint8_t* data = nullptr;
+                size_t size = 0;
+                if (!get_raw_view<uint64_t>(txn->handle(), m_dbi_ticks, key, data, size)) continue;
+                m_buffer.assign(data, data + size);
+                output.clear();
+                m_serializer.recompress(m_buffer, profile, output);
+                if (output.empty() || output.size() >= m_buffer.size()) continue;
+                put_raw_key<uint64_t>(txn->handle(), m_dbi_ticks, key, output.data(), output.size());
+                ++count;
             }
-            return true;
+            return count;
         }
 
-        /// \brief Retrieves all cached tick metadata records as a key-value map.
-        /// \param metadata_map Reference to a map where the cached metadata will be stored.
-        /// \return True if at least one metadata record was found in cache, false otherwise.
-        bool get_cached(std::unordered_map<uint32_t, TickMetadata>& metadata_map) const {
-            if (m_metadata.empty()) return false;
-            metadata_map.insert(m_metadata.begin(), m_metadata.end());
-            return true;
+        /// \brief Checks whether the former hour-major `ticks` table still holds segments.
+        /// \param txn Active transaction.
+        /// \return True if migrate_legacy_segments() has work left.
+        bool has_legacy_segments(MDBXTransaction *txn) {
+            uint64_t last_key = 0;
+            return m_dbi_legacy_ticks && get_last_key<uint64_t>(txn->handle(), m_dbi_legacy_ticks, last_key);
         }
 
-        /// \brief Inserts or updates tick data in hourly fragments.
-        /// \details Tick data is stored in hourly segments, replacing entire segments.
-        /// \param symbol_id The symbol identifier.
-        /// \param provider_id The provider identifier.
-        /// \param ticks The tick data to insert.
-        /// \param codec_config The encoding configuration.
-        /// \throws MDBXException if storage fails.
-		void upsert(
-                uint16_t symbol_id,
-                uint16_t provider_id,
-                const std::vector<MarketTick>& ticks,
-                const TickCodecConfig& codec_config) {
-            if (ticks.empty()) return;
-
-            std::vector<std::vector<MarketTick>> out_segments;
-			if (!split_ticks(ticks, out_segments)) throw MDBXException("Ticks are not in correct order.");
-
-			uint64_t start_ts = ticks.front().time_ms;
-            uint64_t end_ts   = ticks.back().time_ms;
-
-            MDBXTransaction transaction(m_connection.env_handle(), MDBX_TXN_READWRITE);
-
-            uint32_t metadata_key = generate_metadata_key(symbol_id, provider_id);
-            auto it_metadata = m_metadata.find(metadata_key);
-            if (it_metadata == m_metadata.end()) {
-                TickMetadata metadata;
-                metadata.symbol_id   = symbol_id;
-                metadata.provider_id = provider_id;
-                metadata.flags = codec_config.flags;
-                metadata.price_digits  = codec_config.price_digits;
-                metadata.volume_digits = codec_config.volume_digits;
-                metadata.price_tick_size  = dfh::utils::precision_tolerance(codec_config.price_digits);
-                metadata.volume_step_size = dfh::utils::precision_tolerance(codec_config.volume_digits);
-                metadata.start_ts = ticks.front().time_ms;
-                metadata.end_ts   = ticks.back().time_ms;
-                m_metadata[metadata_key] = metadata;
-                it_metadata = m_metadata.find(metadata_key);
-                put_fixed_key32(transaction.handle(), m_dbi_metadata, metadata_key, metadata);
-            } else {
-                bool is_update = false;
-                if (time_shield::start_of_hour_ms(end_ts) >=
-                    time_shield::start_of_hour_ms(it_metadata->end_ts)) {
-                    if (it_metadata->price_digits != codec_config.price_digits) {
-                        it_metadata->price_digits = codec_config.price_digits;
-                        it_metadata->price_tick_size  = dfh::utils::precision_tolerance(codec_config.price_digits);
-                        is_update = true;
-                    }
-                    if (it_metadata->volume_digits != codec_config.volume_digits) {
-                        it_metadata->volume_digits = codec_config.volume_digits;
-                        it_metadata->volume_step_size = dfh::utils::precision_tolerance(codec_config.volume_digits);
-                        is_update = true;
+        /// \brief Moves up to `max_segments` segments of the former `ticks` table to `tick_segments`.
+        /// \details Legacy keys are [unix_hour (32 bits)] | [provider_id (16 bits)] | [symbol_id (16 bits)]
+        /// and carry no market type, so the caller supplies it; the provider becomes the exchange ID.
+        /// Every segment is copied unchanged, read back and decoded, and only then deleted from the
+        /// old table; the decoded ticks rebuild the symbol's metadata. A segment already present under
+        /// the new key was written after the upgrade and is kept; its legacy copy is dropped.
+        ///
+        /// All work happens in `txn`, so a batch that fails or is rolled back leaves both tables as
+        /// they were. Commit after each call and repeat until it returns 0; after an interruption the
+        /// migration resumes with the remaining legacy segments.
+        /// \param txn Active read-write transaction.
+        /// \param market_type Market type of all legacy segments.
+        /// \param max_segments Maximum number of segments to move in this call.
+        /// \return Number of legacy segments removed.
+        /// \throws MDBXException if a provider ID does not fit the exchange field, a copy does not
+        ///         verify, or reading or writing fails.
+        size_t migrate_legacy_segments(
+                MDBXTransaction *txn,
+                dfh::MarketType market_type,
+                size_t max_segments = 4096) {
+            if (!m_dbi_legacy_ticks || max_segments == 0) return 0;
+            MDBX_cursor* cursor = nullptr;
+            int rc = mdbx_cursor_open(txn->handle(), m_dbi_legacy_ticks, &cursor);
+            if (rc != MDBX_SUCCESS) throw MDBXException(
+                "Failed to open cursor for migrate_legacy_segments: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+
+            std::unordered_map<uint32_t, TickMetadata> metadata;
+            size_t count = 0;
+            try {
+                MDBX_val db_key, db_data;
+                while (count < max_segments) {
+                    rc = mdbx_cursor_get(cursor, &db_key, &db_data, MDBX_FIRST);
+                    if (rc == MDBX_NOTFOUND) break;
+                    if (rc != MDBX_SUCCESS) throw MDBXException(
+                        "Cursor iteration failed in migrate_legacy_segments: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+                    uint64_t legacy_key;
+                    if (db_key.iov_len != sizeof(legacy_key)) throw MDBXException("Invalid key size.");
+                    std::memcpy(&legacy_key, db_key.iov_base, sizeof(legacy_key));
+                    const uint16_t provider_id = static_cast<uint16_t>((legacy_key >> 16) & 0xFFFF);
+                    if (provider_id > 0x03FF) throw MDBXException(
+                        "Legacy provider ID " + std::to_string(provider_id) + " does not fit the exchange ID field.");
+                    const uint16_t symbol_id = static_cast<uint16_t>(legacy_key & 0xFFFF);
+                    const uint32_t symbol_key = dfh::make_symbol_key32(market_type, provider_id, symbol_id);
+                    const uint64_t key = dfh::make_symbol_key64(symbol_key, legacy_key >> 32);
+
+                    // The value is copied out first: writes may move pages of a write transaction.
+                    const uint8_t* legacy_data = static_cast<const uint8_t*>(db_data.iov_base);
+                    m_buffer.assign(legacy_data, legacy_data + db_data.iov_len);
+                    MDBX_val new_key{const_cast<uint64_t*>(&key), sizeof(key)};
+                    MDBX_val new_data{m_buffer.data(), m_buffer.size()};
+                    rc = mdbx_put(txn->handle(), m_dbi_ticks, &new_key, &new_data, MDBX_NOOVERWRITE);
+                    if (rc != MDBX_SUCCESS && rc != MDBX_KEYEXIST) throw MDBXException(
+                        "Failed to migrate tick segment: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+
+                    if (rc == MDBX_SUCCESS) {
+                        const uint8_t* data = nullptr;
+                        size_t size = 0;
+                        if (!get_raw_view<uint64_t>(txn->handle(), m_dbi_ticks, key, data, size) ||
+                            size != m_buffer.size() ||
+                            std::memcmp(data, m_buffer.data(), size) != 0) {
+                            throw MDBXException("Migrated tick segment does not match its legacy copy.");
+                        }
+                        update_migrated_metadata(metadata, txn, symbol_key, market_type, provider_id, symbol_id, data, size);
                     }
+
+                    rc = mdbx_cursor_get(cursor, &db_key, &db_data, MDBX_FIRST);
+                    if (rc == MDBX_SUCCESS) rc = mdbx_cursor_del(cursor, MDBX_UPSERT);
+                    if (rc != MDBX_SUCCESS) throw MDBXException(
+                        "Failed to delete migrated tick segment: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+                    ++count;
                 }
-                if (start_ts < it_metadata->start_ts ||
-                    end_ts > it_metadata->end_ts) {
-                    it_metadata->start_ts = start_ts;
-                    it_metadata->end_ts = end_ts;
-                    is_update = true;
-                }
-                if (is_update) {
-                    put_fixed_key32(transaction.handle(), m_dbi_metadata, metadata_key, *it_metadata);
+                for (const auto& [symbol_key, meta] : metadata) {
+                    put_fixed_key<uint32_t>(txn->handle(), m_dbi_metadata, symbol_key, meta);
                 }
+            } catch (...) {
+                mdbx_cursor_close(cursor);
+                throw;
             }
+            mdbx_cursor_close(cursor);
+            return count;
+        }
 
-            std::vector<uint8_t> output;
-			for (const auto &segment : out_segments) {
-                m_tick_serializer.serialize(segment, codec_config, output);
-                const uint32_t unix_hour = time_shield::start_of_hour_ms(segment[0].time_ms);
-                put_raw_key64(
-                    transaction.handle(),
-                    m_dbi_ticks,
-                    generate_tick_key(symbol_id, provider_id, unix_hour),
-                    output.data(), output.size(),
-                    (out_segments.size() >= 2));
-			}
-
-			transaction.commit();
-		}
-
-        /// \brief Inserts or updates tick data in hourly fragments.
-        /// \details Tick data is stored in hourly segments, replacing entire segments.
-        /// \param symbol_id The symbol identifier.
-        /// \param provider_id The provider identifier.
-        /// \param ticks The tick data to insert.
-        /// \throws MDBXException if storage fails.
-		void upsert(
-                uint16_t symbol_id,
-                uint16_t provider_id,
-                const std::vector<MarketTick>& ticks) {
-            if (ticks.empty()) return;
-
-            std::vector<std::vector<MarketTick>> out_segments;
-			if (!split_ticks(ticks, out_segments)) throw MDBXException("Ticks are not in correct order.");
-
-            MDBXTransaction transaction(m_connection.env_handle(), MDBX_TXN_READWRITE);
-
-			TickCodecConfig codec_config;
-			uint32_t metadata_key = generate_metadata_key(symbol_id, provider_id);
-            auto it_metadata = m_metadata.find(metadata_key);
-            if (it_metadata == m_metadata.end()) {
-                TickMetadata metadata;
-                if (!get_fixed_key32(transaction.handle(), m_dbi_metadata, metadata_key, metadata)) throw MDBXException("?");
-
-                codec_config.volume_digits = metadata.volume_digits;
-                codec_config.price_digits = metadata.price_digits;
-                codec_config.flags = metadata.flags;
-
-                m_metadata[metadata_key] = metadata;
-                it_metadata = m_metadata.find(metadata_key);
-            } else {
-                codec_config.volume_digits = it_metadata->volume_digits;
-                codec_config.price_digits = it_metadata->price_digits;
-                codec_config.flags = it_metadata->flags;
-            }
+        /// \brief Erases all tick segments and tick metadata.
+        /// \param txn Active transaction.
+        /// \warning This action deletes all data irreversibly. The former `ticks` table is kept.
+        void erase_all_data(MDBXTransaction *txn) {
+            erase_all_entries(txn->handle(), m_dbi_ticks);
+            erase_all_entries(txn->handle(), m_dbi_metadata);
+        }
 
-            const uint64_t start_ts = ticks.front().time_ms;
-            const uint64_t end_ts   = ticks.back().time_ms;
-            if (start_ts < it_metadata->start_ts ||
-                end_ts > it_metadata->end_ts) {
-                it_metadata->start_ts = start_ts;
-                it_metadata->end_ts   = end_ts;
-                put_fixed_key32(transaction.handle(), m_dbi_metadata, metadata_key, *it_metadata);
-            }
+    private:
+        MDBXConnection* m_connection;
+        MDBX_dbi m_dbi_ticks = 0;        ///< Segments under symbol-major keys ("tick_segments").
+        MDBX_dbi m_dbi_legacy_ticks = 0; ///< Former hour-major table ("ticks"); 0 if absent.
+        MDBX_dbi m_dbi_metadata = 0;     ///< TickMetadata by symbol key ("tick_segment_metadata").
+        std::shared_ptr<dfh::compression::TickWorkerPool> m_pool; ///< Workers shared by the batch serializer and deserializer.
+        dfh::compression::TickBatchSerializer m_batch_serializer;
+        dfh::compression::TickBatchDeserializer m_batch_deserializer;
+        dfh::compression::TickSerializer m_serializer; ///< Recompresses segments on the writing thread.
+        std::vector<uint8_t> m_buffer;
+        std::vector<MarketTick> m_ticks;
+
+        /// \brief Returns the decoder of fetch() for the calling thread, so concurrent readers share nothing.
+        static dfh::compression::TickSerializer& read_serializer() {
+            thread_local dfh::compression::TickSerializer serializer;
+            return serializer;
+        }
 
-            std::vector<uint8_t> output;
-			for (const auto &segment : out_segments) {
-                m_tick_serializer.serialize(segment, codec_config, output);
-                const uint32_t unix_hour = time_shield::ms_to_hour(segment[0].time_ms);
-                put_raw_key64(
-                    transaction.handle(),
-                    m_dbi_ticks,
-                    generate_tick_key(symbol_id, provider_id, unix_hour),
-                    output.data(), output.size(),
-                    (out_segments.size() >= 2));
-			}
-
-			transaction.commit();
-		}
-
-		/// \brief Retrieves tick data.
-        /// \param symbol_id The symbol identifier.
-        /// \param provider_id The provider identifier.
-        /// \param start_ts The start timestamp.
-        /// \param end_ts The end timestamp.
-        /// \param ticks The vector where the retrieved tick data will be appended.
-        /// \param codec_config The encoding configuration.
-        /// \return True if any ticks were found, otherwise false.
-        /// \throws MDBXException if retrieval fails.
-		bool fetch(
-                uint16_t symbol_id,
-                uint16_t provider_id,
-                uint64_t start_ts,
-                uint64_t end_ts,
-                std::vector<MarketTick>& ticks,
-                TickCodecConfig& codec_config) {
-            uint64_t start_hour = time_shield::ms_to_hour(start_ts);
-            uint64_t end_hour = time_shield::ms_to_hour(end_ts - 1);
-            m_connection.renew();
-            try {
-                for (uint64_t unix_hour = start_hour; unix_hour <= end_hour; ++unix_hour) {
-                    uint64_t key = generate_tick_key(symbol_id, provider_id, unix_hour);
-                    m_buffer.clear();
-                    if (!get_raw_key64(m_connection.rdonly_handle(), m_dbi_ticks, key, m_buffer)) continue;
-                    m_tick_serializer.deserialize(m_buffer, ticks, codec_config);
-                }
+        /// \brief Returns the segment references collected by fetch() on the calling thread.
+        static std::vector<dfh::compression::TickSegmentRef>& read_segments() {
+            thread_local std::vector<dfh::compression::TickSegmentRef> segments;
+            return segments;
+        }
 
-                if (start_ts > time_shield::hour_to_ms(start_hour)) {
-                    auto it_start = std::lower_bound(ticks.begin(), ticks.end(), start_ts,
-                        [](const MarketTick& tick, uint64_t timestamp) {
-                            return tick.time_ms < timestamp;
-                        });
-                    if (it_start != ticks.begin()) {
-                        ticks.erase(ticks.begin(), it_start); // Remove elements before start_ts
+        /// \brief Compresses hourly segments on the worker pool and writes them in key order.
+        /// \details Every `put` happens on the calling thread, which owns the write transaction.
+        /// `MDBX_APPEND` is used only when the first hour lies beyond the last key of the table;
+        /// rewrites and symbols below the table's last key use a regular upsert, and the ticks of
+        /// replaced segments are subtracted from `meta.count`.
+        /// \param txn Active read-write transaction.
+        /// \param symbol_key Symbol key created with make_symbol_key32().
+        /// \param segments Hourly tick segments in time order.
+        /// \param config Codec config describing compression.
+        /// \param meta Metadata of the symbol; its count is updated.
+        void put_segments(
+                MDBXTransaction *txn,
+                uint32_t symbol_key,
+                const std::vector<std::vector<MarketTick>>& segments,
+                const TickCodecConfig& config,
+                TickMetadata& meta) {
+            const uint64_t first_key = dfh::make_symbol_key64(symbol_key, time_shield::ms_to_hour(segments.front()[0].time_ms));
+            uint64_t last_key = 0;
+            const bool append = !get_last_key<uint64_t>(txn->handle(), m_dbi_ticks, last_key) || first_key > last_key;
+            m_batch_serializer.serialize(segments, config,
+                [&](size_t index, const std::vector<uint8_t>& output) {
+                    const uint64_t data_key = dfh::make_symbol_key64(symbol_key, time_shield::ms_to_hour(segments[index][0].time_ms));
+                    const uint8_t* data = nullptr;
+                    size_t size = 0;
+                    if (!append && get_raw_view<uint64_t>(txn->handle(), m_dbi_ticks, data_key, data, size)) {
+                        const uint64_t count = dfh::compression::extract_num_samples(data, size);
+                        meta.count = meta.count >= count ? meta.count - count : 0;
                     }
-                }
+                    meta.count += segments[index].size();
+                    put_raw_key<uint64_t>(txn->handle(), m_dbi_ticks, data_key, output.data(), output.size(), append);
+                });
+        }
 
-                if (end_ts < (time_shield::hour_to_ms(end_hour) + time_shield::MS_PER_HOUR)) {
-                    auto it_end = std::lower_bound(ticks.begin(), ticks.end(), end_ts,
-                        [](const MarketTick& tick, uint64_t timestamp) {
-                            return tick.time_ms < timestamp;
-                        });
-                    if (it_end != ticks.end()) {
-                        ticks.erase(it_end, ticks.end());    // Remove elements >= end_ts
-                    }
+        /// \brief Adds a migrated segment to the metadata of its symbol.
+        /// \param metadata Metadata updated by the current migration batch.
+        /// \param txn Active transaction, used to load stored metadata on first use.
+        /// \param symbol_key Symbol key created with make_symbol_key32().
+        /// \param market_type Market type.
+        /// \param exchange_id Exchange identifier.
+        /// \param symbol_id Symbol identifier.
+        /// \param data Pointer to the migrated segment.
+        /// \param size Size of the segment in bytes.
+        /// \throws std::invalid_argument If the segment does not decode.
+        void update_migrated_metadata(
+                std::unordered_map<uint32_t, TickMetadata>& metadata,
+                MDBXTransaction *txn,
+                uint32_t symbol_key,
+                dfh::MarketType market_type,
+                uint16_t exchange_id,
+                uint16_t symbol_id,
+                const uint8_t* data,
+                size_t size) {
+            TickCodecConfig config;
+            m_ticks.clear();
+            read_serializer().deserialize(data, size, m_ticks, config);
+            if (m_ticks.empty()) return;
+
+            auto it = metadata.find(symbol_key);
+            if (it == metadata.end()) {
+                TickMetadata meta;
+                if (!get_fixed_key<uint32_t>(txn->handle(), m_dbi_metadata, symbol_key, meta)) {
+                    meta.start_time_ms = m_ticks.front().time_ms;
+                    meta.end_time_ms   = m_ticks.back().time_ms;
+                    meta.market_type   = market_type;
+                    meta.exchange_id   = exchange_id;
+                    meta.symbol_id     = symbol_id;
+                    meta.tick_size     = config.tick_size;
+                    meta.price_digits  = config.price_digits;
+                    meta.volume_digits = config.volume_digits;
+                    meta.flags         = config.flags;
                 }
-            } catch(...) {
-                m_connection.reset();
-                throw;
+                it = metadata.emplace(symbol_key, meta).first;
             }
-            m_connection.reset();
-            return !ticks.empty();
+            TickMetadata& meta = it->second;
+            if (m_ticks.front().time_ms < meta.start_time_ms) meta.start_time_ms = m_ticks.front().time_ms;
+            if (m_ticks.back().time_ms > meta.end_time_ms) meta.end_time_ms = m_ticks.back().time_ms;
+            meta.count += m_ticks.size();
         }
 
-	private:
-		TickSerializer  m_tick_serializer;
-		std::unordered_map<uint32_t, TickMetadata> m_metadata;
-		std::vector<uint8_t> m_buffer;
-		MDBXConnection& m_connection;
-		MDBX_dbi m_dbi_ticks = 0;
-		MDBX_dbi m_dbi_metadata = 0;
-
-		/// \brief Generates a 64-bit key for tick storage.
-        /// \param symbol_id The symbol identifier.
-        /// \param provider_id The provider identifier.
-        /// \param unix_hour The Unix timestamp rounded to the hour.
-        /// \return A unique 64-bit key constructed as:
-		///         [unix_hour (32 bits)] | [provider_id (16 bits)] | [symbol_id (16 bits)].
-		uint64_t generate_tick_key(uint16_t symbol_id, uint16_t provider_id, uint32_t unix_hour) {
-			return ((uint64_t)provider_id << 16) | (uint64_t)symbol_id | ((uint64_t)unix_hour << 32);
-		}
-
-		/// \brief Generates a 32-bit key for metadata storage.
-        /// \param symbol_id The symbol identifier.
-        /// \param provider_id The provider identifier.
-        /// \return A unique 32-bit key constructed as:
-		///         [provider_id (upper 16 bits)] | [symbol_id (lower 16 bits)].
-		uint32_t generate_metadata_key(uint16_t symbol_id, uint16_t provider_id) {
-			return ((uint32_t)provider_id << 16) | (uint32_t)symbol_id;
-		}
-
-		/// \brief Splits the tick data into hourly segments and ensures time order.
-        /// \param ticks The full vector of tick data.
-        /// \param out_segments A vector of vectors, where each sub-vector contains ticks for one hour.
-        /// \return True if the ticks are ordered correctly, otherwise false.
+        /// \brief Splits ticks into hourly segments and checks their time order.
+        /// \param ticks Ticks to split.
+        /// \param out_segments Receives one vector of ticks per hour.
+        /// \return True if the ticks are in time order, false otherwise.
         bool split_ticks(const std::vector<MarketTick>& ticks, std::vector<std::vector<MarketTick>>& out_segments) {
             uint64_t current_hour = time_shield::ms_to_hour(ticks[0].time_ms);
             std::vector<MarketTick> current_segment;
-
-            current_segment.reserve(ticks.size());
-
             for (size_t i = 0; i < ticks.size(); ++i) {
                 const MarketTick& tick = ticks[i];
-
-                if (i > 0 && tick.time_ms < ticks[i - 1].time_ms) {
-                    return false; // Ticks are not ordered
-                }
-
-                uint64_t tick_hour = time_shield::ms_to_hour(tick.time_ms);
+                if (i > 0 && tick.time_ms < ticks[i - 1].time_ms) return false;
+                const uint64_t tick_hour = time_shield::ms_to_hour(tick.time_ms);
                 if (tick_hour != current_hour) {
-                    // Store completed segment
                     out_segments.push_back(std::move(current_segment));
                     current_segment.clear();
-                    current_segment.reserve(ticks.size() - i);
                     current_hour = tick_hour;
                 }
-
                 current_segment.push_back(tick);
             }
-
             if (!current_segment.empty()) {
                 out_segments.push_back(std::move(current_segment));
             }
-
             return true;
         }
     };
 
-};
+} // namespace dfh::storage::mdbx
 
 #endif // _DFH_MDBX_TICK_BD_HPP_INCLUDED
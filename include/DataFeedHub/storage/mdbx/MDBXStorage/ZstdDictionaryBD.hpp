@@ -0,0 +1,116 @@
+#pragma once
+#ifndef _DFH_STORAGE_MDBX_ZSTD_DICTIONARY_BD_HPP_INCLUDED
+#define _DFH_STORAGE_MDBX_ZSTD_DICTIONARY_BD_HPP_INCLUDED
+
+/// \file ZstdDictionaryBD.hpp
+/// \brief Stores trained ZSTD dictionaries in an MDBX sub-database.
+
+namespace dfh::storage::mdbx {
+
+    /// \class ZstdDictionaryBD
+    /// \brief Persists ZSTD dictionaries keyed by their dictionary ID.
+    ///
+    /// Dictionaries live in the `zstd_dictionaries` table (32-bit integer keys). The ID is the
+    /// one stored in the dictionary itself, which is also the ID written into the frame header
+    /// of every segment compressed with it.
+    class ZstdDictionaryBD {
+    public:
+        /// \brief Constructs the dictionary backend with the given MDBX connection.
+        /// \param connection Pointer to an active MDBXConnection instance.
+        ZstdDictionaryBD(MDBXConnection* connection)
+            : m_connection(connection) {
+        }
+
+        /// \brief Destructor that closes the database handle if it was opened.
+        ~ZstdDictionaryBD() {
+            if (!m_dbi_dictionaries) return;
+            mdbx_dbi_close(m_connection->env_handle(), m_dbi_dictionaries);
+        }
+
+        /// \brief Opens the dictionary table (creating if necessary).
+        /// \param txn Active transaction to use for database opening.
+        /// \throws MDBXException if the operation fails.
+        void start(MDBXTransaction* txn) {
+            int rc = mdbx_dbi_open(txn->handle(), "zstd_dictionaries", MDBX_CREATE | MDBX_INTEGERKEY, &m_dbi_dictionaries);
+            if (rc != MDBX_SUCCESS) throw MDBXException("Failed to open 'zstd_dictionaries' database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+        }
+
+        /// \brief Closes the dictionary table.
+        /// \throws MDBXException if closing fails.
+        void stop() {
+            if (!m_dbi_dictionaries) return;
+            int rc = mdbx_dbi_close(m_connection->env_handle(), m_dbi_dictionaries);
+            m_dbi_dictionaries = 0;
+            if (rc != MDBX_SUCCESS) throw MDBXException("Failed to close database: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+        }
+
+        /// \brief Stores a dictionary under its dictionary ID.
+        /// \param txn Active read-write transaction.
+        /// \param dictionary Dictionary in ZDICT format.
+        /// \return The dictionary ID.
+        /// \throws std::invalid_argument If the dictionary carries no ID.
+        /// \throws MDBXException if the write fails.
+        uint32_t upsert(MDBXTransaction* txn, const std::vector<uint8_t>& dictionary) {
+            const uint32_t id = ZSTD_getDictID_fromDict(dictionary.data(), dictionary.size());
+            if (id == 0) throw std::invalid_argument("ZSTD dictionary has no dictionary ID.");
+            put_raw_key<uint32_t>(txn->handle(), m_dbi_dictionaries, id, dictionary.data(), dictionary.size());
+            return id;
+        }
+
+        /// \brief Loads a dictionary by ID.
+        /// \param txn Active transaction.
+        /// \param id Dictionary ID.
+        /// \param dictionary Receives the dictionary bytes.
+        /// \return True if the dictionary was found.
+        /// \throws MDBXException if the read fails.
+        bool fetch(MDBXTransaction* txn, uint32_t id, std::vector<uint8_t>& dictionary) {
+            return get_raw_key<uint32_t>(txn->handle(), m_dbi_dictionaries, id, dictionary);
+        }
+
+        /// \brief Registers all stored dictionaries.
+        /// \param txn Active transaction.
+        /// \param registry Registry receiving the dictionaries.
+        /// \return Number of stored dictionaries.
+        /// \throws MDBXException if iteration fails.
+        size_t load(MDBXTransaction* txn, dfh::compression::ZstdDictionaryRegistry& registry) {
+            MDBX_cursor* cursor = nullptr;
+            int rc = mdbx_cursor_open(txn->handle(), m_dbi_dictionaries, &cursor);
+            if (rc != MDBX_SUCCESS) throw MDBXException(
+                "Failed to open cursor: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+
+            size_t count = 0;
+            MDBX_val db_key, db_data;
+            try {
+                while ((rc = mdbx_cursor_get(cursor, &db_key, &db_data, MDBX_NEXT)) == MDBX_SUCCESS) {
+                    const uint8_t* data = static_cast<const uint8_t*>(db_data.iov_base);
+                    registry.add(std::vector<uint8_t>(data, data + db_data.iov_len));
+                    ++count;
+                }
+            } catch (...) {
+                mdbx_cursor_close(cursor);
+                throw;
+            }
+
+            mdbx_cursor_close(cursor);
+            if (rc != MDBX_NOTFOUND) throw MDBXException(
+                "Cursor iteration failed: (" + std::to_string(rc) + ") " + std::string(mdbx_strerror(rc)), rc);
+            return count;
+        }
+
+        /// \brief Removes a dictionary.
+        /// \param txn Active read-write transaction.
+        /// \param id Dictionary ID.
+        /// \warning Segments compressed with the dictionary can no longer be decoded by processes
+        ///          that have not registered it yet.
+        void erase(MDBXTransaction* txn, uint32_t id) {
+            erase_key<uint32_t>(txn->handle(), m_dbi_dictionaries, id);
+        }
+
+    private:
+        MDBXConnection* m_connection;           ///< Pointer to the MDBX connection.
+        MDBX_dbi        m_dbi_dictionaries = 0; ///< Database handle for dictionaries.
+    };
+
+} // namespace dfh::storage::mdbx
+
+#endif // _DFH_STORAGE_MDBX_ZSTD_DICTIONARY_BD_HPP_INCLUDED
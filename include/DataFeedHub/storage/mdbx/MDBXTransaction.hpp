@@ -12,7 +12,9 @@ namespace dfh::storage::mdbx {
     ///
     /// This class handles read-only and writable transactions, including beginning,
     /// committing, and rolling back operations. It manages transaction lifecycles
-    /// and integrates with MDBX-specific features.
+    /// and integrates with MDBX-specific features. Read-only transactions lease the
+    /// calling thread's transaction from MDBXConnection::read_pool(), so each reader
+    /// thread works on its own handle; begin and commit/rollback must run on the same thread.
     class MDBXTransaction final : public dfh::storage::ITransaction {
     public:
 
@@ -26,12 +28,14 @@ namespace dfh::storage::mdbx {
         /// \brief Destructor that safely closes or resets the transaction.
         ///
         /// Ensures that the transaction is properly closed or reset depending on mode.
-        /// Read-only transactions are reset for reuse; writable transactions are aborted.
+        /// Read-only transactions are returned to the pool; writable transactions are aborted.
         virtual ~MDBXTransaction() {
 			if (!m_txn) return;
 			switch (m_mode) {
             case TransactionMode::READ_ONLY:
-                mdbx_txn_reset(m_txn);
+                try {
+                    m_connection->read_pool().release();
+                } catch (...) {}
                 m_txn = nullptr;
                 break;
             case TransactionMode::WRITABLE:
@@ -47,10 +51,7 @@ namespace dfh::storage::mdbx {
             if (m_txn) throw MDBXException("Transaction already started.");
             switch (m_mode) {
             case TransactionMode::READ_ONLY:
-                m_txn = m_connection->rdonly_handle();
-                m_rc = mdbx_txn_renew(m_txn);
-                if (m_rc != MDBX_SUCCESS) throw MDBXException(
-                        "Failed to renew transaction: (" + std::to_string(m_rc) + ") " + std::string(mdbx_strerror(m_rc)), m_rc);
+                m_txn = m_connection->read_pool().acquire();
                 break;
             case TransactionMode::WRITABLE:
                 m_rc = mdbx_txn_begin(m_connection->env_handle(), nullptr, MDBX_TXN_READWRITE, &m_txn);
@@ -66,10 +67,8 @@ namespace dfh::storage::mdbx {
             if (!m_txn) throw MDBXException("No active transaction to commit.");
             switch (m_mode) {
             case TransactionMode::READ_ONLY:
-                m_rc = mdbx_txn_reset(m_txn);
-                if (m_rc != MDBX_SUCCESS) throw MDBXException(
-                    "Failed to reset read-only transaction: (" + std::to_string(m_rc) + ") " + std::string(mdbx_strerror(m_rc)), m_rc);
                 m_txn = nullptr;
+                m_connection->read_pool().release();
                 break;
             case TransactionMode::WRITABLE:
                 m_rc = mdbx_txn_commit(m_txn);
@@ -86,10 +85,8 @@ namespace dfh::storage::mdbx {
             if (!m_txn) throw MDBXException("No active transaction to rollback.");
             switch (m_mode) {
             case TransactionMode::READ_ONLY:
-                m_rc = mdbx_txn_reset(m_txn);
-                if (m_rc != MDBX_SUCCESS) throw MDBXException(
-                    "Failed to reset read-only transaction: (" + std::to_string(m_rc) + ") " + std::string(mdbx_strerror(m_rc)), m_rc);
                 m_txn = nullptr;
+                m_connection->read_pool().release();
                 break;
             case TransactionMode::WRITABLE:
                 m_rc = mdbx_txn_abort(m_txn);
@@ -106,6 +103,11 @@ namespace dfh::storage::mdbx {
 			return m_txn;
 		}
 
+        /// \brief Returns the transaction mode.
+        TransactionMode mode() const noexcept {
+            return m_mode;
+        }
+
     private:
         std::shared_ptr<MDBXConnection> m_connection; ///< MDBX connection used to create the transaction.
         TransactionMode m_mode;                       ///< Mode of the transaction (read-only or writable).
@@ -16,6 +16,7 @@
 #include "utils/aligned_allocator.hpp"
 #include "utils/binance_parser.hpp"
 #include "utils/bybit_parser.hpp"
+#include "utils/cpu_features.hpp"
 #include "utils/enum_utils.hpp"
 #include "utils/fixed_point.hpp"
 #include "utils/math_utils.hpp"
@@ -239,6 +239,33 @@ namespace dfh::utils {
             return num_bits;
         }
 
+        /// \brief Count set bits
+        /// \return Number of bits set to 1
+        size_t count() const {
+            size_t total = 0;
+            for (uint64_t block : bits) {
+                for (; block; block &= block - 1) ++total;
+            }
+            return total;
+        }
+
+        /// \brief Access the underlying 64-bit blocks
+        /// \return Pointer to the blocks; bit `pos` is bit `pos % 64` of block `pos / 64`
+        const uint64_t* data() const {
+            return bits.data();
+        }
+
+        /// \brief Access the underlying 64-bit blocks
+        /// \return Pointer to the blocks; bits past size() must stay zero
+        uint64_t* data() {
+            return bits.data();
+        }
+
+        /// \brief Number of 64-bit blocks
+        size_t num_blocks() const {
+            return bits.size();
+        }
+
         void clear() {
             bits.clear();
             num_bits = 0;
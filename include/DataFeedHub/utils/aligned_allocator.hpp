@@ -56,7 +56,9 @@ namespace dfh::utils {
             void* pT = nullptr;
             if (::posix_memalign(&pT, BYTE_ALIGNMENT, n * sizeof(T)) == 0)
 #           else
-            if (auto p = static_cast<T*>(std::aligned_alloc(BYTE_ALIGNMENT, n * sizeof(T))))
+            // aligned_alloc requires the size to be a multiple of the alignment.
+            if (auto p = static_cast<T*>(std::aligned_alloc(BYTE_ALIGNMENT,
+                    (n * sizeof(T) + BYTE_ALIGNMENT - 1) / BYTE_ALIGNMENT * BYTE_ALIGNMENT)))
 #           endif
             {
 #               if defined(__APPLE__)
@@ -0,0 +1,159 @@
+#pragma once
+#ifndef _DFH_UTILS_CPU_FEATURES_HPP_INCLUDED
+#define _DFH_UTILS_CPU_FEATURES_HPP_INCLUDED
+
+/// \file cpu_features.hpp
+/// \brief Runtime detection of x86 SIMD extensions and per-function target attributes.
+/// \details Kernels compiled with DFH_TARGET_* may use the corresponding intrinsics even when
+/// the translation unit is built for a lower baseline; they must only be called after
+/// checking cpu_features(). Kernel families keep function-pointer tables that are filled
+/// once from active_simd_level(), so one binary runs the best variant on every host.
+
+#if defined(__x86_64__) || defined(_M_X64)
+#   define DFH_ARCH_X86 1
+#   if defined(_MSC_VER)
+#       include <intrin.h>
+#   else
+#       include <cpuid.h>
+#   endif
+#   include <immintrin.h>
+#endif
+
+#if defined(DFH_ARCH_X86) && !defined(_MSC_VER)
+#   define DFH_TARGET_SSE41  __attribute__((target("sse4.1")))
+#   define DFH_TARGET_AVX2   __attribute__((target("avx2")))
+#   define DFH_TARGET_AVX512 __attribute__((target("avx512f,avx512dq")))
+#else
+#   define DFH_TARGET_SSE41
+#   define DFH_TARGET_AVX2
+#   define DFH_TARGET_AVX512
+#endif
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+
+namespace dfh::utils {
+
+    /// \struct CpuFeatures
+    /// \brief SIMD extensions supported by both the CPU and the operating system.
+    struct CpuFeatures {
+        bool sse41    = false; ///< SSE4.1.
+        bool avx2     = false; ///< AVX2 (with OS support for YMM state).
+        bool avx512f  = false; ///< AVX-512 Foundation (with OS support for ZMM state).
+        bool avx512dq = false; ///< AVX-512 Doubleword and Quadword instructions.
+    };
+
+#   if defined(DFH_ARCH_X86)
+    namespace detail {
+
+        /// \brief Executes CPUID for the given leaf and subleaf.
+        inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t regs[4]) {
+#           if defined(_MSC_VER)
+            int info[4];
+            __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+            for (int i = 0; i < 4; ++i) regs[i] = static_cast<uint32_t>(info[i]);
+#           else
+            __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#           endif
+        }
+
+        /// \brief Reads the XCR0 register (enabled OS state components).
+        inline uint64_t xgetbv0() {
+#           if defined(_MSC_VER)
+            return _xgetbv(0);
+#           else
+            uint32_t eax = 0, edx = 0;
+            __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+            return (static_cast<uint64_t>(edx) << 32) | eax;
+#           endif
+        }
+
+    } // namespace detail
+#   endif
+
+    /// \brief Queries the CPU for supported SIMD extensions.
+    /// \return Detected features; all false on targets other than x86-64.
+    inline CpuFeatures detect_cpu_features() {
+        CpuFeatures features;
+#       if defined(DFH_ARCH_X86)
+        uint32_t regs[4] = {0, 0, 0, 0};
+        detail::cpuid(0, 0, regs);
+        const uint32_t max_leaf = regs[0];
+        if (max_leaf < 1) return features;
+
+        detail::cpuid(1, 0, regs);
+        features.sse41 = (regs[2] & (1u << 19)) != 0;
+        const bool osxsave = (regs[2] & (1u << 27)) != 0;
+        const bool avx     = (regs[2] & (1u << 28)) != 0;
+        if (!osxsave || !avx || max_leaf < 7) return features;
+
+        const uint64_t xcr0 = detail::xgetbv0();
+        const bool ymm_state = (xcr0 & 0x06) == 0x06;
+        const bool zmm_state = (xcr0 & 0xE6) == 0xE6;
+
+        detail::cpuid(7, 0, regs);
+        features.avx2     = ymm_state && (regs[1] & (1u << 5)) != 0;
+        features.avx512f  = zmm_state && (regs[1] & (1u << 16)) != 0;
+        features.avx512dq = features.avx512f && (regs[1] & (1u << 17)) != 0;
+#       endif
+        return features;
+    }
+
+    /// \brief Returns the features of the current CPU, detected once per process.
+    inline const CpuFeatures& cpu_features() {
+        static const CpuFeatures features = detect_cpu_features();
+        return features;
+    }
+
+    /// \enum SimdLevel
+    /// \brief Instruction set level used by dispatched kernels.
+    enum class SimdLevel : uint8_t {
+        SCALAR = 0, ///< Portable C++ kernels.
+        SSE41  = 1, ///< SSE4.1 kernels.
+        AVX2   = 2, ///< AVX2 kernels.
+        AVX512 = 3  ///< AVX-512 F/DQ kernels.
+    };
+
+    /// \brief Returns a printable name of the SIMD level.
+    inline const char* to_str(SimdLevel level) {
+        switch (level) {
+            case SimdLevel::SSE41:  return "sse4.1";
+            case SimdLevel::AVX2:   return "avx2";
+            case SimdLevel::AVX512: return "avx512";
+            default:                return "scalar";
+        }
+    }
+
+    /// \brief Returns the highest SIMD level supported by the CPU.
+    /// \details The `DFH_SIMD` environment variable (`scalar`, `sse4.1`, `avx2`, `avx512`)
+    /// caps the level, e.g. to compare kernels or to rule out a miscompiled variant.
+    inline SimdLevel detect_simd_level() {
+        const CpuFeatures& cpu = cpu_features();
+        SimdLevel level = SimdLevel::SCALAR;
+        if (cpu.sse41) level = SimdLevel::SSE41;
+        if (cpu.sse41 && cpu.avx2) level = SimdLevel::AVX2;
+        if (cpu.sse41 && cpu.avx2 && cpu.avx512f && cpu.avx512dq) level = SimdLevel::AVX512;
+
+        if (const char* env = std::getenv("DFH_SIMD")) {
+            SimdLevel cap = level;
+            if (std::strcmp(env, "scalar") == 0)      cap = SimdLevel::SCALAR;
+            else if (std::strcmp(env, "sse4.1") == 0) cap = SimdLevel::SSE41;
+            else if (std::strcmp(env, "avx2") == 0)   cap = SimdLevel::AVX2;
+            else if (std::strcmp(env, "avx512") == 0) cap = SimdLevel::AVX512;
+            if (cap < level) level = cap;
+        }
+        return level;
+    }
+
+    /// \brief Returns the SIMD level used by all dispatched kernels, resolved once per process.
+    /// \details Kernel tables are built from this value on first use; report it in diagnostics
+    /// to know which code path a process is running.
+    inline SimdLevel active_simd_level() {
+        static const SimdLevel level = detect_simd_level();
+        return level;
+    }
+
+} // namespace dfh::utils
+
+#endif // _DFH_UTILS_CPU_FEATURES_HPP_INCLUDED
@@ -14,6 +14,8 @@
 namespace dfh::utils {
 
     /// \brief Appends SIMD-compressed values using a fixed bit width.
+    /// \details Values are packed directly into the tail of `binary_data`, which is grown to
+    /// the worst-case size and then trimmed, so no allocation happens once its capacity suffices.
     /// \param binary_data Output binary buffer to append encoded data.
     /// \param values Pointer to the array of uint32_t values to encode.
     /// \param length Number of values to encode.
@@ -28,8 +30,9 @@ namespace dfh::utils {
         size_t num_blocks = length / SIMDBlockSize;
         size_t shortlength = length % SIMDBlockSize;
 
-        std::vector<uint8_t> buffer(128 * sizeof(uint32_t) * (num_blocks + 1));
-        uint8_t *buffer_ptr = buffer.data();
+        const size_t offset = binary_data.size();
+        binary_data.resize(offset + 128 * sizeof(uint32_t) * (num_blocks + 1));
+        uint8_t *buffer_ptr = binary_data.data() + offset;
 
         for (size_t k = 0; k < num_blocks; ++k) {
             simdpackwithoutmask(values, reinterpret_cast<__m128i*>(buffer_ptr), bit);
@@ -38,15 +41,11 @@ namespace dfh::utils {
         }
 
         if (shortlength > 0) {
-            __m128i* endofbuf = simdpack_shortlength(values, shortlength, reinterpret_cast<__m128i*>(buffer_ptr), bit);
-            buffer_ptr = buffer.data();
-            size_t bytes = (endofbuf - reinterpret_cast<__m128i*>(buffer_ptr)) * sizeof(__m128i);
-            binary_data.insert(binary_data.end(), buffer_ptr, buffer_ptr + bytes);
-            return;
+            buffer_ptr = reinterpret_cast<uint8_t*>(
+                simdpack_shortlength(values, shortlength, reinterpret_cast<__m128i*>(buffer_ptr), bit));
         }
 
-        size_t bytes = (buffer_ptr - buffer.data());
-        binary_data.insert(binary_data.end(), buffer.data(), buffer.data() + bytes);
+        binary_data.resize(buffer_ptr - binary_data.data());
     }
 
     /// \brief Extracts SIMD-compressed values using a fixed bit width.
@@ -90,6 +89,7 @@ namespace dfh::utils {
 //------------------------------------------------------------------------------
 
     /// \brief Appends SIMD-compressed values using dynamically calculated bit width (stored in buffer).
+    /// \details Values are packed directly into the tail of `binary_data` (see the fixed-width overload).
     /// \param binary_data Output buffer to append encoded data.
     /// \param values Pointer to the input array of values to encode.
     /// \param length Number of values to encode.
@@ -102,8 +102,9 @@ namespace dfh::utils {
         size_t num_blocks = length / SIMDBlockSize;
         size_t shortlength = length % SIMDBlockSize;
 
-        std::vector<uint8_t> buffer(128 * sizeof(uint32_t) * (num_blocks + 1) + (num_blocks + 1));
-        uint8_t *buffer_ptr = buffer.data();
+        const size_t offset = binary_data.size();
+        binary_data.resize(offset + 128 * sizeof(uint32_t) * (num_blocks + 1) + (num_blocks + 1));
+        uint8_t *buffer_ptr = binary_data.data() + offset;
 
         uint32_t bit = 0;
         for (size_t k = 0; k < num_blocks; ++k) {
@@ -119,15 +120,11 @@ namespace dfh::utils {
             bit = maxbits_length(values, shortlength);
             *buffer_ptr = static_cast<uint8_t>(bit);
             buffer_ptr++;
-            __m128i* endofbuf = simdpack_shortlength(values, shortlength, reinterpret_cast<__m128i*>(buffer_ptr), bit);
-            buffer_ptr = buffer.data();
-            size_t bytes = (endofbuf - reinterpret_cast<__m128i*>(buffer_ptr)) * sizeof(__m128i);
-            binary_data.insert(binary_data.end(), buffer_ptr, buffer_ptr + bytes);
-            return;
+            buffer_ptr = reinterpret_cast<uint8_t*>(
+                simdpack_shortlength(values, shortlength, reinterpret_cast<__m128i*>(buffer_ptr), bit));
         }
 
-        size_t bytes = (buffer_ptr - buffer.data());
-        binary_data.insert(binary_data.end(), buffer.data(), buffer.data() + bytes);
+        binary_data.resize(buffer_ptr - binary_data.data());
     }
 
     /// \brief Extracts SIMD-compressed values with per-block bit width (bit width read from buffer).
@@ -4,8 +4,12 @@
 
 /// \file sse_double_int64_utils.hpp
 /// \brief src: https://stackoverflow.com/questions/41144668/how-to-efficiently-perform-double-int64-conversions-with-sse-avx
+/// \details The __m256 overloads are compiled with DFH_TARGET_AVX2 and may only be called
+/// when the CPU supports AVX2. AVX-512 DQ converts 64-bit lanes natively (_mm512_cvtepi64_pd).
 
-#include <emmintrin.h>
+#include "cpu_features.hpp"
+
+#if defined(DFH_ARCH_X86)
 
 namespace dfh::utils {
 
@@ -50,6 +54,42 @@ namespace dfh::utils {
         x = _mm_add_epi64(x, _mm_castpd_si128(_mm_set1_pd(0x0018000000000000)));
         return _mm_sub_pd(_mm_castsi128_pd(x), _mm_set1_pd(0x0018000000000000));
     }
+
+    /// \brief Converts a __m256d of doubles to a __m256i of uint64_t.
+    /// \details Only works for inputs in the range [0, 2^52).
+    DFH_TARGET_AVX2 inline __m256i double_to_uint64(__m256d x) {
+        x = _mm256_add_pd(x, _mm256_set1_pd(0x0010000000000000));
+        return _mm256_xor_si256(
+            _mm256_castpd_si256(x),
+            _mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000))
+        );
+    }
+
+    /// \brief Converts a __m256d of doubles to a __m256i of int64_t.
+    /// \details Only works for inputs in the range [-2^51, 2^51].
+    DFH_TARGET_AVX2 inline __m256i double_to_int64(__m256d x) {
+        x = _mm256_add_pd(x, _mm256_set1_pd(0x0018000000000000));
+        return _mm256_sub_epi64(
+            _mm256_castpd_si256(x),
+            _mm256_castpd_si256(_mm256_set1_pd(0x0018000000000000))
+        );
+    }
+
+    /// \brief Converts a __m256i of uint64_t to a __m256d of doubles.
+    /// \details Only works for inputs in the range [0, 2^52).
+    DFH_TARGET_AVX2 inline __m256d uint64_to_double(__m256i x) {
+        x = _mm256_or_si256(x, _mm256_castpd_si256(_mm256_set1_pd(0x0010000000000000)));
+        return _mm256_sub_pd(_mm256_castsi256_pd(x), _mm256_set1_pd(0x0010000000000000));
+    }
+
+    /// \brief Converts a __m256i of int64_t to a __m256d of doubles.
+    /// \details Only works for inputs in the range [-2^51, 2^51].
+    DFH_TARGET_AVX2 inline __m256d int64_to_double(__m256i x) {
+        x = _mm256_add_epi64(x, _mm256_castpd_si256(_mm256_set1_pd(0x0018000000000000)));
+        return _mm256_sub_pd(_mm256_castsi256_pd(x), _mm256_set1_pd(0x0018000000000000));
+    }
 }
 
+#endif // DFH_ARCH_X86
+
 #endif // _DFH_UTILS_SSE_DOUBLE_INT64_UTILS_HPP_INCLUDED
@@ -0,0 +1,287 @@
+/// \file test_bar_compressor.cpp
+/// \brief Round-trip test and size comparison for BarCompressorV1 and the implicit-time raw format.
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cmath>
+#include <DataFeedHub/compression.hpp>
+
+/// \brief Generates S1 bars of one hourly segment.
+/// \param count Number of bars.
+/// \param gap_rate Probability of an empty second (no bar).
+/// \param seed Random seed.
+std::vector<dfh::MarketBar> generate_bars(size_t count, double gap_rate, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    std::vector<dfh::MarketBar> bars;
+    const uint64_t hour = 1700000000000ULL - (1700000000000ULL % 3600000ULL);
+    int64_t price = 3000000; // 30000.00
+    for (size_t slot = 0; slot < 3600 && bars.size() < count; ++slot) {
+        if (uniform(rng) < gap_rate) continue;
+        dfh::MarketBar bar;
+        bar.time_ms = hour + slot * 1000;
+        const int64_t open = price + static_cast<int64_t>(rng() % 3) - 1;
+        const int64_t close = open + static_cast<int64_t>(rng() % 21) - 10;
+        const int64_t high = std::max(open, close) + static_cast<int64_t>(rng() % 4);
+        const int64_t low = std::min(open, close) - static_cast<int64_t>(rng() % 4);
+        bar.open = open / 100.0;
+        bar.high = high / 100.0;
+        bar.low = low / 100.0;
+        bar.close = close / 100.0;
+        bar.volume = static_cast<double>(rng() % 50000) / 1000.0;
+        bar.quote_volume = std::round(bar.volume * bar.close * 100.0) / 100.0;
+        bar.buy_volume = std::round(bar.volume * uniform(rng) * 1000.0) / 1000.0;
+        bar.buy_quote_volume = std::round(bar.buy_volume * bar.close * 100.0) / 100.0;
+        bar.tick_volume = static_cast<uint32_t>(rng() % 200);
+        bar.spread = static_cast<uint32_t>(rng() % 3);
+        bars.push_back(bar);
+        price = close;
+    }
+    return bars;
+}
+
+/// \brief Returns a codec configuration with every field enabled.
+dfh::BarCodecConfig make_config() {
+    dfh::BarCodecConfig config;
+    config.time_frame = dfh::TimeFrame::S1;
+    config.price_digits = 2;
+    config.volume_digits = 3;
+    config.quote_volume_digits = 2;
+    config.tick_size = 0.01;
+    config.expiration_time_ms = 1700000000000ULL + 86400000ULL;
+    config.flags = dfh::BarStorageFlags::LAST_BASED |
+        dfh::BarStorageFlags::ENABLE_VOLUME |
+        dfh::BarStorageFlags::ENABLE_QUOTE_VOLUME |
+        dfh::BarStorageFlags::ENABLE_BUY_VOLUME |
+        dfh::BarStorageFlags::ENABLE_BUY_QUOTE_VOLUME |
+        dfh::BarStorageFlags::ENABLE_TICK_VOLUME |
+        dfh::BarStorageFlags::ENABLE_SPREAD |
+        dfh::BarStorageFlags::SPREAD_MAX;
+    return config;
+}
+
+/// \brief Compares decoded bars with the source bars.
+bool bars_equal(const std::vector<dfh::MarketBar>& a, const std::vector<dfh::MarketBar>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].time_ms != b[i].time_ms ||
+            std::abs(a[i].open - b[i].open) > 1e-9 ||
+            std::abs(a[i].high - b[i].high) > 1e-9 ||
+            std::abs(a[i].low - b[i].low) > 1e-9 ||
+            std::abs(a[i].close - b[i].close) > 1e-9 ||
+            std::abs(a[i].volume - b[i].volume) > 1e-9 ||
+            std::abs(a[i].quote_volume - b[i].quote_volume) > 1e-6 ||
+            std::abs(a[i].buy_volume - b[i].buy_volume) > 1e-9 ||
+            std::abs(a[i].buy_quote_volume - b[i].buy_quote_volume) > 1e-6 ||
+            a[i].tick_volume != b[i].tick_volume ||
+            a[i].spread != b[i].spread) {
+            std::cerr << "Mismatch at i=" << i << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/// \brief Round trip through BarSerializer for the given bars.
+void check_round_trip(const char* name, const std::vector<dfh::MarketBar>& bars, const dfh::BarCodecConfig& config) {
+    dfh::compression::BarSerializer serializer;
+    std::vector<uint8_t> encoded;
+    serializer.serialize(bars, config, encoded);
+    assert(dfh::compression::extract_num_samples(encoded.data(), encoded.size()) == bars.size());
+
+    std::vector<dfh::MarketBar> decoded;
+    dfh::BarCodecConfig decoded_config;
+    serializer.deserialize(encoded, decoded, decoded_config);
+    assert(bars_equal(bars, decoded));
+    assert(decoded_config.flags == config.flags);
+    assert(decoded_config.time_frame == config.time_frame);
+    assert(decoded_config.price_digits == config.price_digits);
+    assert(decoded_config.expiration_time_ms == config.expiration_time_ms);
+
+    auto raw_config = config;
+    raw_config.set_flag(dfh::BarStorageFlags::STORE_RAW_BINARY);
+    std::vector<uint8_t> raw;
+    serializer.serialize(bars, raw_config, raw);
+
+    // In-place decoding from unaligned memory, as for values read from a database page.
+    for (const auto* segment : {&encoded, &raw}) {
+        std::vector<uint8_t> page(segment->size() + 1);
+        std::copy(segment->begin(), segment->end(), page.begin() + 1);
+        decoded.clear();
+        serializer.deserialize(page.data() + 1, segment->size(), decoded, decoded_config);
+        assert(bars_equal(bars, decoded));
+    }
+    std::cout << "  => " << name << ": OK, " << bars.size() << " bars, "
+              << raw.size() << " -> " << encoded.size() << " bytes before ZSTD\n";
+}
+
+/// \brief Tests every time mode and optional column combination.
+void test_round_trips() {
+    std::cout << "[Test BarCompressorV1]\n";
+    const auto config = make_config();
+    check_round_trip("dense", generate_bars(3600, 0.0, 1), config);
+    check_round_trip("gaps", generate_bars(3600, 0.3, 2), config);
+    check_round_trip("single bar", generate_bars(1, 0.0, 3), config);
+
+    // Bars off the grid fall back to explicit timestamps.
+    auto shifted = generate_bars(500, 0.1, 4);
+    for (auto& bar : shifted) bar.time_ms += 17;
+    check_round_trip("off grid", shifted, config);
+
+    // Only OHLC.
+    auto ohlc_config = config;
+    ohlc_config.flags = dfh::BarStorageFlags::LAST_BASED;
+    auto ohlc = generate_bars(3600, 0.05, 5);
+    for (auto& bar : ohlc) {
+        bar.volume = bar.quote_volume = bar.buy_volume = bar.buy_quote_volume = 0.0;
+        bar.tick_volume = bar.spread = 0;
+    }
+    check_round_trip("ohlc only", ohlc, ohlc_config);
+
+    // Decoding a reduced segment into a vector that held a full one leaves no stale fields.
+    {
+        dfh::compression::BarSerializer serializer;
+        std::vector<uint8_t> full, reduced;
+        serializer.serialize(generate_bars(3600, 0.0, 1), config, full);
+        serializer.serialize(ohlc, ohlc_config, reduced);
+        std::vector<dfh::MarketBar> decoded;
+        dfh::BarCodecConfig decoded_config;
+        serializer.deserialize(full, decoded, decoded_config);
+        serializer.deserialize(reduced, decoded, decoded_config);
+        assert(bars_equal(ohlc, decoded));
+        std::cout << "  => reused output vector: OK\n";
+    }
+
+    // D1 bars in a weekly segment.
+    auto daily_config = config;
+    daily_config.time_frame = dfh::TimeFrame::D1;
+    auto daily = generate_bars(5, 0.0, 6);
+    const uint64_t week = (daily[0].time_ms / 604800000ULL) * 604800000ULL;
+    const uint64_t days[] = {0, 1, 2, 4, 6};
+    for (size_t i = 0; i < daily.size(); ++i) daily[i].time_ms = week + days[i] * 86400000ULL;
+    check_round_trip("D1 with gaps", daily, daily_config);
+
+    bool caught = false;
+    auto negative = generate_bars(10, 0.0, 7);
+    negative[3].volume = -1.0;
+    try {
+        dfh::compression::BarCompressorV1 compressor;
+        std::vector<uint8_t> output;
+        compressor.serialize(negative, config, output);
+    } catch (const std::invalid_argument&) {
+        caught = true;
+    }
+    assert(caught);
+    std::cout << "[Test BarCompressorV1] Passed\n\n";
+}
+
+/// \brief Tests the IMPLICIT_TIME mode of the raw binary format.
+void test_implicit_time() {
+    std::cout << "[Test BarBinarySerializerV1 implicit time]\n";
+    auto config = make_config();
+    config.set_flag(dfh::BarStorageFlags::STORE_RAW_BINARY);
+    auto explicit_config = config;
+    config.set_flag(dfh::BarStorageFlags::IMPLICIT_TIME);
+
+    dfh::compression::BarBinarySerializerV1 serializer;
+    for (double gap_rate : {0.0, 0.3, 0.97}) {
+        const auto bars = generate_bars(3600, gap_rate, 10);
+        std::vector<uint8_t> encoded, plain;
+        serializer.serialize(bars, config, encoded);
+        serializer.serialize(bars, explicit_config, plain);
+
+        std::vector<dfh::MarketBar> decoded;
+        dfh::BarCodecConfig decoded_config;
+        serializer.deserialize(encoded, decoded, decoded_config);
+        assert(bars_equal(bars, decoded));
+        assert(decoded_config.flags == config.flags);
+        assert(encoded.size() + bars.size() * sizeof(uint64_t) == plain.size() + 450);
+        std::cout << "  => " << bars.size() << " bars: " << plain.size() << " -> " << encoded.size() << " bytes\n";
+    }
+
+    // Bars off the grid keep explicit timestamps and drop the flag.
+    auto shifted = generate_bars(100, 0.0, 11);
+    shifted[50].time_ms += 1;
+    std::vector<uint8_t> encoded;
+    std::vector<dfh::MarketBar> decoded;
+    dfh::BarCodecConfig decoded_config;
+    serializer.serialize(shifted, config, encoded);
+    serializer.deserialize(encoded, decoded, decoded_config);
+    assert(bars_equal(shifted, decoded));
+    assert(!decoded_config.has_flag(dfh::BarStorageFlags::IMPLICIT_TIME));
+    std::cout << "[Test BarBinarySerializerV1 implicit time] Passed\n\n";
+}
+
+/// \brief Checks every available bitmap expansion kernel against the scalar kernel.
+void test_expand_kernels() {
+    using namespace dfh::compression;
+    using ExpandKernel = void (*)(const uint64_t*, size_t, uint64_t, uint64_t, uint64_t*, size_t);
+    std::vector<std::pair<const char*, ExpandKernel>> kernels;
+#   if defined(DFH_ARCH_X86)
+    const auto& features = dfh::utils::cpu_features();
+    if (features.avx2) kernels.emplace_back("AVX2", expand_time_bitmap_avx2);
+    if (features.avx512f && features.avx512dq) kernels.emplace_back("AVX-512", expand_time_bitmap_avx512);
+#   endif
+    std::mt19937_64 rng(12);
+    for (const auto& kernel : kernels) {
+        for (size_t num_slots : {7, 64, 100, 3600}) {
+            for (int density : {0, 1, 50, 100}) {
+                dfh::utils::DynamicBitset bitmap;
+                bitmap.resize(num_slots);
+                for (size_t i = 0; i < num_slots; ++i) {
+                    if (static_cast<int>(rng() % 100) < density) bitmap.set(i, true);
+                }
+                const size_t count = bitmap.count();
+                std::vector<uint64_t> expected(count), actual(count);
+                expand_time_bitmap_scalar(bitmap.data(), bitmap.num_blocks(), 1700000000000ULL, 1000, expected.data(), sizeof(uint64_t));
+                kernel.second(bitmap.data(), bitmap.num_blocks(), 1700000000000ULL, 1000, actual.data(), sizeof(uint64_t));
+                assert(expected == actual);
+
+                std::vector<dfh::MarketBar> bars(count + 1);
+                bars[count].time_ms = 42;
+                kernel.second(bitmap.data(), bitmap.num_blocks(), 1700000000000ULL, 1000, &bars[0].time_ms, sizeof(dfh::MarketBar));
+                for (size_t i = 0; i < count; ++i) assert(bars[i].time_ms == expected[i] && bars[i].open == 0.0);
+                assert(bars[count].time_ms == 42);
+            }
+        }
+        std::cout << "[Test expand_time_bitmap " << kernel.first << "] Passed\n";
+    }
+    std::cout << "\n";
+}
+
+/// \brief Measures encode and decode throughput of one hour of S1 bars.
+void benchmark_bar_compressor() {
+    const auto bars = generate_bars(3600, 0.2, 8);
+    const auto config = make_config();
+    dfh::compression::BarCompressorV1 compressor;
+    std::vector<uint8_t> encoded;
+    std::vector<dfh::MarketBar> decoded;
+    const size_t iterations = 200;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        compressor.serialize(bars, config, encoded);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        compressor.deserialize(encoded, decoded);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    const double total = static_cast<double>(bars.size() * iterations);
+    std::cout << "[Benchmark BarCompressorV1] bars = " << bars.size() << "\n"
+              << "  encode: " << total / std::chrono::duration<double>(mid - start).count() / 1e6 << " M bars/sec\n"
+              << "  decode: " << total / std::chrono::duration<double>(end - mid).count() / 1e6 << " M bars/sec\n";
+}
+
+int main() {
+    test_round_trips();
+    test_implicit_time();
+    test_expand_kernels();
+    benchmark_bar_compressor();
+    std::cout << "All tests passed successfully!\n";
+    return 0;
+}
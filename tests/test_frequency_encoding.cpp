@@ -5,6 +5,7 @@
 #include <vector>
 #include <random>
 #include <cassert>
+#include <chrono>
 #include <DataFeedHub/compression.hpp>
 
 /// \brief Generates a random array of uint32_t.
@@ -108,6 +109,134 @@ void test_frequency_encoding(size_t size) {
     std::cout << "[Test Frequency Encoding] Passed\n\n";
 }
 
+/// \brief Checks that FrequencyEncoder output is identical to the generic encode_frequency().
+/// \param input_values Values to encode.
+/// \param encoder Reused encoder instance.
+template <typename T>
+void check_frequency_encoder(const std::vector<T>& input_values, dfh::compression::FrequencyEncoder<T>& encoder) {
+    const size_t size = input_values.size();
+    std::vector<uint32_t> expected_codes(size), codes(size);
+    std::vector<T> expected_values, values;
+    std::vector<uint32_t> expected_index_map, index_map;
+    dfh::compression::encode_frequency(input_values.data(), expected_codes.data(), size, expected_values, expected_index_map);
+    dfh::compression::encode_frequency(input_values.data(), codes.data(), size, values, index_map, encoder);
+    assert(arrays_equal(expected_codes, codes));
+    assert(arrays_equal(expected_values, values));
+    assert(arrays_equal(expected_index_map, index_map));
+}
+
+/// \brief Test routine for FrequencyEncoder: output must match the generic encoder byte for byte.
+void test_frequency_encoder() {
+    std::cout << "[Test FrequencyEncoder]\n";
+    std::mt19937_64 rng(777ULL);
+    dfh::compression::FrequencyEncoder<uint32_t> encoder_u32;
+    dfh::compression::FrequencyEncoder<uint64_t> encoder_u64;
+    const size_t sizes[] = {0, 1, 10, 1000, 100000};
+    for (size_t size : sizes) {
+        for (uint64_t range : {3ULL, 50ULL, 5000ULL, 1ULL << 40}) {
+            std::vector<uint32_t> values_u32(size);
+            std::vector<uint64_t> values_u64(size);
+            std::geometric_distribution<uint64_t> skewed(0.2);
+            for (size_t i = 0; i < size; ++i) {
+                values_u64[i] = (rng() & 1) ? skewed(rng) % range : rng() % range;
+                values_u32[i] = static_cast<uint32_t>(values_u64[i]);
+            }
+            check_frequency_encoder(values_u32, encoder_u32);
+            check_frequency_encoder(values_u64, encoder_u64);
+        }
+    }
+
+    // In-place encoding, as done by TickEncoderV1
+    auto input_values = generate_random_uint32_array(1000, 1, 100);
+    std::vector<uint32_t> expected_codes(input_values.size());
+    std::vector<uint32_t> values, index_map;
+    dfh::compression::encode_frequency(input_values.data(), expected_codes.data(), input_values.size(), values, index_map);
+    dfh::compression::encode_frequency(input_values.data(), input_values.data(), input_values.size(), values, index_map, encoder_u32);
+    assert(arrays_equal(expected_codes, input_values));
+    std::cout << "[Test FrequencyEncoder] Passed\n\n";
+}
+
+/// \brief Compares a gather kernel variant with the scalar kernel for all code and value widths.
+template<class U64U64, class U32U64, class U32U32>
+void check_gather_variant(const char* name, U64U64 gather_u64_u64, U32U64 gather_u32_u64, U32U32 gather_u32_u32) {
+    using namespace dfh::compression;
+    for (size_t size : {0, 1, 7, 8, 15, 16, 17, 1001}) {
+        const uint32_t table_size = 3000;
+        std::vector<uint32_t> codes32 = generate_random_uint32_array(size, 0, table_size - 1);
+        std::vector<uint64_t> codes64(codes32.begin(), codes32.end());
+        std::vector<uint32_t> table32(table_size);
+        std::vector<uint64_t> table64(table_size);
+        for (uint32_t i = 0; i < table_size; ++i) {
+            table32[i] = i * 2654435761u;
+            table64[i] = (static_cast<uint64_t>(i) << 40) | table32[i];
+        }
+
+        std::vector<uint64_t> expected64(size), actual64(size);
+        gather_frequency_scalar(codes64.data(), expected64.data(), size, table64.data());
+        gather_u64_u64(codes64.data(), actual64.data(), size, table64.data());
+        assert(arrays_equal(expected64, actual64));
+
+        std::fill(actual64.begin(), actual64.end(), 0);
+        gather_u32_u64(codes32.data(), actual64.data(), size, table64.data());
+        assert(arrays_equal(expected64, actual64));
+
+        std::vector<uint32_t> expected32(size);
+        gather_frequency_scalar(codes32.data(), expected32.data(), size, table32.data());
+        gather_u32_u32(codes32.data(), codes32.data(), size, table32.data()); // in place
+        assert(arrays_equal(expected32, codes32));
+    }
+    std::cout << "  => gather " << name << ": OK\n";
+}
+
+/// \brief Checks every gather variant supported by the CPU.
+void test_gather_variants() {
+    using namespace dfh::compression;
+    std::cout << "[Test frequency gather kernels] active: "
+              << dfh::utils::to_str(frequency_decode_kernels().level) << "\n";
+    using U64U64 = void (*)(const uint64_t*, uint64_t*, size_t, const uint64_t*);
+    using U32U64 = void (*)(const uint32_t*, uint64_t*, size_t, const uint64_t*);
+    using U32U32 = void (*)(const uint32_t*, uint32_t*, size_t, const uint32_t*);
+    check_gather_variant("scalar",
+        static_cast<U64U64>(gather_frequency_scalar), static_cast<U32U64>(gather_frequency_scalar), static_cast<U32U32>(gather_frequency_scalar));
+#   if defined(DFH_ARCH_X86)
+    const auto& cpu = dfh::utils::cpu_features();
+    if (cpu.avx2) {
+        check_gather_variant("avx2",
+            static_cast<U64U64>(gather_frequency_avx2), static_cast<U32U64>(gather_frequency_avx2), static_cast<U32U32>(gather_frequency_avx2));
+    }
+    if (cpu.avx512f && cpu.avx512dq) {
+        check_gather_variant("avx512",
+            static_cast<U64U64>(gather_frequency_avx512), static_cast<U32U64>(gather_frequency_avx512), static_cast<U32U32>(gather_frequency_avx512));
+    }
+#   endif
+    std::cout << "\n";
+}
+
+/// \brief Compares throughput of the generic encode_frequency() and FrequencyEncoder.
+/// \param size Number of values per call (roughly one hourly segment).
+/// \param range Number of distinct values.
+void benchmark_frequency_encoding(size_t size, uint32_t range) {
+    auto input_values = generate_random_uint32_array(size, 0, range - 1);
+    std::vector<uint32_t> codes(size), values, index_map;
+    dfh::compression::FrequencyEncoder<uint32_t> encoder;
+    const size_t iterations = std::max<size_t>(1, 10000000 / size);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        dfh::compression::encode_frequency(input_values.data(), codes.data(), size, values, index_map);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        dfh::compression::encode_frequency(input_values.data(), codes.data(), size, values, index_map, encoder);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    const double total = static_cast<double>(size * iterations);
+    std::cout << "[Benchmark encode_frequency] size = " << size << ", distinct = " << range << "\n"
+              << "  std::map + unordered_map: " << total / std::chrono::duration<double>(mid - start).count() / 1e6 << " M values/sec\n"
+              << "  FrequencyEncoder        : " << total / std::chrono::duration<double>(end - mid).count() / 1e6 << " M values/sec\n";
+}
+
 /// \brief Entry point: run all tests with various sizes.
 int main() {
     // Test frequency encoding/decoding with various sizes
@@ -116,6 +245,11 @@ int main() {
     test_frequency_encoding(50);    // Средний размер
     test_frequency_encoding(1000);  // Большой массив
 
+    test_frequency_encoder();
+    test_gather_variants();
+    benchmark_frequency_encoding(100000, 64);
+    benchmark_frequency_encoding(100000, 20000);
+
     std::cout << "All tests passed successfully!\n";
     return 0;
 }
@@ -0,0 +1,168 @@
+/// \file test_prefix_sum.cpp
+/// \brief Checks that the SIMD prefix-sum decode kernels match the scalar kernels bit for bit
+/// and measures their throughput.
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cstring>
+#include <DataFeedHub/compression.hpp>
+
+using TimeKernel = void (*)(const uint32_t*, uint64_t*, size_t, size_t, int64_t);
+using PriceKernel = void (*)(const uint32_t*, double*, size_t, size_t, double, int64_t);
+using ScaledPriceKernel = void (*)(const uint32_t*, int64_t*, size_t, size_t, int64_t);
+
+/// \brief Generates Zig-Zag encoded price deltas and unsigned time deltas.
+void generate_deltas(size_t size, uint64_t seed, std::vector<uint32_t>& price_deltas, std::vector<uint32_t>& time_deltas) {
+    std::mt19937_64 rng(seed);
+    price_deltas.resize(size);
+    time_deltas.resize(size);
+    for (size_t i = 0; i < size; ++i) {
+        const int32_t delta = static_cast<int32_t>(rng() % 21) - 10;
+        price_deltas[i] = (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31);
+        time_deltas[i] = static_cast<uint32_t>(rng() % 50);
+    }
+    if (size > 3) {
+        price_deltas[size / 3] = 0xFFFFFFFFu; // INT32_MIN
+        time_deltas[size / 3] = 0xFFFFFFFFu;
+    }
+}
+
+/// \brief Compares a kernel variant with the scalar kernels, for contiguous and strided output.
+void check_variant(const char* name, TimeKernel decode_time, PriceKernel decode_price, ScaledPriceKernel decode_scaled_price) {
+    using namespace dfh::compression;
+    for (size_t size : {0, 1, 3, 4, 7, 8, 9, 17, 1000, 4099}) {
+        std::vector<uint32_t> price_deltas, time_deltas;
+        generate_deltas(size, 42 + size, price_deltas, time_deltas);
+        // Initial prices near 2^51 push some lanes out of the exact AVX2 conversion range.
+        for (int64_t initial : {int64_t(0), int64_t(1700000000000LL), int64_t(-5), (int64_t(1) << 51) - 20}) {
+            std::vector<uint64_t> expected_time(size), actual_time(size);
+            decode_time_delta_scalar(time_deltas.data(), expected_time.data(), sizeof(uint64_t), size, initial);
+            decode_time(time_deltas.data(), actual_time.data(), sizeof(uint64_t), size, initial);
+            assert(expected_time == actual_time);
+
+            std::vector<double> expected_price(size), actual_price(size);
+            decode_last_delta_zig_zag_int32_scalar(price_deltas.data(), expected_price.data(), sizeof(double), size, 0.01, initial);
+            decode_price(price_deltas.data(), actual_price.data(), sizeof(double), size, 0.01, initial);
+            assert(size == 0 || std::memcmp(expected_price.data(), actual_price.data(), size * sizeof(double)) == 0);
+
+            std::vector<int64_t> expected_scaled(size), actual_scaled(size);
+            decode_scaled_last_delta_zig_zag_int32_scalar(price_deltas.data(), expected_scaled.data(), sizeof(int64_t), size, initial);
+            decode_scaled_price(price_deltas.data(), actual_scaled.data(), sizeof(int64_t), size, initial);
+            assert(expected_scaled == actual_scaled);
+            for (size_t i = 0; i < size; ++i) {
+                assert(static_cast<double>(expected_scaled[i]) * 0.01 == expected_price[i]);
+            }
+
+            std::vector<dfh::MarketTick> ticks(size);
+            if (size == 0) continue;
+            decode_time(time_deltas.data(), &ticks[0].time_ms, sizeof(dfh::MarketTick), size, initial);
+            decode_price(price_deltas.data(), &ticks[0].last, sizeof(dfh::MarketTick), size, 0.01, initial);
+            for (size_t i = 0; i < size; ++i) {
+                assert(ticks[i].time_ms == expected_time[i]);
+                assert(std::memcmp(&ticks[i].last, &expected_price[i], sizeof(double)) == 0);
+                assert(ticks[i].bid == 0.0 && ticks[i].volume == 0.0);
+            }
+        }
+    }
+    std::cout << "  => " << name << ": OK\n";
+}
+
+/// \brief Reference decoder of price and time deltas (the original serial loops).
+void decode_reference(const uint32_t* price_deltas, const uint32_t* time_deltas, dfh::MarketTick* ticks, size_t size,
+                      double price_scale, int64_t initial_price, int64_t initial_time) {
+    const double inv_price_scale = 1.0 / price_scale;
+    for (size_t i = 0; i < size; ++i) {
+        const int32_t delta = (price_deltas[i] >> 1) ^ -(price_deltas[i] & 1);
+        initial_price += delta;
+        ticks[i].last = static_cast<double>(initial_price) * inv_price_scale;
+    }
+    uint64_t time_ms = static_cast<uint64_t>(initial_time);
+    for (size_t i = 0; i < size; ++i) {
+        time_ms += time_deltas[i];
+        ticks[i].time_ms = time_ms;
+    }
+}
+
+/// \brief Compares the dispatched tick decoders with the reference decoder.
+void test_tick_decoders(size_t size) {
+    std::vector<uint32_t> price_deltas, time_deltas;
+    generate_deltas(size, 7, price_deltas, time_deltas);
+    std::vector<dfh::MarketTick> expected(size), actual(size);
+
+    const double price_scale = 100.0;
+    const int64_t initial_price = 3000000;
+    const int64_t initial_time = 1700000000000LL;
+    decode_reference(price_deltas.data(), time_deltas.data(), expected.data(), size, price_scale, initial_price, initial_time);
+    dfh::compression::decode_last_delta_zig_zag_int32(price_deltas.data(), actual.data(), size, price_scale, initial_price);
+    dfh::compression::decode_time_delta(time_deltas.data(), actual.data(), size, initial_time);
+    for (size_t i = 0; i < size; ++i) {
+        assert(expected[i].time_ms == actual[i].time_ms);
+        assert(std::memcmp(&expected[i].last, &actual[i].last, sizeof(double)) == 0);
+    }
+    std::cout << "  => tick decoders, size = " << size << ": OK\n";
+}
+
+/// \brief Measures decoding throughput into MarketTick (AoS) and into contiguous columns (SoA).
+void benchmark_decode(size_t size) {
+    std::vector<uint32_t> price_deltas, time_deltas;
+    generate_deltas(size, 11, price_deltas, time_deltas);
+    std::vector<dfh::MarketTick> ticks(size);
+    std::vector<uint64_t> time_column(size);
+    std::vector<double> price_column(size);
+    const size_t iterations = 200;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        decode_reference(price_deltas.data(), time_deltas.data(), ticks.data(), size, 100.0, 3000000, 1700000000000LL);
+    }
+    auto t1 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        dfh::compression::decode_last_delta_zig_zag_int32(price_deltas.data(), ticks.data(), size, 100.0, 3000000);
+        dfh::compression::decode_time_delta(time_deltas.data(), ticks.data(), size, 1700000000000LL);
+    }
+    auto t2 = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        dfh::compression::decode_last_delta_zig_zag_int32(price_deltas.data(), price_column.data(), size, 100.0, 3000000);
+        dfh::compression::decode_time_delta(time_deltas.data(), time_column.data(), size, 1700000000000LL);
+    }
+    auto t3 = std::chrono::high_resolution_clock::now();
+
+    const double total = static_cast<double>(size * iterations);
+    auto rate = [total](auto a, auto b) { return total / std::chrono::duration<double>(b - a).count() / 1e6; };
+    std::cout << "[Benchmark price + time decode] size = " << size << "\n"
+              << "  scalar, MarketTick    : " << rate(start, t1) << " M ticks/sec\n"
+              << "  dispatched, MarketTick: " << rate(t1, t2) << " M ticks/sec\n"
+              << "  dispatched, columns   : " << rate(t2, t3) << " M ticks/sec\n";
+}
+
+int main() {
+    using namespace dfh::compression;
+    std::cout << "[Test prefix-sum kernels] active: " << dfh::utils::to_str(prefix_sum_kernels().level) << "\n";
+    check_variant("scalar", decode_time_delta_scalar, decode_last_delta_zig_zag_int32_scalar,
+                      decode_scaled_last_delta_zig_zag_int32_scalar);
+#   if defined(DFH_ARCH_X86)
+    const auto& cpu = dfh::utils::cpu_features();
+    if (cpu.sse41) {
+        check_variant("sse4.1", decode_time_delta_sse41, decode_last_delta_zig_zag_int32_sse41,
+                          decode_scaled_last_delta_zig_zag_int32_sse41);
+    }
+    if (cpu.avx2) {
+        check_variant("avx2", decode_time_delta_avx2, decode_last_delta_zig_zag_int32_avx2,
+                          decode_scaled_last_delta_zig_zag_int32_avx2);
+    }
+    if (cpu.avx512f && cpu.avx512dq) {
+        check_variant("avx512", decode_time_delta_avx512, decode_last_delta_zig_zag_int32_avx512,
+                          decode_scaled_last_delta_zig_zag_int32_avx512);
+    }
+#   endif
+    test_tick_decoders(1);
+    test_tick_decoders(500001);
+
+    benchmark_decode(500000);
+
+    std::cout << "All tests passed successfully!\n";
+    return 0;
+}
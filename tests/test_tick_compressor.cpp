@@ -0,0 +1,1289 @@
+/// \file test_tick_compressor.cpp
+/// \brief Round-trip test and throughput benchmark for TickCompressorV1.
+
+#include <iostream>
+#include <vector>
+#include <random>
+#include <chrono>
+#include <cassert>
+#include <cmath>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <DataFeedHub/compression.hpp>
+
+/// \brief Number of heap allocations of the process (see test_decode_into()).
+static std::atomic<size_t> g_num_allocations{0};
+
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_THREAD__)
+#define DFH_SANITIZED_BUILD 1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(thread_sanitizer)
+#define DFH_SANITIZED_BUILD 1
+#endif
+#endif
+
+#if defined(__GLIBC__) && !defined(DFH_SANITIZED_BUILD)
+// The C allocation functions are wrapped rather than operator new, so the count also covers
+// aligned_allocator (aligned_alloc) and the internal allocations of ZSTD (malloc).
+// Sanitizers replace the allocator themselves and are left alone.
+#define DFH_COUNT_ALLOCATIONS 1
+
+extern "C" {
+    void* __libc_malloc(size_t size);
+    void* __libc_calloc(size_t count, size_t size);
+    void* __libc_realloc(void* ptr, size_t size);
+    void* __libc_memalign(size_t alignment, size_t size);
+
+    void* malloc(size_t size) {
+        ++g_num_allocations;
+        return __libc_malloc(size);
+    }
+
+    void* calloc(size_t count, size_t size) {
+        ++g_num_allocations;
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, size_t size) {
+        ++g_num_allocations;
+        return __libc_realloc(ptr, size);
+    }
+
+    void* aligned_alloc(size_t alignment, size_t size) {
+        ++g_num_allocations;
+        return __libc_memalign(alignment, size);
+    }
+}
+#else
+#define DFH_COUNT_ALLOCATIONS 0
+#endif
+
+/// \brief Generates one hour of synthetic trade ticks.
+/// \param size Number of ticks to generate.
+/// \param seed Random seed.
+/// \return Vector of trade ticks with price, volume and side set.
+std::vector<dfh::MarketTick> generate_trade_ticks(size_t size, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<dfh::MarketTick> ticks(size);
+    uint64_t time_ms = 1700000000000ULL - (1700000000000ULL % 3600000ULL);
+    int64_t price = 300000; // 30000.0 with tick 0.1
+    const uint64_t step = std::max<uint64_t>(1, 3600000ULL / (size + 1));
+    for (size_t i = 0; i < size; ++i) {
+        auto& tick = ticks[i];
+        time_ms += rng() % step;
+        price += static_cast<int64_t>(rng() % 5) - 2;
+        tick.time_ms = time_ms;
+        tick.last = static_cast<double>(price) / 10.0;
+        tick.volume = static_cast<double>(rng() % 5000 + 1) / 1000.0;
+        tick.flags = (rng() & 1) ? dfh::TickUpdateFlags::TICK_FROM_BUY : dfh::TickUpdateFlags::TICK_FROM_SELL;
+        tick.flags |= dfh::TickUpdateFlags::VOLUME_UPDATED;
+    }
+    ticks[0].flags |= dfh::TickUpdateFlags::LAST_UPDATED;
+    return ticks;
+}
+
+/// \brief Generates one hour of trades shaped like an exchange trade dump.
+/// \details Orders arrive in bursts; a taker order is filled against several makers with the
+/// same timestamp and side, walking the price by at most one tick, and most sizes are
+/// common lot sizes. Such repetition is what the higher ZSTD levels pick up.
+/// \param size Number of ticks to generate.
+/// \param seed Random seed.
+/// \return Vector of trade ticks with price, volume and side set.
+std::vector<dfh::MarketTick> generate_trade_dump_ticks(size_t size, uint64_t seed) {
+    static const int64_t lots[] = {1, 2, 3, 5, 10, 20, 50, 100, 250, 500, 1000, 2000}; // in 0.001
+    std::mt19937_64 rng(seed);
+    std::vector<dfh::MarketTick> ticks;
+    ticks.reserve(size);
+    const uint64_t hour_ms = 1700000000000ULL - (1700000000000ULL % 3600000ULL);
+    const uint64_t mean_gap = std::max<uint64_t>(1, 3600000ULL / (size + 1));
+    uint64_t time_ms = hour_ms;
+    int64_t price = 300000; // 30000.0 with tick 0.1
+    bool buy = true;
+    while (ticks.size() < size) {
+        time_ms += (rng() % 4 == 0) ? rng() % (4 * mean_gap) : rng() % 3;
+        time_ms = std::min<uint64_t>(time_ms, hour_ms + 3599999ULL);
+        if (rng() % 3 == 0) buy = !buy;
+        price += static_cast<int64_t>(rng() % 3) - 1;
+        const size_t fills = 1 + (rng() % 4 == 0 ? rng() % 12 : 0);
+        for (size_t i = 0; i < fills && ticks.size() < size; ++i) {
+            if (i && rng() % 3 == 0) price += buy ? 1 : -1;
+            const int64_t lot = (rng() % 5) ? lots[rng() % (sizeof(lots) / sizeof(lots[0]))] : static_cast<int64_t>(rng() % 5000 + 1);
+            dfh::MarketTick tick{};
+            tick.time_ms = time_ms;
+            tick.last = static_cast<double>(price) / 10.0;
+            tick.volume = static_cast<double>(lot) / 1000.0;
+            tick.flags = buy ? dfh::TickUpdateFlags::TICK_FROM_BUY : dfh::TickUpdateFlags::TICK_FROM_SELL;
+            tick.flags |= dfh::TickUpdateFlags::VOLUME_UPDATED;
+            ticks.push_back(tick);
+        }
+    }
+    ticks[0].flags |= dfh::TickUpdateFlags::LAST_UPDATED;
+    return ticks;
+}
+
+/// \brief Returns codec configuration matching generate_trade_ticks().
+dfh::TickCodecConfig make_trade_config() {
+    dfh::TickCodecConfig config{};
+    config.tick_size = 0.1;
+    config.price_digits = 1;
+    config.volume_digits = 3;
+    config.set_flag(dfh::TickStorageFlags::TRADE_BASED);
+    config.set_flag(dfh::TickStorageFlags::ENABLE_TICK_FLAGS);
+    config.set_flag(dfh::TickStorageFlags::ENABLE_VOLUME);
+    return config;
+}
+
+/// \brief Compares decoded ticks with the source ticks.
+bool ticks_equal(const std::vector<dfh::MarketTick>& a, const std::vector<dfh::MarketTick>& b) {
+    if (a.size() != b.size()) return false;
+    for (size_t i = 0; i < a.size(); ++i) {
+        if (a[i].time_ms != b[i].time_ms ||
+            std::abs(a[i].last - b[i].last) > 1e-9 ||
+            std::abs(a[i].volume - b[i].volume) > 1e-9 ||
+            a[i].flags != b[i].flags) {
+            std::cerr << "Mismatch at i=" << i << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+/// \brief Round-trip test for TickCompressorV1.
+void test_round_trip(size_t size) {
+    std::cout << "[Test TickCompressorV1 round trip] size = " << size << "\n";
+    auto ticks = generate_trade_ticks(size, 12345ULL + size);
+    dfh::compression::TickCompressorV1 compressor;
+    std::vector<uint8_t> encoded;
+    compressor.serialize(ticks, make_trade_config(), encoded);
+
+    std::vector<dfh::MarketTick> decoded;
+    dfh::TickCodecConfig config;
+    compressor.deserialize(encoded, decoded, config);
+    assert(ticks_equal(ticks, decoded));
+    std::cout << "  => OK, " << encoded.size() << " bytes\n";
+}
+
+/// \brief Measures segments/sec of whole-segment encode and decode with a new compressor per
+/// segment (fresh ZSTD contexts and scratch) against one reused compressor (ZstdCodecContext kept),
+/// then of the ZSTD stage alone with per-call contexts and raw dictionary against reused ones.
+void benchmark_zstd_contexts(size_t size, size_t segments) {
+    std::cout << "[Benchmark ZSTD contexts] ticks per segment = " << size << ", segments = " << segments << "\n";
+    using namespace dfh::compression;
+    const auto config = make_trade_config();
+
+    // Distinct segments, so consecutive calls do not compress the same input.
+    std::vector<std::vector<dfh::MarketTick>> sources(8);
+    std::vector<std::vector<uint8_t>> encoded(sources.size());
+    TickCompressorV1 reused;
+    for (size_t i = 0; i < sources.size(); ++i) {
+        sources[i] = generate_trade_dump_ticks(size, 777ULL + i);
+        reused.serialize(sources[i], config, encoded[i]);
+    }
+
+    auto run = [&](const char* name, auto&& fn) {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < segments; ++i) fn(i % sources.size());
+        const double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << "  " << name << ": " << (sec > 0.0 ? segments / sec : 0.0) << " segments/sec\n";
+    };
+
+    std::vector<uint8_t> output;
+    std::vector<dfh::MarketTick> decoded;
+    decoded.reserve(size);
+    run("encode, new compressor per segment", [&](size_t i) {
+        TickCompressorV1 compressor;
+        output.clear();
+        compressor.serialize(sources[i], config, output);
+        assert(output == encoded[i]);
+    });
+
+    run("encode, reused compressor        ", [&](size_t i) {
+        output.clear();
+        reused.serialize(sources[i], config, output);
+        assert(output == encoded[i]);
+    });
+
+    run("decode, new compressor per segment", [&](size_t i) {
+        TickCompressorV1 compressor;
+        decoded.clear();
+        compressor.deserialize(encoded[i], decoded);
+        assert(decoded.size() == size);
+    });
+
+    run("decode, reused compressor        ", [&](size_t i) {
+        decoded.clear();
+        reused.deserialize(encoded[i], decoded);
+        assert(decoded.size() == size);
+    });
+
+    // ZSTD stage alone: per-call contexts with the raw dictionary (digested on every call)
+    // against reused contexts with the pre-digested dictionary.
+    std::vector<std::vector<uint8_t>> inner(sources.size());
+    std::vector<size_t> frame_offsets(sources.size());
+    for (size_t i = 0; i < sources.size(); ++i) {
+        size_t offset = 1;
+        dfh::utils::extract_vbyte<uint32_t>(encoded[i].data(), offset);
+        frame_offsets[i] = offset;
+        decompress_zstd_data(
+            encoded[i].data() + offset, encoded[i].size() - offset,
+            zstd_dict_tick_compressor_v1_102400, sizeof(zstd_dict_tick_compressor_v1_102400), inner[i]);
+    }
+
+    run("zstd decode, per-call DCtx + raw dict", [&](size_t i) {
+        decompress_zstd_data(
+            encoded[i].data() + frame_offsets[i], encoded[i].size() - frame_offsets[i],
+            zstd_dict_tick_compressor_v1_102400, sizeof(zstd_dict_tick_compressor_v1_102400), output);
+    });
+
+    ZstdCodecContext context;
+    const ZstdDictionary& dictionary = zstd_dictionary_tick_compressor_v1();
+    run("zstd decode, reused DCtx + DDict   ", [&](size_t i) {
+        decompress_zstd_data(
+            context.dctx(), dictionary.ddict(),
+            encoded[i].data() + frame_offsets[i], encoded[i].size() - frame_offsets[i], output);
+    });
+
+    const int level = zstd_compression_level(config.compression_profile);
+    run("zstd encode, per-call CCtx + raw dict", [&](size_t i) {
+        output.clear();
+        compress_zstd_data(
+            inner[i].data(), inner[i].size(),
+            zstd_dict_tick_compressor_v1_102400, sizeof(zstd_dict_tick_compressor_v1_102400),
+            0x01, static_cast<uint32_t>(size), output, level);
+    });
+
+    run("zstd encode, reused CCtx + CDict   ", [&](size_t i) {
+        output.clear();
+        compress_zstd_data(
+            context.cctx(), dictionary.cdict(level),
+            inner[i].data(), inner[i].size(), 0x01, static_cast<uint32_t>(size), output);
+    });
+}
+
+/// \brief Generates one hour of synthetic L1 quote ticks (ask/bid aligned to tick size 0.01).
+std::vector<dfh::MarketTick> generate_quote_ticks(size_t size, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<dfh::MarketTick> ticks(size);
+    uint64_t time_ms = 1700000000000ULL - (1700000000000ULL % 3600000ULL);
+    int64_t bid = 108500; // 1085.00 with tick 0.01
+    const uint64_t step = std::max<uint64_t>(1, 3600000ULL / (size + 1));
+    for (size_t i = 0; i < size; ++i) {
+        auto& tick = ticks[i];
+        time_ms += rng() % step;
+        const int64_t bid_move = static_cast<int64_t>(rng() % 3) - 1;
+        const int64_t spread = 1 + static_cast<int64_t>(rng() % 3);
+        bid += bid_move;
+        tick.time_ms = time_ms;
+        tick.bid = static_cast<double>(bid) / 100.0;
+        tick.ask = static_cast<double>(bid + spread) / 100.0;
+        tick.flags = bid_move ? dfh::TickUpdateFlags::BID_UPDATED : dfh::TickUpdateFlags::NONE;
+        if (i == 0 || spread != 1) tick.flags |= dfh::TickUpdateFlags::ASK_UPDATED;
+    }
+    return ticks;
+}
+
+/// \brief Round-trip test for TickCompressorV2 through TickSerializer.
+void test_quote_round_trip(size_t size) {
+    std::cout << "[Test TickCompressorV2 round trip] size = " << size << "\n";
+    auto ticks = generate_quote_ticks(size, 54321ULL + size);
+    dfh::TickCodecConfig config{};
+    config.tick_size = 0.01;
+    config.price_digits = 2;
+    config.set_flag(dfh::TickStorageFlags::ENABLE_TICK_FLAGS);
+
+    dfh::compression::TickSerializer serializer;
+    std::vector<uint8_t> encoded;
+    serializer.serialize(ticks, config, encoded);
+    assert(encoded[0] == 0x02);
+
+    std::vector<dfh::MarketTick> decoded;
+    serializer.deserialize(encoded, decoded);
+    assert(decoded.size() == ticks.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        assert(decoded[i].time_ms == ticks[i].time_ms);
+        assert(std::abs(decoded[i].ask - ticks[i].ask) < 1e-9);
+        assert(std::abs(decoded[i].bid - ticks[i].bid) < 1e-9);
+        assert(decoded[i].flags == ticks[i].flags);
+    }
+
+    dfh::compression::TickBinarySerializerV1 raw;
+    std::vector<uint8_t> raw_encoded;
+    config.set_flag(dfh::TickStorageFlags::STORE_RAW_BINARY);
+    raw.serialize(ticks, config, raw_encoded);
+    std::cout << "  => OK, " << encoded.size() << " bytes (raw binary: " << raw_encoded.size() << " bytes)\n";
+}
+
+/// \brief Splits ticks into hourly segments, as they are stored in the database.
+std::vector<std::vector<dfh::MarketTick>> split_by_hour(const std::vector<dfh::MarketTick>& ticks) {
+    std::vector<std::vector<dfh::MarketTick>> segments;
+    uint64_t hour = UINT64_MAX;
+    for (const auto& tick : ticks) {
+        if (tick.time_ms / 3600000ULL != hour) {
+            hour = tick.time_ms / 3600000ULL;
+            segments.emplace_back();
+        }
+        segments.back().push_back(tick);
+    }
+    return segments;
+}
+
+/// \brief Prints compressed size, encode/decode MB/s and compression ratio for every compression profile.
+/// \param ticks Source ticks (raw size is counted as sizeof(MarketTick) per tick).
+/// \param config Codec configuration.
+void benchmark_profiles(const std::vector<dfh::MarketTick>& ticks, dfh::TickCodecConfig config) {
+    using namespace dfh;
+    const auto segments = split_by_hour(ticks);
+    const double raw_mb = static_cast<double>(ticks.size() * sizeof(MarketTick)) / (1024.0 * 1024.0);
+    std::cout << "[Benchmark compression profiles] ticks = " << ticks.size()
+              << ", segments = " << segments.size() << "\n";
+    std::cout << "  profile      | level |    bytes | encode MB/s | decode MB/s | ratio\n";
+
+    const std::pair<TickCompressionProfile, const char*> profiles[] = {
+        {TickCompressionProfile::INGEST_FAST, "ingest-fast"},
+        {TickCompressionProfile::BALANCED,    "balanced   "},
+        {TickCompressionProfile::ARCHIVE,     "archive    "},
+    };
+
+    compression::TickCompressorV1 compressor;
+    for (const auto& profile : profiles) {
+        config.compression_profile = profile.first;
+        std::vector<std::vector<uint8_t>> encoded(segments.size());
+        size_t compressed_bytes = 0;
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < segments.size(); ++i) {
+            compressor.serialize(segments[i], config, encoded[i]);
+            compressed_bytes += encoded[i].size();
+        }
+        const double encode_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        std::vector<MarketTick> decoded;
+        decoded.reserve(ticks.size());
+        start = std::chrono::steady_clock::now();
+        for (const auto& segment : encoded) {
+            compressor.deserialize(segment, decoded);
+        }
+        const double decode_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        assert(decoded.size() == ticks.size());
+
+        std::cout << "  " << profile.second
+                  << "  | " << std::setw(5) << compression::zstd_compression_level(profile.first)
+                  << " | " << std::setw(8) << compressed_bytes
+                  << " | " << std::setw(11) << std::fixed << std::setprecision(1) << (encode_sec > 0.0 ? raw_mb / encode_sec : 0.0)
+                  << " | " << std::setw(11) << (decode_sec > 0.0 ? raw_mb / decode_sec : 0.0)
+                  << " | " << std::setprecision(2) << (compressed_bytes ? static_cast<double>(ticks.size() * sizeof(MarketTick)) / compressed_bytes : 0.0)
+                  << "\n" << std::defaultfloat;
+    }
+}
+
+/// \brief Checks that recompression to another profile keeps the decoded ticks intact.
+void test_recompress() {
+    std::cout << "[Test recompress ingest-fast -> archive]\n";
+    auto ticks = generate_trade_dump_ticks(3000, 99ULL);
+    auto config = make_trade_config();
+    config.compression_profile = dfh::TickCompressionProfile::INGEST_FAST;
+
+    dfh::compression::TickSerializer serializer;
+    std::vector<uint8_t> fast;
+    serializer.serialize(ticks, config, fast);
+
+    std::vector<uint8_t> archive;
+    serializer.recompress(fast, dfh::TickCompressionProfile::ARCHIVE, archive);
+    assert(dfh::compression::extract_num_samples(archive.data(), archive.size()) == ticks.size());
+
+    std::vector<dfh::MarketTick> decoded;
+    serializer.deserialize(archive, decoded);
+    assert(ticks_equal(ticks, decoded));
+    assert(archive.size() <= fast.size());
+    std::cout << "  => OK, " << fast.size() << " -> " << archive.size() << " bytes\n";
+}
+
+/// \brief Round-trip test for the receive latency stream (ENABLE_RECV_TIME).
+/// \param quotes Use quote ticks (TickCompressorV2) instead of trade ticks (TickCompressorV1).
+void test_recv_time_round_trip(bool quotes) {
+    std::cout << "[Test ENABLE_RECV_TIME round trip] " << (quotes ? "quotes" : "trades") << "\n";
+    auto ticks = quotes ? generate_quote_ticks(5000, 777ULL) : generate_trade_ticks(5000, 777ULL);
+    std::mt19937_64 rng(777ULL);
+    for (auto& tick : ticks) {
+        // Typical latency of a few ms with occasional clock skew into the past.
+        tick.received_ms = tick.time_ms + (rng() % 40) - 3;
+    }
+    ticks[ticks.size() / 2].received_ms = 0; // forces the 64-bit fallback
+
+    dfh::TickCodecConfig config{};
+    if (quotes) {
+        config.tick_size = 0.01;
+        config.price_digits = 2;
+        config.set_flag(dfh::TickStorageFlags::ENABLE_TICK_FLAGS);
+    } else {
+        config = make_trade_config();
+    }
+
+    dfh::compression::TickSerializer serializer;
+    std::vector<uint8_t> without_recv;
+    serializer.serialize(ticks, config, without_recv);
+
+    config.set_flag(dfh::TickStorageFlags::ENABLE_RECV_TIME);
+    std::vector<uint8_t> encoded;
+    serializer.serialize(ticks, config, encoded);
+
+    std::vector<dfh::MarketTick> decoded;
+    dfh::TickCodecConfig decoded_config;
+    serializer.deserialize(encoded, decoded, decoded_config);
+    assert(decoded_config.has_flag(dfh::TickStorageFlags::ENABLE_RECV_TIME));
+    assert(decoded.size() == ticks.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        assert(decoded[i].time_ms == ticks[i].time_ms);
+        assert(decoded[i].received_ms == ticks[i].received_ms);
+    }
+
+    decoded.clear();
+    serializer.deserialize(without_recv, decoded, decoded_config);
+    assert(!decoded_config.has_flag(dfh::TickStorageFlags::ENABLE_RECV_TIME));
+    assert(decoded[0].received_ms == 0);
+    std::cout << "  => OK, " << without_recv.size() << " -> " << encoded.size() << " bytes\n";
+}
+
+/// \brief Checks field-projected decoding and compares its speed with a full decode.
+void test_projected_decode() {
+    std::cout << "[Test projected decode]\n";
+    auto ticks = generate_trade_ticks(50000, 4242ULL);
+    for (auto& tick : ticks) tick.received_ms = tick.time_ms + 5;
+    auto config = make_trade_config();
+    config.set_flag(dfh::TickStorageFlags::ENABLE_RECV_TIME);
+
+    dfh::compression::TickSerializer serializer;
+    std::vector<uint8_t> encoded;
+    serializer.serialize(ticks, config, encoded);
+
+    std::vector<dfh::MarketTick> decoded;
+    serializer.deserialize(encoded, decoded, dfh::TickField::TIME | dfh::TickField::LAST);
+    assert(decoded.size() == ticks.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        assert(decoded[i].time_ms == ticks[i].time_ms);
+        assert(std::abs(decoded[i].last - ticks[i].last) <= 1e-9);
+        assert(decoded[i].volume == 0.0 && decoded[i].received_ms == 0);
+        assert(decoded[i].flags == dfh::TickUpdateFlags::NONE);
+    }
+
+    decoded.clear();
+    serializer.deserialize(encoded, decoded, dfh::TickField::RECV_TIME | dfh::TickField::FLAGS);
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        assert(decoded[i].received_ms == ticks[i].received_ms);
+        assert(decoded[i].flags == ticks[i].flags);
+        assert(decoded[i].last == 0.0);
+    }
+
+    decoded.clear();
+    serializer.deserialize(encoded, decoded, dfh::TickField::ALL);
+    assert(ticks_equal(ticks, decoded));
+
+    const size_t iterations = 50;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        decoded.clear();
+        serializer.deserialize(encoded, decoded);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        decoded.clear();
+        serializer.deserialize(encoded, decoded, dfh::TickField::TIME | dfh::TickField::LAST);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  => OK, full decode: "
+              << std::chrono::duration<double, std::micro>(mid - start).count() / iterations << " us, time + last: "
+              << std::chrono::duration<double, std::micro>(end - mid).count() / iterations << " us\n";
+}
+
+/// \brief Usage: test_tick_compressor [binance_futures_trades.csv price_digits volume_digits tick_size]
+/// \brief Checks the TickColumns overloads of TickCompressorV1 against the MarketTick path.
+void test_columns_round_trip() {
+    std::cout << "[Test tick columns]\n";
+    auto ticks = generate_trade_ticks(50000, 777ULL);
+    for (auto& tick : ticks) tick.received_ms = tick.time_ms + 3;
+    auto config = make_trade_config();
+    config.set_flag(dfh::TickStorageFlags::ENABLE_RECV_TIME);
+
+    dfh::TickColumns columns;
+    dfh::to_columns(ticks, columns);
+    assert(reinterpret_cast<uintptr_t>(columns.last.data()) % dfh::TickColumns::ALIGNMENT == 0);
+
+    dfh::compression::TickCompressorV1 compressor;
+    std::vector<uint8_t> from_ticks, from_columns;
+    compressor.serialize(ticks, config, from_ticks);
+    compressor.serialize(columns.view(), config, from_columns);
+    assert(from_ticks == from_columns);
+
+    dfh::TickColumns decoded;
+    compressor.deserialize(from_columns, decoded);
+    std::vector<dfh::MarketTick> decoded_ticks;
+    dfh::to_ticks(decoded, decoded_ticks);
+    assert(ticks_equal(ticks, decoded_ticks));
+
+    decoded.clear();
+    compressor.deserialize(from_columns, decoded, dfh::TickField::LAST);
+    assert(decoded.size() == ticks.size());
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        assert(std::abs(decoded.last[i] - ticks[i].last) <= 1e-9);
+        assert(decoded.time_ms[i] == 0 && decoded.volume[i] == 0.0);
+    }
+
+    const size_t iterations = 50;
+    std::vector<dfh::MarketTick> aos;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        aos.clear();
+        compressor.deserialize(from_columns, aos);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        decoded.clear();
+        compressor.deserialize(from_columns, decoded);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  => OK, decode into MarketTick: "
+              << std::chrono::duration<double, std::micro>(mid - start).count() / iterations << " us, into columns: "
+              << std::chrono::duration<double, std::micro>(end - mid).count() / iterations << " us\n";
+}
+
+/// \brief Checks TickBatchSerializer against a sequential TickSerializer and compares throughput.
+/// \param num_segments Number of hourly segments.
+/// \param segment_size Number of ticks per segment.
+void test_batch_serializer(size_t num_segments, size_t segment_size) {
+    std::cout << "[Test batch serializer] segments = " << num_segments << "\n";
+    std::vector<std::vector<dfh::MarketTick>> segments(num_segments);
+    for (size_t i = 0; i < num_segments; ++i) {
+        // Uneven segment sizes exercise the dynamic work distribution.
+        segments[i] = generate_trade_ticks(segment_size / (1 + i % 4), 99ULL + i);
+        for (auto& tick : segments[i]) tick.time_ms += i * 3600000ULL;
+    }
+    const auto config = make_trade_config();
+
+    dfh::compression::TickSerializer serializer;
+    std::vector<std::vector<uint8_t>> expected(num_segments);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < num_segments; ++i) {
+        serializer.serialize(segments[i], config, expected[i]);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+
+    dfh::compression::TickBatchSerializer batch(4);
+    size_t next_index = 0;
+    batch.serialize(segments, config, [&](size_t index, const std::vector<uint8_t>& output) {
+        assert(index == next_index++);
+        assert(output == expected[index]);
+    });
+    auto end = std::chrono::high_resolution_clock::now();
+    assert(next_index == num_segments);
+
+    std::vector<std::vector<uint8_t>> outputs;
+    dfh::compression::TickBatchSerializer single(1);
+    single.serialize(segments, config, outputs);
+    assert(outputs == expected);
+
+    bool caught = false;
+    try {
+        batch.serialize(segments, config, [](size_t index, const std::vector<uint8_t>&) {
+            if (index == 3) throw std::runtime_error("handler failure");
+        });
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    assert(caught || num_segments <= 3);
+
+    // The pool outlives a failed batch; the next batch runs on the same workers.
+    outputs.clear();
+    batch.serialize(segments, config, outputs);
+    assert(outputs == expected);
+
+    std::cout << "  => OK, sequential: "
+              << std::chrono::duration<double, std::milli>(mid - start).count() << " ms, "
+              << batch.num_threads() << " threads: "
+              << std::chrono::duration<double, std::milli>(end - mid).count() << " ms\n";
+}
+
+/// \brief Checks TickBatchDeserializer against sequential range decoding and compares throughput.
+/// \param num_segments Number of hourly segments.
+/// \param segment_size Number of ticks per segment.
+void test_batch_deserializer(size_t num_segments, size_t segment_size) {
+    std::cout << "[Test batch deserializer] segments = " << num_segments << "\n";
+    using namespace dfh::compression;
+    auto config = make_trade_config();
+    auto raw_config = config;
+    raw_config.set_flag(dfh::TickStorageFlags::STORE_RAW_BINARY);
+    auto block_config = config;
+    block_config.set_flag(dfh::TickStorageFlags::BLOCK_INDEX);
+
+    TickSerializer serializer;
+    std::vector<std::vector<uint8_t>> stored(num_segments);
+    for (size_t i = 0; i < num_segments; ++i) {
+        auto segment = generate_trade_ticks(segment_size / (1 + i % 3), 500ULL + i);
+        for (auto& tick : segment) tick.time_ms += i * 3600000ULL;
+        // Every codec may appear in a range; every fifth hour is missing.
+        if (i % 5 == 4) continue;
+        serializer.serialize(segment, i % 7 == 1 ? raw_config : (i % 7 == 2 ? block_config : config), stored[i]);
+    }
+    std::vector<TickSegmentRef> refs;
+    for (const auto& segment : stored) refs.push_back(TickSegmentRef{segment.data(), segment.size()});
+
+    auto decode_serial = [&](uint64_t start_ts, uint64_t end_ts, std::vector<dfh::MarketTick>& ticks, dfh::TickCodecConfig& out_config) {
+        for (const auto& segment : stored) {
+            if (segment.empty()) continue;
+            serializer.deserialize_range(segment, start_ts, end_ts, ticks, out_config);
+        }
+    };
+
+    TickBatchDeserializer batch(4);
+    const uint64_t base = 1700000000000ULL - (1700000000000ULL % 3600000ULL);
+    const uint64_t hour = 3600000ULL;
+    const std::pair<uint64_t, uint64_t> windows[] = {
+        {0, std::numeric_limits<uint64_t>::max()},
+        {base + hour / 2, base + (num_segments - 1) * hour + hour / 3},
+        {base + hour + 1000, base + hour + 2000},
+        {base + num_segments * hour, base + (num_segments + 1) * hour},
+    };
+    for (const auto& window : windows) {
+        std::vector<dfh::MarketTick> expected(3), actual(3);
+        dfh::TickCodecConfig expected_config{}, actual_config{};
+        decode_serial(window.first, window.second, expected, expected_config);
+        batch.deserialize_range(refs, window.first, window.second, actual, actual_config);
+        assert(ticks_equal(expected, actual));
+        if (window.second > base + (num_segments - 1) * hour) {
+            // Both decoded the last segment last.
+            assert(expected_config.flags == actual_config.flags);
+            assert(expected_config.price_digits == actual_config.price_digits);
+            assert(expected_config.volume_digits == actual_config.volume_digits);
+            assert(expected_config.tick_size == actual_config.tick_size);
+        }
+    }
+
+    // A serializer and a deserializer sharing one pool run on the same workers.
+    {
+        auto pool = std::make_shared<TickWorkerPool>(4);
+        TickBatchSerializer shared_writer(pool);
+        TickBatchDeserializer shared_reader(pool);
+        std::vector<std::vector<dfh::MarketTick>> sources(6);
+        std::vector<dfh::MarketTick> expected;
+        for (size_t i = 0; i < sources.size(); ++i) {
+            sources[i] = generate_trade_ticks(segment_size / 4 + 1, 800ULL + i);
+            for (auto& tick : sources[i]) tick.time_ms += i * 3600000ULL;
+            expected.insert(expected.end(), sources[i].begin(), sources[i].end());
+        }
+        std::vector<std::vector<uint8_t>> encoded;
+        shared_writer.serialize(sources, config, encoded);
+        std::vector<TickSegmentRef> shared_refs;
+        for (const auto& segment : encoded) shared_refs.push_back(TickSegmentRef{segment.data(), segment.size()});
+        std::vector<dfh::MarketTick> decoded;
+        dfh::TickCodecConfig decoded_config{};
+        shared_reader.deserialize(shared_refs, decoded, decoded_config);
+        assert(ticks_equal(expected, decoded));
+    }
+
+    std::vector<dfh::MarketTick> ticks(5);
+    dfh::TickCodecConfig out_config{};
+    const size_t bad_index = num_segments - 2; // never a missing hour
+    std::vector<uint8_t> corrupted = stored[bad_index];
+    corrupted[0] = 0x7F; // unknown signature
+    auto bad_refs = refs;
+    bad_refs[bad_index] = TickSegmentRef{corrupted.data(), corrupted.size()};
+    bool caught = false;
+    try {
+        batch.deserialize(bad_refs, ticks, out_config);
+    } catch (const std::exception&) {
+        caught = true;
+    }
+    assert(caught && ticks.size() == 5);
+
+    const size_t iterations = 5;
+    std::vector<dfh::MarketTick> output;
+    output.reserve(num_segments * segment_size);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        output.clear();
+        decode_serial(0, std::numeric_limits<uint64_t>::max(), output, out_config);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        output.clear();
+        batch.deserialize(refs, output, out_config);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    std::cout << "  => OK, sequential: "
+              << std::chrono::duration<double, std::milli>(mid - start).count() / iterations << " ms, "
+              << batch.num_threads() << " threads: "
+              << std::chrono::duration<double, std::milli>(end - mid).count() / iterations << " ms\n";
+}
+
+/// \brief Trains a dictionary from stored segments, registers it and decodes segments
+/// written with it by a serializer that only knows the registry.
+void test_dictionary_registry() {
+    std::cout << "[Test ZSTD dictionary registry]\n";
+    using namespace dfh::compression;
+    const auto config = make_trade_config();
+    TickSerializer writer;
+
+    std::vector<std::vector<uint8_t>> segments(64);
+    TickDictionaryTrainer trainer(32, 7);
+    for (size_t i = 0; i < segments.size(); ++i) {
+        writer.serialize(generate_trade_ticks(2000, 500ULL + i), config, segments[i]);
+        const uint32_t id = extract_zstd_dictionary_id(segments[i].data(), segments[i].size());
+        assert(id == 0 || id == zstd_dictionary_tick_compressor_v1().id());
+        trainer.add_segment(segments[i]);
+    }
+    assert(trainer.num_segments() == segments.size());
+    assert(trainer.num_samples() == 32);
+
+    const std::vector<uint8_t> dictionary = trainer.train(16 * 1024);
+    const uint32_t id = ZstdDictionaryRegistry::instance().add(dictionary);
+    assert(id != 0 && ZstdDictionaryRegistry::instance().add(dictionary) == id);
+    assert(ZstdDictionaryRegistry::instance().contains(id));
+
+    const auto ticks = generate_trade_ticks(3000, 900ULL);
+    std::vector<uint8_t> builtin, trained;
+    writer.serialize(ticks, config, builtin);
+    writer.set_dictionary_id(id);
+    writer.serialize(ticks, config, trained);
+    assert(extract_zstd_dictionary_id(trained.data(), trained.size()) == id);
+
+    TickSerializer reader;
+    std::vector<dfh::MarketTick> decoded;
+    reader.deserialize(trained, decoded);
+    assert(ticks_equal(ticks, decoded));
+
+    // Recompression moves a segment to the writer's dictionary.
+    std::vector<uint8_t> migrated;
+    writer.recompress(builtin, dfh::TickCompressionProfile::ARCHIVE, migrated);
+    assert(extract_zstd_dictionary_id(migrated.data(), migrated.size()) == id);
+    decoded.clear();
+    reader.deserialize(migrated, decoded);
+    assert(ticks_equal(ticks, decoded));
+
+    std::cout << "  => OK, dictionary " << id << " (" << dictionary.size() << " bytes): "
+              << builtin.size() << " -> " << trained.size() << " bytes\n";
+}
+
+/// \brief Checks that AUTO_CODEC keeps the smaller encoding and decodes it by signature.
+void test_auto_codec() {
+    std::cout << "[Test AUTO_CODEC selection]\n";
+    using namespace dfh::compression;
+    auto config = make_trade_config();
+    TickSerializer fixed, adaptive;
+    std::vector<dfh::MarketTick> decoded, all_ticks, all_decoded;
+    std::vector<std::vector<uint8_t>> all_selected;
+    const size_t sizes[] = {1, 2, 3, 5, 10, 50, 2000};
+    for (size_t size : sizes) {
+        const auto ticks = generate_trade_ticks(size, 31ULL + size);
+        std::vector<uint8_t> compressed, selected;
+        fixed.serialize(ticks, config, compressed);
+        config.set_flag(dfh::TickStorageFlags::AUTO_CODEC);
+        adaptive.serialize(ticks, config, selected);
+        config.clear_flag(dfh::TickStorageFlags::AUTO_CODEC);
+
+        assert(selected.size() <= compressed.size());
+        assert(selected.size() <= 32 + size * sizeof(dfh::MarketTick));
+        decoded.clear();
+        adaptive.deserialize(selected, decoded);
+        assert(ticks_equal(ticks, decoded));
+        std::cout << "  ticks = " << size << ": " << (selected[0] == 0x00 ? "raw binary" : "compressor")
+                  << ", " << selected.size() << " bytes (compressed " << compressed.size() << ")\n";
+        all_ticks.insert(all_ticks.end(), ticks.begin(), ticks.end());
+        all_selected.push_back(std::move(selected));
+    }
+
+    // Raw and compressed segments decoded one after another append to the same vector.
+    // A forced raw segment goes last, since the selection may keep every segment compressed.
+    auto raw_config = config;
+    raw_config.set_flag(dfh::TickStorageFlags::STORE_RAW_BINARY);
+    const auto raw_ticks = generate_trade_ticks(4, 29ULL);
+    std::vector<uint8_t> raw_segment;
+    fixed.serialize(raw_ticks, raw_config, raw_segment);
+    assert(raw_segment[0] == 0x00);
+    all_ticks.insert(all_ticks.end(), raw_ticks.begin(), raw_ticks.end());
+    all_selected.push_back(std::move(raw_segment));
+    for (const auto& segment : all_selected) {
+        adaptive.deserialize(segment, all_decoded);
+    }
+    assert(ticks_equal(all_ticks, all_decoded));
+
+    const TickCodecStats& stats = adaptive.auto_stats();
+    assert(stats.segments() == sizeof(sizes) / sizeof(sizes[0]));
+    assert(stats.compressor_v2 == 0 && stats.compressor_v1 >= 1);
+    std::cout << "  => OK, wins: raw " << stats.raw_binary << ", V1 " << stats.compressor_v1
+              << ", raw trials " << stats.raw_trials << "\n";
+    adaptive.reset_auto_stats();
+    assert(adaptive.auto_stats().segments() == 0);
+}
+
+/// \brief Checks that a replay loop over decode_into() performs no heap allocations.
+/// \details Allocations are counted on glibc without sanitizers; elsewhere only the results are checked.
+void test_decode_into() {
+    std::cout << "[Test decode_into]\n";
+    using namespace dfh::compression;
+    dfh::TickCodecConfig quote_config{};
+    quote_config.tick_size = 0.01;
+    quote_config.price_digits = 2;
+    quote_config.set_flag(dfh::TickStorageFlags::ENABLE_TICK_FLAGS);
+    auto raw_config = make_trade_config();
+    raw_config.set_flag(dfh::TickStorageFlags::STORE_RAW_BINARY);
+
+    TickSerializer writer;
+    std::vector<std::vector<dfh::MarketTick>> sources;
+    std::vector<std::vector<uint8_t>> segments;
+    for (size_t i = 0; i < 12; ++i) {
+        const size_t size = 100 + i * 700;
+        sources.push_back(i % 3 == 1 ? generate_quote_ticks(size, 70ULL + i) : generate_trade_ticks(size, 70ULL + i));
+        segments.emplace_back();
+        writer.serialize(sources.back(), i % 3 == 1 ? quote_config : (i % 3 == 0 ? make_trade_config() : raw_config), segments.back());
+    }
+
+    TickSerializer reader;
+    std::vector<dfh::MarketTick> buffer(8000);
+    std::vector<dfh::MarketTick> expected;
+    for (int pass = 0; pass < 3; ++pass) {
+        const size_t allocations = g_num_allocations.load();
+        for (size_t i = 0; i < segments.size(); ++i) {
+            const size_t count = reader.decode_into(segments[i].data(), segments[i].size(), buffer.data(), buffer.size());
+            assert(count == sources[i].size());
+        }
+        // The first pass grows the scratch buffers; later passes must not allocate.
+        if (DFH_COUNT_ALLOCATIONS && pass > 0) assert(g_num_allocations.load() == allocations);
+    }
+
+    for (size_t i = 0; i < segments.size(); ++i) {
+        const size_t count = reader.decode_into(segments[i].data(), segments[i].size(), buffer.data(), buffer.size());
+        expected.clear();
+        reader.deserialize(segments[i], expected);
+        assert(count == expected.size());
+        assert(std::memcmp(buffer.data(), expected.data(), count * sizeof(dfh::MarketTick)) == 0);
+
+        // In-place decoding from a pointer and length, as for values read from a database page.
+        std::vector<dfh::MarketTick> in_place;
+        dfh::TickCodecConfig config;
+        reader.deserialize(segments[i].data(), segments[i].size(), in_place, config);
+        assert(in_place.size() == count);
+        assert(std::memcmp(in_place.data(), expected.data(), count * sizeof(dfh::MarketTick)) == 0);
+    }
+
+    bool thrown = false;
+    try {
+        reader.decode_into(segments.back().data(), segments.back().size(), buffer.data(), sources.back().size() - 1);
+    } catch (const std::length_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "  => OK\n";
+}
+
+/// \brief Round trip and range decoding of BLOCK_INDEX segments.
+void test_block_index() {
+    std::cout << "[Test BLOCK_INDEX segments]\n";
+    using namespace dfh::compression;
+    const auto ticks = generate_trade_ticks(20000, 4242ULL);
+    auto config = make_trade_config();
+    TickSerializer serializer;
+    std::vector<uint8_t> plain, blocked;
+    serializer.serialize(ticks, config, plain);
+    config.set_flag(dfh::TickStorageFlags::BLOCK_INDEX);
+    serializer.serialize(ticks, config, blocked);
+    assert(blocked[0] == TickBlockIndex::SIGNATURE);
+    assert(extract_num_samples(blocked.data(), blocked.size()) == ticks.size());
+
+    TickBlockIndex index;
+    index.parse(blocked.data(), blocked.size());
+    assert(index.num_ticks() == ticks.size());
+    const size_t num_blocks = index.blocks().size();
+    assert(num_blocks >= 20 && num_blocks <= 61);
+
+    TickSerializer reader;
+    std::vector<dfh::MarketTick> decoded;
+    dfh::TickCodecConfig decoded_config;
+    reader.deserialize(blocked, decoded, decoded_config);
+    assert(ticks_equal(ticks, decoded));
+    assert(decoded_config.has_flag(dfh::TickStorageFlags::BLOCK_INDEX));
+    assert(decoded_config.has_flag(dfh::TickStorageFlags::TRADE_BASED));
+
+    std::vector<dfh::MarketTick> buffer(ticks.size());
+    assert(reader.decode_into(blocked.data(), blocked.size(), buffer.data(), buffer.size()) == ticks.size());
+    assert(ticks_equal(ticks, buffer));
+
+    // Five-minute windows, including the edges of the hour and an empty window.
+    const uint64_t hour_ms = ticks[0].time_ms - ticks[0].time_ms % 3600000ULL;
+    const uint64_t windows[][2] = {
+        {hour_ms, hour_ms + 300000},
+        {hour_ms + 734567, hour_ms + 1034567},
+        {ticks.back().time_ms - 200000, ticks.back().time_ms + 1},
+        {ticks[100].time_ms, ticks[100].time_ms + 1},
+        {hour_ms + 3600000, hour_ms + 3900000}};
+    for (const auto& window : windows) {
+        std::vector<dfh::MarketTick> expected;
+        for (const auto& tick : ticks) {
+            if (tick.time_ms >= window[0] && tick.time_ms < window[1]) expected.push_back(tick);
+        }
+        std::vector<dfh::MarketTick> range(1, ticks[0]);
+        reader.deserialize_range(blocked, window[0], window[1], range, decoded_config);
+        assert(range.size() == expected.size() + 1);
+        range.erase(range.begin());
+        assert(ticks_equal(expected, range));
+
+        range.clear();
+        reader.deserialize_range(plain, window[0], window[1], range, decoded_config);
+        assert(ticks_equal(expected, range));
+
+        const auto blocks = index.find_blocks(window[0], window[1]);
+        assert(blocks.second - blocks.first <= 7);
+    }
+
+    // Recompression keeps the block layout.
+    std::vector<uint8_t> archived;
+    reader.recompress(blocked, dfh::TickCompressionProfile::ARCHIVE, archived);
+    decoded.clear();
+    reader.deserialize(archived, decoded);
+    assert(ticks_equal(ticks, decoded));
+
+    // Sparse quotes with AUTO_CODEC: small blocks may be stored as raw binary.
+    auto quotes = generate_quote_ticks(40, 99ULL);
+    dfh::TickCodecConfig quote_config{};
+    quote_config.tick_size = 0.01;
+    quote_config.price_digits = 2;
+    quote_config.set_flag(dfh::TickStorageFlags::ENABLE_TICK_FLAGS);
+    quote_config.set_flag(dfh::TickStorageFlags::AUTO_CODEC);
+    quote_config.set_flag(dfh::TickStorageFlags::BLOCK_INDEX);
+    serializer.set_block_layout(0, 16);
+    std::vector<uint8_t> sparse;
+    serializer.serialize(quotes, quote_config, sparse);
+    index.parse(sparse.data(), sparse.size());
+    assert(index.blocks().size() == 3);
+    decoded.clear();
+    reader.deserialize(sparse, decoded);
+    assert(decoded.size() == quotes.size());
+    for (size_t i = 0; i < quotes.size(); ++i) {
+        assert(decoded[i].time_ms == quotes[i].time_ms);
+        assert(std::abs(decoded[i].bid - quotes[i].bid) < 1e-9);
+        assert(std::abs(decoded[i].ask - quotes[i].ask) < 1e-9);
+    }
+
+    std::cout << "  => OK, " << plain.size() << " bytes plain, " << blocked.size() << " bytes in "
+              << num_blocks << " blocks\n";
+}
+
+/// \brief Checks decoding into ScaledTickColumns (integer prices) against the double decode.
+void test_scaled_columns() {
+    std::cout << "[Test scaled tick columns]\n";
+    auto ticks = generate_trade_ticks(50000, 4242ULL);
+    const auto config = make_trade_config();
+    dfh::compression::TickCompressorV1 compressor;
+    std::vector<uint8_t> binary;
+    compressor.serialize(ticks, config, binary);
+
+    dfh::ScaledTickColumns scaled;
+    compressor.deserialize(binary, scaled);
+    assert(scaled.size() == ticks.size());
+    assert(scaled.price_digits == config.price_digits);
+    dfh::TickColumns columns;
+    compressor.deserialize(binary, columns);
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        assert(scaled.last[i] == std::llround(ticks[i].last * 10.0));
+        const double price = scaled.price(i);
+        assert(std::memcmp(&price, &columns.last[i], sizeof(double)) == 0);
+        assert(scaled.time_ms[i] == ticks[i].time_ms && scaled.flags[i] == columns.flags[i]);
+    }
+    std::vector<dfh::MarketTick> decoded_ticks;
+    dfh::to_ticks(scaled, decoded_ticks);
+    assert(ticks_equal(ticks, decoded_ticks));
+
+    // Appending keeps the scale; a segment with other price digits is rejected.
+    compressor.deserialize(binary, scaled, dfh::TickField::LAST);
+    assert(scaled.size() == 2 * ticks.size() && scaled.last.back() == scaled.last[ticks.size() - 1]);
+    auto other_config = config;
+    other_config.price_digits = 2;
+    other_config.tick_size = 0.01;
+    std::vector<uint8_t> other;
+    compressor.serialize(ticks, other_config, other);
+    bool rejected = false;
+    try {
+        compressor.deserialize(other, scaled);
+    } catch (const std::invalid_argument&) {
+        rejected = true;
+    }
+    assert(rejected);
+
+    // Price jumps beyond the int32 delta range take the 64-bit path.
+    auto jumps = generate_trade_ticks(1000, 99ULL);
+    for (size_t i = 500; i < jumps.size(); ++i) jumps[i].last += 500000000.0;
+    binary.clear();
+    compressor.serialize(jumps, config, binary);
+    scaled.clear();
+    compressor.deserialize(binary, scaled);
+    for (size_t i = 0; i < jumps.size(); ++i) {
+        assert(scaled.last[i] == std::llround(jumps[i].last * 10.0));
+    }
+
+    const size_t iterations = 50;
+    int64_t checksum = 0;
+    binary.clear();
+    compressor.serialize(ticks, config, binary);
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        columns.clear();
+        compressor.deserialize(binary, columns, dfh::TickField::LAST);
+        for (double price : columns.last) checksum += dfh::utils::to_fixed_point(price, 10.0);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < iterations; ++i) {
+        scaled.clear();
+        compressor.deserialize(binary, scaled, dfh::TickField::LAST);
+        for (int64_t price : scaled.last) checksum -= price;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    assert(checksum == 0);
+    std::cout << "  => OK, fixed-point prices via double columns: "
+              << std::chrono::duration<double, std::micro>(mid - start).count() / iterations << " us, via scaled columns: "
+              << std::chrono::duration<double, std::micro>(end - mid).count() / iterations << " us\n";
+}
+
+/// \brief Generates one hour of quotes published at a fixed period with jitter and gaps.
+/// \param period_ms Publishing period.
+/// \param jitter Shift about a fifth of the updates by 1 ms.
+/// \param seed Random seed.
+std::vector<dfh::MarketTick> generate_periodic_ticks(uint64_t period_ms, bool jitter, uint64_t seed) {
+    auto ticks = generate_quote_ticks(3600000ULL / period_ms - 1, seed);
+    std::mt19937_64 rng(seed);
+    uint64_t time_ms = ticks[0].time_ms;
+    for (auto& tick : ticks) {
+        tick.time_ms = time_ms;
+        time_ms += period_ms;
+        const uint64_t r = rng() % 100;
+        if (jitter && r < 10) time_ms += 1;                 // late publication
+        else if (jitter && r < 20) time_ms -= 1;            // early publication
+        else if (r == 99) time_ms += period_ms;   // missed update
+    }
+    return ticks;
+}
+
+/// \brief Round-trip test of DELTA_OF_DELTA_TIME and a size/speed comparison with first-order deltas.
+void test_delta_of_delta_time() {
+    std::cout << "[Test DELTA_OF_DELTA_TIME]\n";
+    using namespace dfh::compression;
+    struct Feed {
+        const char* name;
+        std::vector<dfh::MarketTick> ticks;
+        dfh::TickCodecConfig config;
+    };
+    dfh::TickCodecConfig quote_config{};
+    quote_config.tick_size = 0.01;
+    quote_config.price_digits = 2;
+    quote_config.set_flag(dfh::TickStorageFlags::ENABLE_TICK_FLAGS);
+    Feed feeds[] = {
+        {"trades",                 generate_trade_ticks(50000, 19ULL), make_trade_config()},
+        {"quotes 100 ms",          generate_periodic_ticks(100, false, 19ULL), quote_config},
+        {"quotes 100 ms, jitter",  generate_periodic_ticks(100, true, 19ULL), quote_config},
+        {"quotes 1000 ms, jitter", generate_periodic_ticks(1000, true, 19ULL), quote_config},
+    };
+
+    TickSerializer serializer;
+    TickCompressionContextV1 context;
+    TickEncoderV1 encoder(context);
+    TickDecoderV1 decoder(context);
+    std::vector<uint64_t> time_ms, decoded_time_ms;
+    std::vector<uint8_t> column;
+    for (auto& feed : feeds) {
+        // Full segments round-trip and report the mode in the decoded configuration.
+        std::vector<uint8_t> plain, dod;
+        serializer.serialize(feed.ticks, feed.config, plain);
+        feed.config.set_flag(dfh::TickStorageFlags::DELTA_OF_DELTA_TIME);
+        serializer.serialize(feed.ticks, feed.config, dod);
+        feed.config.clear_flag(dfh::TickStorageFlags::DELTA_OF_DELTA_TIME);
+
+        std::vector<dfh::MarketTick> decoded;
+        dfh::TickCodecConfig decoded_config;
+        serializer.deserialize(dod, decoded, decoded_config);
+        assert(decoded_config.has_flag(dfh::TickStorageFlags::DELTA_OF_DELTA_TIME));
+        for (size_t i = 0; i < feed.ticks.size(); ++i) {
+            assert(decoded[i].time_ms == feed.ticks[i].time_ms);
+            assert(decoded[i].flags == feed.ticks[i].flags);
+        }
+        decoded.clear();
+        serializer.deserialize(plain, decoded, decoded_config);
+        assert(!decoded_config.has_flag(dfh::TickStorageFlags::DELTA_OF_DELTA_TIME));
+
+        // Time column alone.
+        const size_t num_ticks = feed.ticks.size();
+        const uint64_t base_time = feed.ticks[0].time_ms - feed.ticks[0].time_ms % 3600000ULL;
+        time_ms.resize(num_ticks);
+        decoded_time_ms.resize(num_ticks);
+        for (size_t i = 0; i < num_ticks; ++i) time_ms[i] = feed.ticks[i].time_ms;
+
+        std::cout << "  " << feed.name << " (" << num_ticks << " ticks), segment " << plain.size() << " -> " << dod.size() << " bytes\n";
+        for (bool delta_of_delta : {false, true}) {
+            const int iterations = 200;
+            size_t column_size = 0;
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                column.clear();
+                assert(encoder.encode_time(column, time_ms.data(), num_ticks, base_time, delta_of_delta) == delta_of_delta);
+                column_size = column.size();
+            }
+            auto mid = std::chrono::high_resolution_clock::now();
+            for (int it = 0; it < iterations; ++it) {
+                size_t offset = 0;
+                assert(decoder.decode_time(decoded_time_ms.data(), column.data(), offset, num_ticks, base_time) == delta_of_delta);
+                assert(offset == column.size());
+            }
+            auto end = std::chrono::high_resolution_clock::now();
+            assert(decoded_time_ms == time_ms);
+
+            const double mb = static_cast<double>(num_ticks * sizeof(uint64_t) * iterations) / (1024.0 * 1024.0);
+            std::cout << "    " << (delta_of_delta ? "delta-of-delta" : "delta         ") << ": time column " << column_size
+                      << " bytes, encode " << mb / std::chrono::duration<double>(mid - start).count()
+                      << " MB/s, decode " << mb / std::chrono::duration<double>(end - mid).count() << " MB/s\n";
+        }
+    }
+
+    // Gaps beyond the int32 range fall back to first-order deltas.
+    time_ms = {0, 1, 0x90000000ULL, 0x90000001ULL};
+    column.clear();
+    assert(!encoder.encode_time(column, time_ms.data(), time_ms.size(), 0, true));
+    size_t offset = 0;
+    decoded_time_ms.resize(time_ms.size());
+    assert(!decoder.decode_time(decoded_time_ms.data(), column.data(), offset, time_ms.size(), 0));
+    assert(decoded_time_ms == time_ms);
+    std::cout << "  => OK\n";
+}
+
+/// \brief Checks lossless bitplane flag columns and compares their size with the legacy side flag column.
+void test_tick_flag_planes() {
+    std::cout << "[Test TickUpdateFlags bitplanes]\n";
+    using namespace dfh::compression;
+    auto ticks = generate_trade_ticks(20000, 4242ULL);
+    std::mt19937_64 rng(4242ULL);
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        // Bursts of BEST_MATH and sporadic LAST_UPDATED, which the side flag column dropped.
+        if ((i / 500) % 3 == 0) ticks[i].flags |= dfh::TickUpdateFlags::BEST_MATH;
+        if (rng() % 50 == 0) ticks[i].flags |= dfh::TickUpdateFlags::LAST_UPDATED;
+    }
+
+    auto config = make_trade_config();
+    TickSerializer serializer;
+    std::vector<uint8_t> encoded;
+    serializer.serialize(ticks, config, encoded);
+    std::vector<dfh::MarketTick> decoded;
+    serializer.deserialize(encoded, decoded);
+    assert(ticks_equal(ticks, decoded));
+
+    TickCompressorV1 compressor;
+    dfh::TickColumns columns;
+    compressor.deserialize(encoded, columns);
+    for (size_t i = 0; i < ticks.size(); ++i) assert(columns.flags[i] == ticks[i].flags);
+
+    TickCompressionContextV1 context;
+    TickEncoderV1 encoder(context);
+    TickDecoderV1 decoder(context);
+    std::vector<dfh::MarketTick> flags_only(ticks.size());
+    for (size_t num_ticks : {size_t(1), size_t(31), size_t(33), ticks.size()}) {
+        // Legacy columns decode to the trade side only.
+        std::vector<uint8_t> legacy, planes;
+        encoder.encode_side_flags(legacy, ticks.data(), num_ticks);
+        size_t offset = 0;
+        assert(!decoder.decode_tick_flags(flags_only.data(), legacy.data(), offset, num_ticks));
+        for (size_t i = 0; i < num_ticks; ++i) {
+            assert(flags_only[i].has_flag(dfh::TickUpdateFlags::TICK_FROM_BUY) == ticks[i].has_flag(dfh::TickUpdateFlags::TICK_FROM_BUY));
+        }
+
+        encoder.encode_tick_flags(planes, ticks.data(), num_ticks);
+        offset = 0;
+        assert(decoder.decode_tick_flags(flags_only.data(), planes.data(), offset, num_ticks));
+        assert(offset == planes.size());
+        for (size_t i = 0; i < num_ticks; ++i) assert(flags_only[i].flags == ticks[i].flags);
+        std::cout << "  ticks = " << num_ticks << ": legacy " << legacy.size() << " bytes, bitplanes " << planes.size() << " bytes\n";
+    }
+
+    // A run count that does not add up to the tick count is rejected.
+    std::vector<dfh::MarketTick> constant(4096);
+    for (size_t i = 0; i < constant.size(); ++i) {
+        constant[i].flags = i < 2048 ? dfh::TickUpdateFlags::TICK_FROM_BUY : dfh::TickUpdateFlags::TICK_FROM_SELL;
+    }
+    std::vector<uint8_t> planes;
+    encoder.encode_tick_flags(planes, constant.data(), constant.size());
+    assert(planes[3] != 0);
+    planes.back() += 1;
+    bool thrown = false;
+    try {
+        size_t offset = 0;
+        decoder.decode_tick_flags(flags_only.data(), planes.data(), offset, constant.size());
+    } catch (const std::runtime_error&) {
+        thrown = true;
+    }
+    assert(thrown);
+    std::cout << "  => OK, " << constant.size() << " two-sided ticks in " << planes.size() << " bytes\n";
+}
+
+int main(int argc, char* argv[]) {
+    test_round_trip(1);
+    test_round_trip(127);
+    test_round_trip(1000);
+    test_round_trip(50000);
+
+    test_quote_round_trip(1);
+    test_quote_round_trip(1000);
+    test_quote_round_trip(50000);
+
+    benchmark_zstd_contexts(200, 500);
+    benchmark_zstd_contexts(5000, 200);
+
+    test_recompress();
+
+    test_recv_time_round_trip(false);
+    test_recv_time_round_trip(true);
+
+    test_projected_decode();
+
+    test_columns_round_trip();
+
+    test_batch_serializer(1, 1000);
+    test_batch_serializer(240, 20000);
+
+    test_batch_deserializer(3, 1000);
+    test_batch_deserializer(720, 20000);
+
+    test_dictionary_registry();
+
+    test_auto_codec();
+
+    test_decode_into();
+
+    test_block_index();
+
+    test_scaled_columns();
+
+    test_delta_of_delta_time();
+
+    test_tick_flag_planes();
+
+    if (argc >= 5) {
+        std::ifstream file(argv[1], std::ios::binary);
+        std::stringstream csv;
+        csv << file.rdbuf();
+        dfh::MarketTickSequence sequence;
+        dfh::utils::parse_binance_futures_trades(sequence, csv.str());
+        auto config = make_trade_config();
+        config.price_digits = static_cast<uint8_t>(std::stoi(argv[2]));
+        config.volume_digits = static_cast<uint8_t>(std::stoi(argv[3]));
+        config.tick_size = std::stod(argv[4]);
+        benchmark_profiles(sequence.ticks, config);
+    } else {
+        std::vector<dfh::MarketTick> day;
+        for (uint64_t hour = 0; hour < 24; ++hour) {
+            auto ticks = generate_trade_dump_ticks(10000, 2024ULL + hour);
+            for (auto& tick : ticks) tick.time_ms += hour * 3600000ULL;
+            day.insert(day.end(), ticks.begin(), ticks.end());
+        }
+        benchmark_profiles(day, make_trade_config());
+    }
+
+    std::cout << "All tests passed.\n";
+    return 0;
+}